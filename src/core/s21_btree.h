@@ -0,0 +1,1078 @@
+#ifndef SRC_CORE_S21_BTREE_H_
+#define SRC_CORE_S21_BTREE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_node_pool.h"
+#include "s21_rbtree.h"
+
+namespace s21 {
+
+/*
+  Backend policy of the tree based containers: the elements are kept in a
+  B-tree of NodeBytes sized nodes instead of a red-black tree.
+
+  A node holds as many elements side by side as fit in NodeBytes, so a
+  lookup reads one node (a few neighbouring cache lines) per level and the
+  tree is only log(n) / log(elements per node) levels deep. In exchange
+  elements move between slots and nodes on insert and erase: every insert
+  and erase invalidates all iterators but end(), and node handles and
+  merge() move the values instead of relinking nodes. The order_statistic
+  and threaded augmentations are not available.
+*/
+template <std::size_t NodeBytes = 256>
+struct btree_policy {
+  static_assert(NodeBytes >= 256 && NodeBytes <= 4096,
+                "B-tree nodes take from 256 bytes to 4 KB");
+
+  static constexpr bool order_statistic = false;
+  static constexpr bool threaded = false;
+  static constexpr std::size_t node_bytes = NodeBytes;
+};
+
+/*
+  B-tree with the same interface as RBTree, positions being Cursor values
+  (a node and a slot in it) instead of node pointers.
+
+  Every node keeps up to kSlots elements in key order. An inner node with
+  count elements also has count + 1 children, the elements of child i lying
+  between its elements i - 1 and i. All leaves are on the same level. A
+  full node is split before an insert into it; a split at its very end or
+  start moves its median up and leaves the new node nearly empty, so
+  sorted input fills the nodes up. A node left with fewer than kMinSlots
+  elements by an erase borrows one from a sibling or is merged with it.
+
+  Leaves come from the node pool, inner nodes (about one per kSlots
+  leaves) from the system allocator.
+*/
+template <typename KeyT, typename ValT, bool multi_type,
+          typename Compare = std::less<KeyT>,
+          typename Policy = btree_policy<>>
+class BTree {
+ private:
+  static constexpr bool kKeyOnly = std::is_void_v<ValT>;
+
+ public:
+  // A void ValT makes the nodes of set-like trees store the key only
+  using value_type =
+      std::conditional_t<kKeyOnly, KeyT, std::pair<const KeyT, ValT>>;
+  using size_type = std::size_t;
+
+ private:
+  // Slots hold pairs with a mutable key, so elements can be moved from slot
+  // to slot. They are handed out as value_type, which has the same layout.
+  using slot_type = std::conditional_t<kKeyOnly, KeyT, std::pair<KeyT, ValT>>;
+
+  static constexpr size_type kSlots = std::max<size_type>(
+      3, (Policy::node_bytes - 2 * sizeof(void*)) / sizeof(slot_type));
+  static constexpr size_type kMinSlots = (kSlots - 1) / 2;
+  static_assert(kSlots <= UINT16_MAX, "Too many slots for a B-tree node");
+
+  struct InnerNode;
+
+ public:
+  struct Node {
+    InnerNode* parent_ = nullptr;
+    std::uint16_t position_ = 0;
+    std::uint16_t count_ = 0;
+    bool leaf_ = true;
+    alignas(slot_type) unsigned char storage_[kSlots * sizeof(slot_type)];
+
+    slot_type* slots() { return reinterpret_cast<slot_type*>(storage_); }
+  };
+
+  // Position of an element. The default one has no node and stands for
+  // end(), and for the missing element in search().
+  struct Cursor {
+    Node* node_ = nullptr;
+    size_type index_ = 0;
+
+    explicit operator bool() const { return node_ != nullptr; }
+    bool operator==(const Cursor& other) const {
+      return node_ == other.node_ && index_ == other.index_;
+    }
+    bool operator!=(const Cursor& other) const { return !(*this == other); }
+  };
+
+  using pool_type = NodePool<Node>;
+  using pool_pointer = std::shared_ptr<pool_type>;
+
+  // Owns an element taken out of a tree by extract() until it is inserted
+  // into a tree again or destroyed
+  class NodeHandle {
+   public:
+    NodeHandle() noexcept = default;
+    NodeHandle(const NodeHandle& other) = delete;
+    NodeHandle(NodeHandle&& other) noexcept = default;
+
+    NodeHandle& operator=(const NodeHandle& other) = delete;
+    NodeHandle& operator=(NodeHandle&& other) noexcept = default;
+
+    bool empty() const noexcept { return slot_ == nullptr; }
+    explicit operator bool() const noexcept { return !empty(); }
+    const KeyT& key() const { return keyOf(*slot_); }
+    value_type& value() const { return asValue(*slot_); }
+    auto& mapped() const { return slot_->second; }
+
+   private:
+    friend class BTree;
+
+    explicit NodeHandle(std::unique_ptr<slot_type> slot) noexcept
+        : slot_(std::move(slot)) {}
+
+    std::unique_ptr<slot_type> slot_;
+  };
+
+ private:
+  struct InnerNode : Node {
+    Node* children_[kSlots + 1];
+  };
+
+  Node* root_ = nullptr;
+  pool_pointer pool_;
+  Compare compare_;
+
+ public:
+  BTree() = default;
+  explicit BTree(pool_pointer pool) : pool_(std::move(pool)) {}
+  ~BTree() { deleteTree(root_); }
+
+  bool isEmpty() const { return root_ == nullptr; }
+  Compare keyComp() const { return compare_; }
+
+  template <typename V>
+  std::pair<Cursor, bool> insert(V&& value);
+  template <typename V>
+  std::pair<Cursor, bool> insertHint(Cursor hint, V&& value);
+  template <typename... Args>
+  std::pair<Cursor, bool> emplace(Args&&... args);
+  template <typename... Args>
+  std::pair<Cursor, bool> emplaceHint(Cursor hint, Args&&... args);
+  template <typename K, typename... Args>
+  std::pair<Cursor, bool> tryEmplace(K&& key, Args&&... args);
+  void remove(const KeyT& key);
+  void removeNode(Cursor cursor) { eraseAt(cursor); }
+  NodeHandle extract(Cursor cursor);
+  std::pair<Cursor, bool> insertHandle(NodeHandle& handle);
+  size_type merge(BTree& other);
+  size_type removeRange(Cursor first, Cursor last, size_type treeSize);
+
+  template <typename ForwardIt>
+  size_type assignSorted(ForwardIt first, ForwardIt last);
+
+  // Lookups take any key type the comparator accepts next to KeyT
+  template <typename K>
+  Cursor search(const K& key) const;
+  template <typename K>
+  Cursor lowerBound(const K& key) const;
+  template <typename K>
+  Cursor upperBound(const K& key) const;
+  template <typename K>
+  std::pair<Cursor, Cursor> equalRange(const K& key) const {
+    return std::make_pair(lowerBound(key), upperBound(key));
+  }
+
+  Cursor select(size_type index) const;
+  size_type rank(const KeyT& key) const;
+  size_type indexOf(Cursor cursor) const;
+  Cursor getMin() const;
+  Cursor getMax() const { return Cursor(); }
+
+  Cursor getNext(Cursor cursor) const;
+  Cursor getPrev(Cursor cursor) const;
+
+  static value_type& valueOf(Cursor cursor) {
+    return asValue(cursor.node_->slots()[cursor.index_]);
+  }
+
+  pool_pointer getPool();
+  void reserve(size_type count);
+
+  void makeNullRoot();
+  void clear();
+  void printTree() { printTree(root_); }
+  void swapOtherRoot(BTree& other);
+
+ private:
+  Node* newLeaf();
+  InnerNode* newInner();
+  void freeNode(Node* node) noexcept;
+
+  static Node* child(Node* node, size_type index) {
+    return static_cast<InnerNode*>(node)->children_[index];
+  }
+  static void setChild(Node* node, size_type index, Node* newChild);
+  static void insertChild(Node* node, size_type index, Node* newChild);
+  static Node* leftmostLeaf(Node* node);
+  static Node* rightmostLeaf(Node* node);
+  static Cursor ascend(Node* node);
+
+  template <typename K>
+  size_type lowerIndex(Node* node, const K& key) const;
+  template <typename K>
+  size_type upperIndex(Node* node, const K& key) const;
+  template <typename K>
+  Cursor findSlot(const K& key, Cursor& equal) const;
+  template <typename K>
+  Cursor findHintSlot(Cursor hint, const K& key, Cursor& equal) const;
+  Cursor slotBefore(Cursor cursor) const;
+
+  template <typename... Args>
+  Cursor insertAt(Cursor at, Args&&... args);
+  template <typename... Args>
+  static void emplaceSlot(Node* node, size_type index, Args&&... args);
+  static void eraseSlot(Node* node, size_type index);
+  Cursor splitNode(Node* node, size_type index);
+
+  Cursor eraseAt(Cursor cursor);
+  void fixUnderflow(Node* node, Cursor& tracked);
+  void rotateLeft(Node* parent, size_type index, Cursor& tracked);
+  void rotateRight(Node* parent, size_type index, Cursor& tracked);
+  void mergeChildren(Node* parent, size_type index, Cursor& tracked);
+
+  template <typename T1, typename T2>
+  static const T1& keyOf(const std::pair<T1, T2>& value) {
+    return value.first;
+  }
+  static const KeyT& keyOf(const KeyT& key) { return key; }
+  static const KeyT& keyAt(Cursor cursor) {
+    return keyOf(cursor.node_->slots()[cursor.index_]);
+  }
+  static value_type& asValue(slot_type& slot) {
+    return reinterpret_cast<value_type&>(slot);
+  }
+
+  void printTree(Node* node);
+  void deleteTree(Node* node);
+};
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename V>
+std::pair<typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor, bool>
+BTree<KeyT, ValT, multi_type, Compare, Policy>::insert(V&& value) {
+  Cursor equal;
+  Cursor at = findSlot(keyOf(value), equal);
+  if (equal) return std::make_pair(equal, false);
+  return std::make_pair(insertAt(at, std::forward<V>(value)), true);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename V>
+std::pair<typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor, bool>
+BTree<KeyT, ValT, multi_type, Compare, Policy>::insertHint(Cursor hint,
+                                                           V&& value) {
+  Cursor equal;
+  Cursor at = findHintSlot(hint, keyOf(value), equal);
+  if (equal) return std::make_pair(equal, false);
+  return std::make_pair(insertAt(at, std::forward<V>(value)), true);
+}
+
+// The key is only known once the value is built, so it is built up front
+// and moved into its slot
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename... Args>
+std::pair<typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor, bool>
+BTree<KeyT, ValT, multi_type, Compare, Policy>::emplace(Args&&... args) {
+  slot_type value(std::forward<Args>(args)...);
+  Cursor equal;
+  Cursor at = findSlot(keyOf(value), equal);
+  if (equal) return std::make_pair(equal, false);
+  return std::make_pair(insertAt(at, std::move(value)), true);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename... Args>
+std::pair<typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor, bool>
+BTree<KeyT, ValT, multi_type, Compare, Policy>::emplaceHint(Cursor hint,
+                                                            Args&&... args) {
+  slot_type value(std::forward<Args>(args)...);
+  Cursor equal;
+  Cursor at = findHintSlot(hint, keyOf(value), equal);
+  if (equal) return std::make_pair(equal, false);
+  return std::make_pair(insertAt(at, std::move(value)), true);
+}
+
+// Builds the mapped value from args only when key is not in the tree yet
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K, typename... Args>
+std::pair<typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor, bool>
+BTree<KeyT, ValT, multi_type, Compare, Policy>::tryEmplace(K&& key,
+                                                           Args&&... args) {
+  static_assert(!kKeyOnly, "tryEmplace() needs a mapped value");
+  Cursor equal;
+  Cursor at = findSlot(key, equal);
+  if (equal) return std::make_pair(equal, false);
+  return std::make_pair(
+      insertAt(at, std::piecewise_construct,
+               std::forward_as_tuple(std::forward<K>(key)),
+               std::forward_as_tuple(std::forward<Args>(args)...)),
+      true);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::remove(const KeyT& key) {
+  Cursor cursor = search(key);
+  if (cursor) eraseAt(cursor);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::NodeHandle
+BTree<KeyT, ValT, multi_type, Compare, Policy>::extract(Cursor cursor) {
+  NodeHandle handle(std::make_unique<slot_type>(
+      std::move(cursor.node_->slots()[cursor.index_])));
+  eraseAt(cursor);
+  return handle;
+}
+
+// A handle whose key is already in a unique tree is left untouched
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+std::pair<typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor, bool>
+BTree<KeyT, ValT, multi_type, Compare, Policy>::insertHandle(
+    NodeHandle& handle) {
+  if (handle.empty()) return std::make_pair(Cursor(), false);
+
+  Cursor equal;
+  Cursor at = findSlot(handle.key(), equal);
+  if (equal) return std::make_pair(equal, false);
+
+  at = insertAt(at, std::move(*handle.slot_));
+  handle.slot_.reset();
+  return std::make_pair(at, true);
+}
+
+// Moves the elements of other whose keys are not in this tree yet (all of
+// them for multi trees) and returns their number
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+BTree<KeyT, ValT, multi_type, Compare, Policy>::merge(BTree& other) {
+  if (this == &other) return 0;
+
+  size_type count = 0;
+  for (Cursor cursor = other.getMin(); cursor;) {
+    Cursor equal;
+    Cursor at = findSlot(keyAt(cursor), equal);
+    if (equal) {
+      cursor = other.getNext(cursor);
+    } else {
+      insertAt(at, std::move(cursor.node_->slots()[cursor.index_]));
+      cursor = other.eraseAt(cursor);
+      ++count;
+    }
+  }
+  return count;
+}
+
+// Removes the elements in [first, last) one by one and returns their number
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+BTree<KeyT, ValT, multi_type, Compare, Policy>::removeRange(Cursor first,
+                                                            Cursor last,
+                                                            size_type) {
+  size_type count = 0;
+  for (Cursor cursor = first; cursor != last; cursor = getNext(cursor))
+    ++count;
+  for (size_type i = 0; i < count; ++i) first = eraseAt(first);
+  return count;
+}
+
+/*
+  Replaces the content with the elements of a range sorted by key. Each
+  element is appended to the rightmost leaf without a descent, and the
+  splits at the end of a node leave all nodes but the right edge full.
+  Duplicate keys are skipped for unique trees. A range that turns out not
+  to be sorted is inserted element by element instead.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename ForwardIt>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+BTree<KeyT, ValT, multi_type, Compare, Policy>::assignSorted(ForwardIt first,
+                                                             ForwardIt last) {
+  clear();
+
+  size_type count = 0;
+  bool sorted = true;
+  ForwardIt prev = first;
+  for (ForwardIt it = first; it != last && sorted; prev = it++) {
+    if (it != first) {
+      sorted = !compare_(keyOf(*it), keyOf(*prev));
+      if (!multi_type && !compare_(keyOf(*prev), keyOf(*it))) continue;
+    }
+    ++count;
+  }
+
+  if (!sorted) {
+    count = 0;
+    for (; first != last; ++first)
+      if (insert(*first).second) ++count;
+    return count;
+  }
+
+  getPool()->reserve(count / (kSlots - 1) + 1);
+  try {
+    Cursor at;
+    prev = first;
+    for (ForwardIt it = first; it != last; prev = it++) {
+      if (!multi_type && it != first && !compare_(keyOf(*prev), keyOf(*it)))
+        continue;
+      if (at) ++at.index_;
+      at = insertAt(at, *it);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+  return count;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::search(const K& key) const {
+  // Equal keys of a multiset may sit on both sides of the first match
+  if (multi_type) {
+    Cursor cursor = lowerBound(key);
+    return (!cursor || compare_(key, keyAt(cursor))) ? Cursor() : cursor;
+  }
+
+  for (Node* node = root_; node != nullptr;) {
+    size_type index = lowerIndex(node, key);
+    if (index < node->count_ && !compare_(key, keyAt(Cursor{node, index})))
+      return Cursor{node, index};
+    node = node->leaf_ ? nullptr : child(node, index);
+  }
+  return Cursor();
+}
+
+// First element whose key is not less than key, end() if there is none
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::lowerBound(const K& key) const {
+  Cursor bound;
+  for (Node* node = root_; node != nullptr;) {
+    size_type index = lowerIndex(node, key);
+    if (index < node->count_) bound = Cursor{node, index};
+    node = node->leaf_ ? nullptr : child(node, index);
+  }
+  return bound;
+}
+
+// First element whose key is greater than key, end() if there is none
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::upperBound(const K& key) const {
+  Cursor bound;
+  for (Node* node = root_; node != nullptr;) {
+    size_type index = upperIndex(node, key);
+    if (index < node->count_) bound = Cursor{node, index};
+    node = node->leaf_ ? nullptr : child(node, index);
+  }
+  return bound;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::select(size_type) const {
+  static_assert(Policy::order_statistic,
+                "select() needs order_statistic_policy");
+  return Cursor();
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+BTree<KeyT, ValT, multi_type, Compare, Policy>::rank(const KeyT&) const {
+  static_assert(Policy::order_statistic, "rank() needs order_statistic_policy");
+  return 0;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+BTree<KeyT, ValT, multi_type, Compare, Policy>::indexOf(Cursor) const {
+  static_assert(Policy::order_statistic,
+                "indexOf() needs order_statistic_policy");
+  return 0;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::getMin() const {
+  if (root_ == nullptr) return Cursor();
+  return Cursor{leftmostLeaf(root_), 0};
+}
+
+// From an inner node the next element is the first one of the subtree to
+// its right, from the end of a leaf it is the first ancestor reached from
+// the left
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::getNext(Cursor cursor) const {
+  Node* node = cursor.node_;
+  if (node == nullptr) return Cursor();
+  if (!node->leaf_)
+    return Cursor{leftmostLeaf(child(node, cursor.index_ + 1)), 0};
+  if (cursor.index_ + 1 < node->count_)
+    return Cursor{node, cursor.index_ + 1};
+  return ascend(node);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::getPrev(Cursor cursor) const {
+  Node* node = cursor.node_;
+  if (node == nullptr) {
+    if (root_ == nullptr) return Cursor();
+    node = rightmostLeaf(root_);
+    return Cursor{node, node->count_ - size_type(1)};
+  }
+  if (!node->leaf_) {
+    node = rightmostLeaf(child(node, cursor.index_));
+    return Cursor{node, node->count_ - size_type(1)};
+  }
+  if (cursor.index_ > 0) return Cursor{node, cursor.index_ - 1};
+
+  while (node->parent_ != nullptr && node->position_ == 0)
+    node = node->parent_;
+  if (node->parent_ == nullptr) return Cursor();
+  return Cursor{node->parent_, node->position_ - size_type(1)};
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::pool_pointer
+BTree<KeyT, ValT, multi_type, Compare, Policy>::getPool() {
+  if (!pool_) pool_ = std::make_shared<pool_type>();
+  return pool_;
+}
+
+// Reserves the leaves count more elements may need in any order: every
+// leaf but the root holds at least kMinSlots of them
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::reserve(size_type count) {
+  getPool()->reserve(count / kMinSlots + 1);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::makeNullRoot() {
+  root_ = nullptr;
+  pool_.reset();
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::clear() {
+  deleteTree(root_);
+  root_ = nullptr;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::swapOtherRoot(
+    BTree& other) {
+  std::swap(root_, other.root_);
+  std::swap(pool_, other.pool_);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+BTree<KeyT, ValT, multi_type, Compare, Policy>::newLeaf() {
+  return new (getPool()->allocate()) Node();
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::InnerNode*
+BTree<KeyT, ValT, multi_type, Compare, Policy>::newInner() {
+  InnerNode* node = new InnerNode();
+  node->leaf_ = false;
+  return node;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::freeNode(
+    Node* node) noexcept {
+  if (node->leaf_) {
+    node->~Node();
+    pool_->deallocate(node);
+  } else {
+    delete static_cast<InnerNode*>(node);
+  }
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::setChild(Node* node,
+                                                              size_type index,
+                                                              Node* newChild) {
+  static_cast<InnerNode*>(node)->children_[index] = newChild;
+  newChild->parent_ = static_cast<InnerNode*>(node);
+  newChild->position_ = static_cast<std::uint16_t>(index);
+}
+
+// Puts newChild at index, node already counting the element next to it
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::insertChild(
+    Node* node, size_type index, Node* newChild) {
+  for (size_type i = node->count_; i > index; --i)
+    setChild(node, i, child(node, i - 1));
+  setChild(node, index, newChild);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+BTree<KeyT, ValT, multi_type, Compare, Policy>::leftmostLeaf(Node* node) {
+  while (!node->leaf_) node = child(node, 0);
+  return node;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+BTree<KeyT, ValT, multi_type, Compare, Policy>::rightmostLeaf(Node* node) {
+  while (!node->leaf_) node = child(node, node->count_);
+  return node;
+}
+
+// The element right after the last one of node's subtree, end() if none
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::ascend(Node* node) {
+  while (node->parent_ != nullptr && node->position_ == node->parent_->count_)
+    node = node->parent_;
+  if (node->parent_ == nullptr) return Cursor();
+  return Cursor{node->parent_, node->position_};
+}
+
+// Index of the first element of node not less than key
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+BTree<KeyT, ValT, multi_type, Compare, Policy>::lowerIndex(
+    Node* node, const K& key) const {
+  size_type low = 0;
+  size_type high = node->count_;
+  slot_type* slots = node->slots();
+  while (low < high) {
+    size_type middle = (low + high) / 2;
+    if (compare_(keyOf(slots[middle]), key))
+      low = middle + 1;
+    else
+      high = middle;
+  }
+  return low;
+}
+
+// Index of the first element of node greater than key
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+BTree<KeyT, ValT, multi_type, Compare, Policy>::upperIndex(
+    Node* node, const K& key) const {
+  size_type low = 0;
+  size_type high = node->count_;
+  slot_type* slots = node->slots();
+  while (low < high) {
+    size_type middle = (low + high) / 2;
+    if (compare_(key, keyOf(slots[middle])))
+      high = middle;
+    else
+      low = middle + 1;
+  }
+  return low;
+}
+
+/*
+  Finds the leaf slot for key: new equal keys of multi trees go after the
+  old ones. For unique trees equal is set to the element already holding
+  key, which may sit in an inner node, or to end() when there is none. An
+  empty tree gives end() as the slot.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::findSlot(const K& key,
+                                                         Cursor& equal) const {
+  equal = Cursor();
+  if (root_ == nullptr) return Cursor();
+
+  Node* node = root_;
+  while (true) {
+    size_type index =
+        multi_type ? upperIndex(node, key) : lowerIndex(node, key);
+    if (!multi_type && index < node->count_ &&
+        !compare_(key, keyAt(Cursor{node, index}))) {
+      equal = Cursor{node, index};
+      return equal;
+    }
+    if (node->leaf_) return Cursor{node, index};
+    node = child(node, index);
+  }
+}
+
+/*
+  Slot lookup next to a known position. When key fits right before hint
+  (or after the greatest key for the end() hint) the slot is taken there
+  without descending from the root. Any other hint falls back to a regular
+  descent.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::findHintSlot(
+    Cursor hint, const K& key, Cursor& equal) const {
+  equal = Cursor();
+  Cursor prev = getPrev(hint);
+  bool afterPrev = !prev || (multi_type ? !compare_(key, keyAt(prev))
+                                        : compare_(keyAt(prev), key));
+  bool beforeHint = !hint || (multi_type ? !compare_(keyAt(hint), key)
+                                         : compare_(key, keyAt(hint)));
+  if (afterPrev && beforeHint) return slotBefore(hint);
+  return findSlot(key, equal);
+}
+
+// The leaf slot right before cursor
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::slotBefore(
+    Cursor cursor) const {
+  if (cursor && cursor.node_->leaf_) return cursor;
+  if (root_ == nullptr) return Cursor();
+
+  Node* leaf = rightmostLeaf(cursor ? child(cursor.node_, cursor.index_)
+                                    : root_);
+  return Cursor{leaf, leaf->count_};
+}
+
+/*
+  Puts a new element built from args into the leaf slot at, or into a new
+  root when the tree is empty, and returns its position. A full leaf is
+  split first. The element is built before that,
+  as args may refer to an element the split moves.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename... Args>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::insertAt(Cursor at,
+                                                         Args&&... args) {
+  if (!at) {
+    root_ = newLeaf();
+    at = Cursor{root_, 0};
+  }
+  if (at.node_->count_ < kSlots) {
+    emplaceSlot(at.node_, at.index_, std::forward<Args>(args)...);
+    return at;
+  }
+
+  slot_type value(std::forward<Args>(args)...);
+  at = splitNode(at.node_, at.index_);
+  emplaceSlot(at.node_, at.index_, std::move(value));
+  return at;
+}
+
+// Puts an element built from args at index of a node that is not full
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename... Args>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::emplaceSlot(
+    Node* node, size_type index, Args&&... args) {
+  slot_type* slots = node->slots();
+  size_type count = node->count_;
+  if (index == count) {
+    new (slots + count) slot_type(std::forward<Args>(args)...);
+  } else {
+    slot_type value(std::forward<Args>(args)...);
+    new (slots + count) slot_type(std::move(slots[count - 1]));
+    std::move_backward(slots + index, slots + count - 1, slots + count);
+    slots[index] = std::move(value);
+  }
+  ++node->count_;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::eraseSlot(
+    Node* node, size_type index) {
+  slot_type* slots = node->slots();
+  std::move(slots + index + 1, slots + node->count_, slots + index);
+  slots[--node->count_].~slot_type();
+}
+
+/*
+  Splits the full node so that the slot at index gets room and returns
+  where that slot ends up. The median element goes up into the parent,
+  which is split first when it is full as well, and the elements after it
+  go to a new right sibling. A split for a slot at the very end or start
+  moves up the last or the first element instead of the median.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::splitNode(Node* node,
+                                                          size_type index) {
+  if (node == root_) {
+    InnerNode* root = newInner();
+    setChild(root, 0, node);
+    root_ = root;
+  }
+  Node* parent = node->parent_;
+  if (parent->count_ == kSlots) splitNode(parent, node->position_);
+  parent = node->parent_;
+  size_type position = node->position_;
+
+  size_type count = node->count_;
+  size_type middle =
+      (index == count) ? count - 1 : (index == 0) ? 0 : count / 2;
+  Node* sibling = node->leaf_ ? newLeaf() : newInner();
+  slot_type* slots = node->slots();
+  for (size_type i = middle + 1; i < count; ++i) {
+    new (sibling->slots() + i - middle - 1) slot_type(std::move(slots[i]));
+    slots[i].~slot_type();
+  }
+  sibling->count_ = static_cast<std::uint16_t>(count - middle - 1);
+  if (!node->leaf_)
+    for (size_type i = middle + 1; i <= count; ++i)
+      setChild(sibling, i - middle - 1, child(node, i));
+
+  emplaceSlot(parent, position, std::move(slots[middle]));
+  slots[middle].~slot_type();
+  node->count_ = static_cast<std::uint16_t>(middle);
+  insertChild(parent, position + 1, sibling);
+
+  if (index <= middle) return Cursor{node, index};
+  return Cursor{sibling, index - middle - 1};
+}
+
+/*
+  Removes the element at cursor and returns the position of the one after
+  it. An element of an inner node is replaced by its successor, the first
+  element of the leftmost leaf to its right, so the removal always takes a
+  slot of a leaf.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename BTree<KeyT, ValT, multi_type, Compare, Policy>::Cursor
+BTree<KeyT, ValT, multi_type, Compare, Policy>::eraseAt(Cursor cursor) {
+  Node* node = cursor.node_;
+  Cursor next = cursor;
+  if (!node->leaf_) {
+    Node* leaf = leftmostLeaf(child(node, cursor.index_ + 1));
+    node->slots()[cursor.index_] = std::move(leaf->slots()[0]);
+    node = leaf;
+    eraseSlot(node, 0);
+  } else {
+    eraseSlot(node, cursor.index_);
+  }
+
+  fixUnderflow(node, next);
+  if (next && next.index_ == next.node_->count_) next = ascend(next.node_);
+  return next;
+}
+
+/*
+  Refills a node left with too few elements from its parent upwards: the
+  node is merged with a sibling when both fit into one node, otherwise it
+  borrows one element from that sibling through the parent. An emptied
+  root gives its place to its only child. tracked follows the element it
+  points to through the moves.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::fixUnderflow(
+    Node* node, Cursor& tracked) {
+  while (node != root_ && node->count_ < kMinSlots) {
+    Node* parent = node->parent_;
+    size_type index = node->position_ > 0 ? node->position_ - 1 : 0;
+    Node* left = child(parent, index);
+    Node* right = child(parent, index + 1);
+    if (left->count_ + right->count_ < kSlots) {
+      mergeChildren(parent, index, tracked);
+      node = parent;
+    } else {
+      if (node == right)
+        rotateRight(parent, index, tracked);
+      else
+        rotateLeft(parent, index, tracked);
+      break;
+    }
+  }
+
+  if (root_->count_ == 0) {
+    Node* root = root_;
+    if (root->leaf_) {
+      root_ = nullptr;
+      tracked = Cursor();
+    } else {
+      root_ = child(root, 0);
+      root_->parent_ = nullptr;
+      root_->position_ = 0;
+    }
+    freeNode(root);
+  }
+}
+
+// Moves the first element of child index + 1 up to the parent and the
+// element at index of the parent down to the end of child index
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::rotateLeft(
+    Node* parent, size_type index, Cursor& tracked) {
+  Node* left = child(parent, index);
+  Node* right = child(parent, index + 1);
+  if (tracked == Cursor{parent, index})
+    tracked = Cursor{left, left->count_};
+  else if (tracked == Cursor{right, 0})
+    tracked = Cursor{parent, index};
+  else if (tracked.node_ == right)
+    --tracked.index_;
+
+  emplaceSlot(left, left->count_, std::move(parent->slots()[index]));
+  parent->slots()[index] = std::move(right->slots()[0]);
+  if (!left->leaf_) {
+    setChild(left, left->count_, child(right, 0));
+    for (size_type i = 0; i < right->count_; ++i)
+      setChild(right, i, child(right, i + 1));
+  }
+  eraseSlot(right, 0);
+}
+
+// Moves the last element of child index up to the parent and the element
+// at index of the parent down to the start of child index + 1
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::rotateRight(
+    Node* parent, size_type index, Cursor& tracked) {
+  Node* left = child(parent, index);
+  Node* right = child(parent, index + 1);
+  size_type last = left->count_ - 1;
+  if (tracked.node_ == right)
+    ++tracked.index_;
+  else if (tracked == Cursor{parent, index})
+    tracked = Cursor{right, 0};
+  else if (tracked == Cursor{left, last})
+    tracked = Cursor{parent, index};
+
+  emplaceSlot(right, 0, std::move(parent->slots()[index]));
+  parent->slots()[index] = std::move(left->slots()[last]);
+  if (!right->leaf_) {
+    for (size_type i = right->count_; i > 0; --i)
+      setChild(right, i, child(right, i - 1));
+    setChild(right, 0, child(left, left->count_));
+  }
+  eraseSlot(left, last);
+}
+
+// Joins child index, the element at index of the parent and child
+// index + 1 into child index and frees the emptied right child
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::mergeChildren(
+    Node* parent, size_type index, Cursor& tracked) {
+  Node* left = child(parent, index);
+  Node* right = child(parent, index + 1);
+  size_type offset = left->count_ + size_type(1);
+  if (tracked == Cursor{parent, index})
+    tracked = Cursor{left, left->count_};
+  else if (tracked.node_ == right)
+    tracked = Cursor{left, offset + tracked.index_};
+  else if (tracked.node_ == parent && tracked.index_ > index)
+    --tracked.index_;
+
+  slot_type* slots = left->slots();
+  new (slots + left->count_) slot_type(std::move(parent->slots()[index]));
+  for (size_type i = 0; i < right->count_; ++i) {
+    new (slots + offset + i) slot_type(std::move(right->slots()[i]));
+    right->slots()[i].~slot_type();
+  }
+  if (!left->leaf_)
+    for (size_type i = 0; i <= right->count_; ++i)
+      setChild(left, offset + i, child(right, i));
+  left->count_ = static_cast<std::uint16_t>(offset + right->count_);
+  freeNode(right);
+
+  eraseSlot(parent, index);
+  for (size_type i = index + 1; i <= parent->count_; ++i)
+    setChild(parent, i, child(parent, i + 1));
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::printTree(Node* node) {
+  if (node == nullptr) return;
+
+  for (size_type i = 0; i < node->count_; ++i) {
+    if (!node->leaf_) printTree(child(node, i));
+    std::cout << keyAt(Cursor{node, i}) << ' ';
+  }
+  if (!node->leaf_) printTree(child(node, node->count_));
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void BTree<KeyT, ValT, multi_type, Compare, Policy>::deleteTree(Node* node) {
+  if (node == nullptr) return;
+
+  if (!node->leaf_)
+    for (size_type i = 0; i <= node->count_; ++i) deleteTree(child(node, i));
+  for (size_type i = 0; i < node->count_; ++i) node->slots()[i].~slot_type();
+  freeNode(node);
+}
+
+// Engine of the tree based containers: BTree for policies that name a node
+// size, RBTree for the others
+template <typename Policy, typename = void>
+struct uses_btree : std::false_type {};
+template <typename Policy>
+struct uses_btree<Policy, std::void_t<decltype(Policy::node_bytes)>>
+    : std::true_type {};
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+using tree_engine_t =
+    std::conditional_t<uses_btree<Policy>::value,
+                       BTree<KeyT, ValT, multi_type, Compare, Policy>,
+                       RBTree<KeyT, ValT, multi_type, Compare, Policy>>;
+
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_BTREE_H_
@@ -0,0 +1,417 @@
+#ifndef SRC_CORE_S21_FLAT_MAP_H_
+#define SRC_CORE_S21_FLAT_MAP_H_
+
+#include <limits>
+#include <type_traits>
+
+#include "s21_container.h"
+#include "s21_flat_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+  Map with unique keys stored sorted in one s21::vector.
+
+  Lookups are binary searches over contiguous memory and iterators are
+  plain pointers, so reading is cheaper than with s21::map. Every insert or
+  erase of a single key moves the pairs behind it, and invalidates all
+  iterators: fill the map from a range, with insert_many() or by merge()
+  when there is more than a few keys to add.
+
+  The pairs are moved around on updates, so value_type is
+  std::pair<key_type, mapped_type> with a non-const key, which must not be
+  changed through an iterator.
+*/
+template <typename KeyT, typename ValT, typename Compare = std::less<KeyT>>
+class flat_map : public IContainer {
+ public:
+  using key_type = KeyT;
+  using mapped_type = ValT;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = value_type*;
+  using const_iterator = const value_type*;
+  using typename IContainer::size_type;
+  using key_compare = Compare;
+  using tree_type = FlatTree<KeyT, ValT, Compare>;
+
+ public:
+  flat_map();
+  flat_map(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last);
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last, sorted_tag_t);
+  flat_map(const flat_map& other);
+  flat_map(flat_map&& other) noexcept;
+  ~flat_map(){};
+
+  flat_map& operator=(const flat_map& other);
+  flat_map& operator=(flat_map&& other);
+  mapped_type& at(const key_type& key);
+  const mapped_type& at(const key_type& key) const;
+  mapped_type& operator[](const key_type& key);
+  mapped_type& operator[](key_type&& key);
+
+  bool operator==(const flat_map& other) const;
+  bool operator!=(const flat_map& other) const;
+
+  iterator begin() { return tree_.begin(); }
+  const_iterator begin() const { return tree_.begin(); }
+  iterator end() { return tree_.end(); }
+  const_iterator end() const { return tree_.end(); }
+
+  bool empty() const noexcept override { return tree_.isEmpty(); }
+  size_type size() const noexcept override { return tree_.size(); }
+  static size_type max_size();
+  size_type capacity() const noexcept { return tree_.capacity(); }
+  void reserve(size_type count) { tree_.reserve(count); }
+  void shrink_to_fit() { tree_.shrinkToFit(); }
+  key_compare key_comp() const { return tree_.keyComp(); }
+
+  void clear();
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last, sorted_tag_t);
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
+  iterator insert(const_iterator hint, const value_type& value);
+  iterator insert(const_iterator hint, value_type&& value);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args);
+  std::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                             const mapped_type& obj);
+
+  iterator erase(const_iterator pos);
+  void swap(flat_map& other);
+  void merge(flat_map& other);
+  iterator find(const key_type& key);
+  const_iterator find(const key_type& key) const;
+  bool contains(const key_type& key) const;
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  bool contains(const K& key) const;
+
+  iterator lower_bound(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  iterator lower_bound(const K& key);
+  iterator upper_bound(const key_type& key);
+  std::pair<iterator, iterator> equal_range(const key_type& key);
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+ private:
+  tree_type tree_;
+
+ private:
+  static iterator mutablePos(const_iterator pos) {
+    return const_cast<iterator>(pos);
+  }
+};
+
+template <typename key_type, typename mapped_type, typename compare_type>
+bool flat_map<key_type, mapped_type, compare_type>::operator==(
+    const flat_map<key_type, mapped_type, compare_type>& other) const {
+  if (this == &other) return true;
+  if (size() != other.size()) return false;
+
+  return (std::equal(begin(), end(), other.begin()));
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+bool flat_map<key_type, mapped_type, compare_type>::operator!=(
+    const flat_map<key_type, mapped_type, compare_type>& other) const {
+  return !(*this == other);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+typename flat_map<key_type, mapped_type, compare_type>::size_type
+flat_map<key_type, mapped_type, compare_type>::max_size() {
+  return vector<value_type>::max_size();
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+flat_map<key_type, mapped_type, compare_type>::flat_map() : tree_() {}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+flat_map<key_type, mapped_type, compare_type>::flat_map(
+    std::initializer_list<value_type> const& items)
+    : tree_() {
+  tree_.reserve(items.size());
+  tree_.insertBatch(items.begin(), items.end());
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename InputIt>
+flat_map<key_type, mapped_type, compare_type>::flat_map(InputIt first,
+                                                        InputIt last)
+    : tree_() {
+  tree_.insertBatch(first, last);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename InputIt>
+flat_map<key_type, mapped_type, compare_type>::flat_map(InputIt first,
+                                                        InputIt last,
+                                                        sorted_tag_t)
+    : tree_() {
+  tree_.assignSorted(first, last);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+flat_map<key_type, mapped_type, compare_type>::flat_map(const flat_map& other)
+    : tree_(other.tree_) {}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+flat_map<key_type, mapped_type, compare_type>::flat_map(
+    flat_map&& other) noexcept
+    : tree_(std::move(other.tree_)) {}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+flat_map<key_type, mapped_type, compare_type>&
+flat_map<key_type, mapped_type, compare_type>::operator=(
+    const flat_map& other) {
+  tree_ = other.tree_;
+  return *this;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+flat_map<key_type, mapped_type, compare_type>&
+flat_map<key_type, mapped_type, compare_type>::operator=(flat_map&& other) {
+  if (this != &other) tree_ = std::move(other.tree_);
+  return *this;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+mapped_type& flat_map<key_type, mapped_type, compare_type>::at(
+    const key_type& key) {
+  iterator temp = tree_.search(key);
+  if (temp == nullptr)
+    throw std::out_of_range("Element with the current key was not found!");
+  else
+    return temp->second;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+const mapped_type& flat_map<key_type, mapped_type, compare_type>::at(
+    const key_type& key) const {
+  const_iterator temp = tree_.search(key);
+  if (temp == nullptr)
+    throw std::out_of_range("Element with the current key was not found!");
+  else
+    return temp->second;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+mapped_type& flat_map<key_type, mapped_type, compare_type>::operator[](
+    const key_type& key) {
+  return try_emplace(key).first->second;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+mapped_type& flat_map<key_type, mapped_type, compare_type>::operator[](
+    key_type&& key) {
+  return try_emplace(std::move(key)).first->second;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+void flat_map<key_type, mapped_type, compare_type>::clear() {
+  tree_.clear();
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename InputIt>
+void flat_map<key_type, mapped_type, compare_type>::assign(InputIt first,
+                                                           InputIt last,
+                                                           sorted_tag_t) {
+  tree_.assignSorted(first, last);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+          bool>
+flat_map<key_type, mapped_type, compare_type>::insert(const value_type& value) {
+  return tree_.insert(value);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+          bool>
+flat_map<key_type, mapped_type, compare_type>::insert(value_type&& value) {
+  return tree_.insert(std::move(value));
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+          bool>
+flat_map<key_type, mapped_type, compare_type>::insert(const key_type& key,
+                                                      const mapped_type& obj) {
+  return try_emplace(key, obj);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+          bool>
+flat_map<key_type, mapped_type, compare_type>::insert_or_assign(
+    const key_type& key, const mapped_type& obj) {
+  std::pair<iterator, bool> temp = try_emplace(key, obj);
+  if (!temp.second) temp.first->second = obj;
+  return temp;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+typename flat_map<key_type, mapped_type, compare_type>::iterator
+flat_map<key_type, mapped_type, compare_type>::insert(const_iterator hint,
+                                                      const value_type& value) {
+  return tree_.insertHint(mutablePos(hint), value).first;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+typename flat_map<key_type, mapped_type, compare_type>::iterator
+flat_map<key_type, mapped_type, compare_type>::insert(const_iterator hint,
+                                                      value_type&& value) {
+  return tree_.insertHint(mutablePos(hint), std::move(value)).first;
+}
+
+// The pairs are sorted apart and merged in, instead of inserted one by one
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename InputIt>
+void flat_map<key_type, mapped_type, compare_type>::insert(InputIt first,
+                                                           InputIt last) {
+  tree_.insertBatch(first, last);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename... Args>
+std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+          bool>
+flat_map<key_type, mapped_type, compare_type>::emplace(Args&&... args) {
+  return tree_.insert(value_type(std::forward<Args>(args)...));
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename... Args>
+typename flat_map<key_type, mapped_type, compare_type>::iterator
+flat_map<key_type, mapped_type, compare_type>::emplace_hint(
+    const_iterator hint, Args&&... args) {
+  return tree_
+      .insertHint(mutablePos(hint), value_type(std::forward<Args>(args)...))
+      .first;
+}
+
+// Unlike emplace(), leaves args untouched when key is already in the map
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename... Args>
+std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+          bool>
+flat_map<key_type, mapped_type, compare_type>::try_emplace(
+    const key_type& key, Args&&... args) {
+  return tree_.tryEmplace(key, std::forward<Args>(args)...);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename... Args>
+std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+          bool>
+flat_map<key_type, mapped_type, compare_type>::try_emplace(key_type&& key,
+                                                           Args&&... args) {
+  return tree_.tryEmplace(std::move(key), std::forward<Args>(args)...);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+typename flat_map<key_type, mapped_type, compare_type>::iterator
+flat_map<key_type, mapped_type, compare_type>::erase(const_iterator pos) {
+  return tree_.erase(mutablePos(pos));
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+void flat_map<key_type, mapped_type, compare_type>::swap(flat_map& other) {
+  tree_.swap(other.tree_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+void flat_map<key_type, mapped_type, compare_type>::merge(flat_map& other) {
+  tree_.merge(other.tree_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+typename flat_map<key_type, mapped_type, compare_type>::iterator
+flat_map<key_type, mapped_type, compare_type>::find(const key_type& key) {
+  iterator temp = tree_.search(key);
+  return (!temp) ? end() : temp;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+typename flat_map<key_type, mapped_type, compare_type>::const_iterator
+flat_map<key_type, mapped_type, compare_type>::find(
+    const key_type& key) const {
+  const_iterator temp = tree_.search(key);
+  return (!temp) ? end() : temp;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+bool flat_map<key_type, mapped_type, compare_type>::contains(
+    const key_type& key) const {
+  return tree_.search(key) != nullptr;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename K, typename>
+bool flat_map<key_type, mapped_type, compare_type>::contains(
+    const K& key) const {
+  return tree_.search(key) != nullptr;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+typename flat_map<key_type, mapped_type, compare_type>::iterator
+flat_map<key_type, mapped_type, compare_type>::lower_bound(
+    const key_type& key) {
+  return tree_.lowerBound(key);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename K, typename>
+typename flat_map<key_type, mapped_type, compare_type>::iterator
+flat_map<key_type, mapped_type, compare_type>::lower_bound(const K& key) {
+  return tree_.lowerBound(key);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+typename flat_map<key_type, mapped_type, compare_type>::iterator
+flat_map<key_type, mapped_type, compare_type>::upper_bound(
+    const key_type& key) {
+  return tree_.upperBound(key);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+          typename flat_map<key_type, mapped_type, compare_type>::iterator>
+flat_map<key_type, mapped_type, compare_type>::equal_range(
+    const key_type& key) {
+  return tree_.equalRange(key);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type>
+template <typename... Args>
+vector<
+    std::pair<typename flat_map<key_type, mapped_type, compare_type>::iterator,
+              bool>>
+flat_map<key_type, mapped_type, compare_type>::insert_many(Args&&... args) {
+  vector<value_type> items;
+  items.reserve(sizeof...(Args));
+  (items.push_back(value_type(std::forward<Args>(args))), ...);
+  return tree_.template insertMany<iterator>(items);
+}
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_FLAT_MAP_H_
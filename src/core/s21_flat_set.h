@@ -0,0 +1,315 @@
+#ifndef SRC_CORE_S21_FLAT_SET_H_
+#define SRC_CORE_S21_FLAT_SET_H_
+
+#include <limits>
+#include <type_traits>
+
+#include "s21_container.h"
+#include "s21_flat_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+  Set of unique keys stored sorted in one s21::vector.
+
+  Lookups are binary searches over contiguous memory and iterators are
+  plain pointers, so reading is cheaper than with s21::set. Every insert or
+  erase of a single key moves the keys behind it, and invalidates all
+  iterators: fill the set from a range, with insert_many() or by merge()
+  when there is more than a few keys to add.
+*/
+template <typename KeyT, typename Compare = std::less<KeyT>>
+class flat_set : public IContainer {
+ public:
+  using key_type = KeyT;
+  using value_type = KeyT;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = const value_type*;
+  using const_iterator = const value_type*;
+  using typename IContainer::size_type;
+  using key_compare = Compare;
+  using tree_type = FlatTree<KeyT, void, Compare>;
+
+ public:
+  flat_set();
+  flat_set(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last);
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last, sorted_tag_t);
+  flat_set(const flat_set& other);
+  flat_set(flat_set&& other) noexcept;
+  ~flat_set(){};
+
+  flat_set& operator=(const flat_set& other);
+  flat_set& operator=(flat_set&& other);
+
+  bool operator==(const flat_set& other) const;
+  bool operator!=(const flat_set& other) const;
+
+  iterator begin() const { return tree_.begin(); }
+  iterator end() const { return tree_.end(); }
+
+  bool empty() const noexcept override { return tree_.isEmpty(); }
+  size_type size() const noexcept override { return tree_.size(); }
+  static size_type max_size();
+  size_type capacity() const noexcept { return tree_.capacity(); }
+  void reserve(size_type count) { tree_.reserve(count); }
+  void shrink_to_fit() { tree_.shrinkToFit(); }
+  key_compare key_comp() const { return tree_.keyComp(); }
+
+  void clear();
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last, sorted_tag_t);
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  iterator insert(const_iterator hint, const value_type& value);
+  iterator insert(const_iterator hint, value_type&& value);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
+
+  iterator erase(const_iterator pos);
+  void swap(flat_set& other);
+  void merge(flat_set& other);
+  iterator find(const key_type& key) const;
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  iterator find(const K& key) const;
+  bool contains(const key_type& key) const;
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  bool contains(const K& key) const;
+
+  iterator lower_bound(const key_type& key) const;
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  iterator lower_bound(const K& key) const;
+  iterator upper_bound(const key_type& key) const;
+  std::pair<iterator, iterator> equal_range(const key_type& key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+ private:
+  tree_type tree_;
+
+ private:
+  static typename tree_type::value_type* mutablePos(const_iterator pos) {
+    return const_cast<typename tree_type::value_type*>(pos);
+  }
+};
+
+template <typename key_type, typename compare_type>
+bool flat_set<key_type, compare_type>::operator==(
+    const flat_set<key_type, compare_type>& other) const {
+  if (this == &other) return true;
+  if (size() != other.size()) return false;
+
+  return (std::equal(begin(), end(), other.begin()));
+}
+
+template <typename key_type, typename compare_type>
+bool flat_set<key_type, compare_type>::operator!=(
+    const flat_set<key_type, compare_type>& other) const {
+  return !(*this == other);
+}
+
+template <typename key_type, typename compare_type>
+typename flat_set<key_type, compare_type>::size_type
+flat_set<key_type, compare_type>::max_size() {
+  return vector<value_type>::max_size();
+}
+
+template <typename key_type, typename compare_type>
+flat_set<key_type, compare_type>::flat_set() : tree_() {}
+
+template <typename key_type, typename compare_type>
+flat_set<key_type, compare_type>::flat_set(
+    std::initializer_list<value_type> const& items)
+    : tree_() {
+  tree_.reserve(items.size());
+  tree_.insertBatch(items.begin(), items.end());
+}
+
+template <typename key_type, typename compare_type>
+template <typename InputIt>
+flat_set<key_type, compare_type>::flat_set(InputIt first, InputIt last)
+    : tree_() {
+  tree_.insertBatch(first, last);
+}
+
+template <typename key_type, typename compare_type>
+template <typename InputIt>
+flat_set<key_type, compare_type>::flat_set(InputIt first, InputIt last,
+                                           sorted_tag_t)
+    : tree_() {
+  tree_.assignSorted(first, last);
+}
+
+template <typename key_type, typename compare_type>
+flat_set<key_type, compare_type>::flat_set(const flat_set& other)
+    : tree_(other.tree_) {}
+
+template <typename key_type, typename compare_type>
+flat_set<key_type, compare_type>::flat_set(flat_set&& other) noexcept
+    : tree_(std::move(other.tree_)) {}
+
+template <typename key_type, typename compare_type>
+flat_set<key_type, compare_type>& flat_set<key_type, compare_type>::operator=(
+    const flat_set& other) {
+  tree_ = other.tree_;
+  return *this;
+}
+
+template <typename key_type, typename compare_type>
+flat_set<key_type, compare_type>& flat_set<key_type, compare_type>::operator=(
+    flat_set&& other) {
+  if (this != &other) tree_ = std::move(other.tree_);
+  return *this;
+}
+
+template <typename key_type, typename compare_type>
+void flat_set<key_type, compare_type>::clear() {
+  tree_.clear();
+}
+
+template <typename key_type, typename compare_type>
+template <typename InputIt>
+void flat_set<key_type, compare_type>::assign(InputIt first, InputIt last,
+                                              sorted_tag_t) {
+  tree_.assignSorted(first, last);
+}
+
+template <typename key_type, typename compare_type>
+std::pair<typename flat_set<key_type, compare_type>::iterator, bool>
+flat_set<key_type, compare_type>::insert(const value_type& value) {
+  return tree_.insert(value);
+}
+
+template <typename key_type, typename compare_type>
+std::pair<typename flat_set<key_type, compare_type>::iterator, bool>
+flat_set<key_type, compare_type>::insert(value_type&& value) {
+  return tree_.insert(std::move(value));
+}
+
+template <typename key_type, typename compare_type>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::insert(const_iterator hint,
+                                         const value_type& value) {
+  return tree_.insertHint(mutablePos(hint), value).first;
+}
+
+template <typename key_type, typename compare_type>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::insert(const_iterator hint,
+                                         value_type&& value) {
+  return tree_.insertHint(mutablePos(hint), std::move(value)).first;
+}
+
+// The keys are sorted apart and merged in, instead of inserted one by one
+template <typename key_type, typename compare_type>
+template <typename InputIt>
+void flat_set<key_type, compare_type>::insert(InputIt first, InputIt last) {
+  tree_.insertBatch(first, last);
+}
+
+template <typename key_type, typename compare_type>
+template <typename... Args>
+std::pair<typename flat_set<key_type, compare_type>::iterator, bool>
+flat_set<key_type, compare_type>::emplace(Args&&... args) {
+  return tree_.insert(value_type(std::forward<Args>(args)...));
+}
+
+template <typename key_type, typename compare_type>
+template <typename... Args>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::emplace_hint(const_iterator hint,
+                                               Args&&... args) {
+  return tree_
+      .insertHint(mutablePos(hint), value_type(std::forward<Args>(args)...))
+      .first;
+}
+
+template <typename key_type, typename compare_type>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::erase(const_iterator pos) {
+  return tree_.erase(mutablePos(pos));
+}
+
+template <typename key_type, typename compare_type>
+void flat_set<key_type, compare_type>::swap(flat_set& other) {
+  tree_.swap(other.tree_);
+}
+
+template <typename key_type, typename compare_type>
+void flat_set<key_type, compare_type>::merge(flat_set& other) {
+  tree_.merge(other.tree_);
+}
+
+template <typename key_type, typename compare_type>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::find(const key_type& key) const {
+  iterator temp = tree_.search(key);
+  return (!temp) ? end() : temp;
+}
+
+template <typename key_type, typename compare_type>
+template <typename K, typename>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::find(const K& key) const {
+  iterator temp = tree_.search(key);
+  return (!temp) ? end() : temp;
+}
+
+template <typename key_type, typename compare_type>
+bool flat_set<key_type, compare_type>::contains(const key_type& key) const {
+  return tree_.search(key) != nullptr;
+}
+
+template <typename key_type, typename compare_type>
+template <typename K, typename>
+bool flat_set<key_type, compare_type>::contains(const K& key) const {
+  return tree_.search(key) != nullptr;
+}
+
+template <typename key_type, typename compare_type>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::lower_bound(const key_type& key) const {
+  return tree_.lowerBound(key);
+}
+
+template <typename key_type, typename compare_type>
+template <typename K, typename>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::lower_bound(const K& key) const {
+  return tree_.lowerBound(key);
+}
+
+template <typename key_type, typename compare_type>
+typename flat_set<key_type, compare_type>::iterator
+flat_set<key_type, compare_type>::upper_bound(const key_type& key) const {
+  return tree_.upperBound(key);
+}
+
+template <typename key_type, typename compare_type>
+std::pair<typename flat_set<key_type, compare_type>::iterator,
+          typename flat_set<key_type, compare_type>::iterator>
+flat_set<key_type, compare_type>::equal_range(const key_type& key) const {
+  return tree_.equalRange(key);
+}
+
+template <typename key_type, typename compare_type>
+template <typename... Args>
+vector<std::pair<typename flat_set<key_type, compare_type>::iterator, bool>>
+flat_set<key_type, compare_type>::insert_many(Args&&... args) {
+  vector<value_type> items;
+  items.reserve(sizeof...(Args));
+  (items.push_back(value_type(std::forward<Args>(args))), ...);
+  return tree_.template insertMany<iterator>(items);
+}
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_FLAT_SET_H_
@@ -0,0 +1,332 @@
+#ifndef SRC_CORE_S21_FLAT_TREE_H_
+#define SRC_CORE_S21_FLAT_TREE_H_
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_rbtree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+  Sorted vector of unique keys behind flat_set and flat_map.
+
+  The values sit contiguous in key order, so a lookup is a binary search
+  over one block of memory and a scan is a plain walk over it. The price
+  is paid on updates: a single insert or erase shifts every value behind
+  its position. Ranges of new values are therefore appended, sorted and
+  merged into place in one pass, which costs O(n + k log k) for k values.
+
+  A void ValT makes the values bare keys. Otherwise they are
+  std::pair<KeyT, ValT>: the key can't be const, as values are moved
+  around on every update.
+*/
+template <typename KeyT, typename ValT, typename Compare = std::less<KeyT>>
+class FlatTree {
+ private:
+  static constexpr bool kKeyOnly = std::is_void_v<ValT>;
+
+ public:
+  using value_type =
+      std::conditional_t<kKeyOnly, KeyT, std::pair<KeyT, ValT>>;
+  using size_type = std::size_t;
+
+ public:
+  FlatTree() = default;
+
+  bool isEmpty() const { return data_.empty(); }
+  size_type size() const { return data_.size(); }
+  size_type capacity() const { return data_.capacity(); }
+  Compare keyComp() const { return compare_; }
+
+  value_type* begin() const { return data_.data(); }
+  value_type* end() const { return data_.data() + data_.size(); }
+
+  template <typename V>
+  std::pair<value_type*, bool> insert(V&& value);
+  template <typename V>
+  std::pair<value_type*, bool> insertHint(value_type* hint, V&& value);
+  template <typename K, typename... Args>
+  std::pair<value_type*, bool> tryEmplace(K&& key, Args&&... args);
+  template <typename InputIt>
+  size_type insertBatch(InputIt first, InputIt last);
+  template <typename Iterator>
+  vector<std::pair<Iterator, bool>> insertMany(const vector<value_type>& items);
+  size_type merge(FlatTree& other);
+
+  value_type* erase(value_type* pos);
+  value_type* erase(value_type* first, value_type* last);
+
+  template <typename InputIt>
+  size_type assignSorted(InputIt first, InputIt last);
+
+  // Lookups take any key type the comparator accepts next to KeyT
+  template <typename K>
+  value_type* search(const K& key) const;
+  template <typename K>
+  value_type* lowerBound(const K& key) const;
+  template <typename K>
+  value_type* upperBound(const K& key) const;
+  template <typename K>
+  std::pair<value_type*, value_type*> equalRange(const K& key) const;
+
+  void reserve(size_type count) { data_.reserve(count); }
+  void shrinkToFit() { data_.shrink_to_fit(); }
+  void clear() { data_.clear(); }
+  void swap(FlatTree& other);
+
+  template <typename T1, typename T2>
+  static const T1& keyOf(const std::pair<T1, T2>& value) {
+    return value.first;
+  }
+  static const KeyT& keyOf(const KeyT& key) { return key; }
+
+ private:
+  vector<value_type> data_;
+  Compare compare_;
+
+ private:
+  template <typename V>
+  value_type* insertAt(value_type* pos, V&& value);
+  void growBy(size_type count);
+  void truncate(value_type* last);
+  void mergeTail(size_type sortedSize);
+
+  // Orders values by key, for the algorithms of <algorithm>
+  auto valueLess() const {
+    return [this](const value_type& a, const value_type& b) {
+      return compare_(keyOf(a), keyOf(b));
+    };
+  }
+};
+
+template <typename KeyT, typename ValT, typename Compare>
+template <typename V>
+std::pair<typename FlatTree<KeyT, ValT, Compare>::value_type*, bool>
+FlatTree<KeyT, ValT, Compare>::insert(V&& value) {
+  value_type* pos = lowerBound(keyOf(value));
+  if (pos != end() && !compare_(keyOf(value), keyOf(*pos)))
+    return std::make_pair(pos, false);
+  return std::make_pair(insertAt(pos, std::forward<V>(value)), true);
+}
+
+// A hint right before the slot of value saves the binary search
+template <typename KeyT, typename ValT, typename Compare>
+template <typename V>
+std::pair<typename FlatTree<KeyT, ValT, Compare>::value_type*, bool>
+FlatTree<KeyT, ValT, Compare>::insertHint(value_type* hint, V&& value) {
+  if ((hint == end() || compare_(keyOf(value), keyOf(*hint))) &&
+      (hint == begin() || compare_(keyOf(*(hint - 1)), keyOf(value))))
+    return std::make_pair(insertAt(hint, std::forward<V>(value)), true);
+  return insert(std::forward<V>(value));
+}
+
+// Unlike insert(), builds the value only when key is not there yet
+template <typename KeyT, typename ValT, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename FlatTree<KeyT, ValT, Compare>::value_type*, bool>
+FlatTree<KeyT, ValT, Compare>::tryEmplace(K&& key, Args&&... args) {
+  value_type* pos = lowerBound(key);
+  if (pos != end() && !compare_(key, keyOf(*pos)))
+    return std::make_pair(pos, false);
+  return std::make_pair(
+      insertAt(pos, value_type(std::piecewise_construct,
+                               std::forward_as_tuple(std::forward<K>(key)),
+                               std::forward_as_tuple(
+                                   std::forward<Args>(args)...))),
+      true);
+}
+
+/*
+  Appends the values of [first, last), sorts them and merges them with the
+  values already stored. Of several equal keys the stored one is kept, and
+  of new ones the first in the range. Returns the number of values added.
+*/
+template <typename KeyT, typename ValT, typename Compare>
+template <typename InputIt>
+typename FlatTree<KeyT, ValT, Compare>::size_type
+FlatTree<KeyT, ValT, Compare>::insertBatch(InputIt first, InputIt last) {
+  size_type oldSize = size();
+  for (; first != last; ++first) {
+    growBy(1);
+    data_.push_back(*first);
+  }
+  if (size() == oldSize) return 0;
+
+  value_type* tail = begin() + oldSize;
+  if (!std::is_sorted(tail, end(), valueLess()))
+    std::stable_sort(tail, end(), valueLess());
+  mergeTail(oldSize);
+  return size() - oldSize;
+}
+
+// Batch insert reporting for every item where its key is and whether the
+// item was the one added. Meant for the few items of insert_many(): they
+// are checked against each other pairwise.
+template <typename KeyT, typename ValT, typename Compare>
+template <typename Iterator>
+vector<std::pair<Iterator, bool>> FlatTree<KeyT, ValT, Compare>::insertMany(
+    const vector<value_type>& items) {
+  auto less = valueLess();
+  vector<bool> added(items.size());
+  for (size_type i = 0; i < items.size(); ++i) {
+    added[i] = search(keyOf(items[i])) == nullptr;
+    for (size_type j = 0; j < i && added[i]; ++j)
+      added[i] = less(items[j], items[i]) || less(items[i], items[j]);
+  }
+  insertBatch(items.begin(), items.end());
+
+  vector<std::pair<Iterator, bool>> res;
+  res.reserve(items.size());
+  for (size_type i = 0; i < items.size(); ++i)
+    res.push_back(std::make_pair(search(keyOf(items[i])), added[i]));
+  return res;
+}
+
+// Moves the values with keys missing here out of other in one linear walk
+// over both, then merges them in like a batch
+template <typename KeyT, typename ValT, typename Compare>
+typename FlatTree<KeyT, ValT, Compare>::size_type
+FlatTree<KeyT, ValT, Compare>::merge(FlatTree& other) {
+  if (this == &other) return 0;
+
+  auto less = valueLess();
+  size_type oldSize = size();
+  size_type index = 0;
+  value_type* kept = other.begin();
+  for (value_type* it = other.begin(); it != other.end(); ++it) {
+    while (index < oldSize && less(data_[index], *it)) ++index;
+    if (index < oldSize && !less(*it, data_[index])) {
+      if (kept != it) *kept = std::move(*it);
+      ++kept;
+    } else {
+      growBy(1);
+      data_.push_back(std::move(*it));
+    }
+  }
+  other.truncate(kept);
+
+  size_type count = size() - oldSize;
+  if (count != 0) mergeTail(oldSize);
+  return count;
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+typename FlatTree<KeyT, ValT, Compare>::value_type*
+FlatTree<KeyT, ValT, Compare>::erase(value_type* pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+typename FlatTree<KeyT, ValT, Compare>::value_type*
+FlatTree<KeyT, ValT, Compare>::erase(value_type* first, value_type* last) {
+  if (first == last) return first;
+  truncate(std::move(last, end(), first));
+  return first;
+}
+
+// A sorted range is taken as it is, any other one is sorted first
+template <typename KeyT, typename ValT, typename Compare>
+template <typename InputIt>
+typename FlatTree<KeyT, ValT, Compare>::size_type
+FlatTree<KeyT, ValT, Compare>::assignSorted(InputIt first, InputIt last) {
+  clear();
+  return insertBatch(first, last);
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+template <typename K>
+typename FlatTree<KeyT, ValT, Compare>::value_type*
+FlatTree<KeyT, ValT, Compare>::search(const K& key) const {
+  value_type* pos = lowerBound(key);
+  return (pos == end() || compare_(key, keyOf(*pos))) ? nullptr : pos;
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+template <typename K>
+typename FlatTree<KeyT, ValT, Compare>::value_type*
+FlatTree<KeyT, ValT, Compare>::lowerBound(const K& key) const {
+  return std::lower_bound(begin(), end(), key,
+                          [this](const value_type& value, const K& key) {
+                            return compare_(keyOf(value), key);
+                          });
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+template <typename K>
+typename FlatTree<KeyT, ValT, Compare>::value_type*
+FlatTree<KeyT, ValT, Compare>::upperBound(const K& key) const {
+  return std::upper_bound(begin(), end(), key,
+                          [this](const K& key, const value_type& value) {
+                            return compare_(key, keyOf(value));
+                          });
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+template <typename K>
+std::pair<typename FlatTree<KeyT, ValT, Compare>::value_type*,
+          typename FlatTree<KeyT, ValT, Compare>::value_type*>
+FlatTree<KeyT, ValT, Compare>::equalRange(const K& key) const {
+  value_type* first = lowerBound(key);
+  value_type* last = first;
+  if (last != end() && !compare_(key, keyOf(*last))) ++last;
+  return std::make_pair(first, last);
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+void FlatTree<KeyT, ValT, Compare>::swap(FlatTree& other) {
+  data_.swap(other.data_);
+  std::swap(compare_, other.compare_);
+}
+
+// The value is appended and rotated into place by moving the tail one slot
+template <typename KeyT, typename ValT, typename Compare>
+template <typename V>
+typename FlatTree<KeyT, ValT, Compare>::value_type*
+FlatTree<KeyT, ValT, Compare>::insertAt(value_type* pos, V&& value) {
+  size_type index = pos - begin();
+  growBy(1);
+  if (index == size()) {
+    data_.push_back(std::forward<V>(value));
+  } else {
+    data_.push_back(std::move(*(end() - 1)));
+    std::move_backward(begin() + index, end() - 2, end() - 1);
+    data_[index] = std::forward<V>(value);
+  }
+  return begin() + index;
+}
+
+// Makes room for count more values up front, so push_back() of a value
+// stored here never reads it from a freed buffer
+template <typename KeyT, typename ValT, typename Compare>
+void FlatTree<KeyT, ValT, Compare>::growBy(size_type count) {
+  if (size() + count <= capacity()) return;
+  data_.reserve(std::max(size() + count, 2 * capacity()));
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+void FlatTree<KeyT, ValT, Compare>::truncate(value_type* last) {
+  while (end() != last) data_.pop_back();
+}
+
+// Merges the sorted values from sortedSize on into the ones before them
+// and drops the new keys that were already there
+template <typename KeyT, typename ValT, typename Compare>
+void FlatTree<KeyT, ValT, Compare>::mergeTail(size_type sortedSize) {
+  auto less = valueLess();
+  value_type* tail = begin() + sortedSize;
+  if (tail != begin() && less(*tail, *(tail - 1)))
+    std::inplace_merge(begin(), tail, end(), less);
+  truncate(std::unique(begin(), end(),
+                       [&less](const value_type& a, const value_type& b) {
+                         return !less(a, b);
+                       }));
+}
+
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_FLAT_TREE_H_
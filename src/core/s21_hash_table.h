@@ -0,0 +1,662 @@
+#ifndef SRC_CORE_S21_HASH_TABLE_H_
+#define SRC_CORE_S21_HASH_TABLE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Enables the lookup overloads taking any key type K when both the hash and
+// the key equality declare is_transparent
+template <typename Hash, typename KeyEqual, typename K, typename = void>
+struct transparent_hash_key {};
+template <typename Hash, typename KeyEqual, typename K>
+struct transparent_hash_key<Hash, KeyEqual, K,
+                            std::void_t<typename Hash::is_transparent,
+                                        typename KeyEqual::is_transparent>> {
+  using type = K;
+};
+template <typename Hash, typename KeyEqual, typename K>
+using transparent_hash_key_t =
+    typename transparent_hash_key<Hash, KeyEqual, K>::type;
+
+/*
+  Open addressing hash table behind unordered_map and unordered_set, laid
+  out as a Swiss table.
+
+  The elements sit in one array of slots, a power of two of them, with one
+  control byte per slot after it: empty, deleted, or the low 7 bits (h2)
+  of the hash of the element in the slot. The slots are probed in aligned
+  groups of kGroupWidth: one SIMD compare of the control bytes of a group
+  with h2 yields the candidate slots, so keys are only compared on a 7-bit
+  hash match, which is nearly always the element looked for. The rest of
+  the hash (h1) picks the first group, the next ones follow at 1, 2, 3...
+  groups further, and a lookup stops at the first group with an empty slot.
+
+  An erased slot turns empty again when its group has an empty slot left,
+  as no probe went on past that group, and is marked deleted otherwise.
+  The table grows once used and deleted slots would pass 7/8 of all slots;
+  when half of them are deleted it is rehashed at the same size instead.
+
+  A rehash moves the elements to new slots and invalidates all iterators,
+  an erase only those to the erased element. A void ValT makes the slots
+  hold bare keys.
+*/
+template <typename KeyT, typename ValT, typename Hash = std::hash<KeyT>,
+          typename KeyEqual = std::equal_to<KeyT>>
+class HashTable {
+ private:
+  static constexpr bool kKeyOnly = std::is_void_v<ValT>;
+
+ public:
+  using value_type =
+      std::conditional_t<kKeyOnly, KeyT, std::pair<const KeyT, ValT>>;
+  using size_type = std::size_t;
+
+  template <bool kConst>
+  class Iterator;
+  // The keys of set-like tables can't be changed through an iterator
+  using iterator = Iterator<kKeyOnly>;
+  using const_iterator = Iterator<true>;
+
+ private:
+  // Slots hold pairs with a mutable key, so a rehash can move them. They
+  // are handed out as value_type, which has the same layout.
+  using slot_type = std::conditional_t<kKeyOnly, KeyT, std::pair<KeyT, ValT>>;
+  using ctrl_t = std::int8_t;
+
+  // Control bytes of the slots that hold no element. Full slots have their
+  // h2 in 0..127, so a negative byte is a free slot or the end.
+  static constexpr ctrl_t kEmpty = -128;
+  static constexpr ctrl_t kDeleted = -2;
+  static constexpr ctrl_t kSentinel = -1;
+
+  static constexpr size_type kGroupWidth = 16;
+
+  class Group;
+
+ public:
+  HashTable() = default;
+  HashTable(const HashTable& other);
+  HashTable(HashTable&& other) noexcept;
+  ~HashTable();
+
+  HashTable& operator=(const HashTable& other);
+  HashTable& operator=(HashTable&& other) noexcept;
+
+  bool isEmpty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type bucketCount() const { return capacity_; }
+  Hash hashFunction() const { return hash_; }
+  KeyEqual keyEq() const { return keyEq_; }
+
+  iterator begin() { return iterator(ctrl_, slots_); }
+  const_iterator begin() const { return const_iterator(ctrl_, slots_); }
+  iterator end() { return iterator(ctrl_ + capacity_, slots_ + capacity_); }
+  const_iterator end() const {
+    return const_iterator(ctrl_ + capacity_, slots_ + capacity_);
+  }
+
+  template <typename V>
+  std::pair<iterator, bool> insert(V&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> tryEmplace(K&& key, Args&&... args);
+  size_type merge(HashTable& other);
+
+  iterator erase(const_iterator pos);
+
+  // Lookups and erasure by key take any key type that Hash and KeyEqual
+  // accept next to KeyT
+  template <typename K>
+  size_type eraseKey(const K& key);
+  template <typename K>
+  iterator search(const K& key);
+  template <typename K>
+  const_iterator search(const K& key) const;
+
+  void reserve(size_type count);
+  void rehash(size_type count);
+  void clear();
+  void swap(HashTable& other) noexcept;
+
+  template <typename T1, typename T2>
+  static const T1& keyOf(const std::pair<T1, T2>& value) {
+    return value.first;
+  }
+  static const KeyT& keyOf(const KeyT& key) { return key; }
+
+ private:
+  slot_type* slots_ = nullptr;
+  ctrl_t* ctrl_ = emptyCtrl();
+  size_type capacity_ = 0;
+  size_type size_ = 0;
+  // Empty slots that may still be filled before the table grows
+  size_type growthLeft_ = 0;
+  Hash hash_;
+  KeyEqual keyEq_;
+
+ private:
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplaceKey(const K& key, Args&&... args);
+  template <typename K>
+  size_type findIndex(const K& key, size_type hash) const;
+  size_type findFree(size_type hash) const;
+  size_type prepareInsert(size_type hash);
+  void eraseAt(size_type index);
+  bool aliases(const void* ptr) const noexcept;
+
+  void resize(size_type capacity);
+  void allocate(size_type capacity);
+  void destroy();
+
+  template <typename K>
+  size_type hashOf(const K& key) const;
+  static ctrl_t h2(size_type hash) { return ctrl_t(hash & 0x7F); }
+  static size_type maxLoad(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+  static size_type capacityFor(size_type count);
+
+  // Control bytes of the table without slots: an end that lookups and
+  // iterators stop at
+  static ctrl_t* emptyCtrl() {
+    static ctrl_t sentinels[kGroupWidth] = {
+        kSentinel, kSentinel, kSentinel, kSentinel, kSentinel, kSentinel,
+        kSentinel, kSentinel, kSentinel, kSentinel, kSentinel, kSentinel,
+        kSentinel, kSentinel, kSentinel, kSentinel};
+    return sentinels;
+  }
+
+  static value_type& asValue(slot_type& slot) {
+    return reinterpret_cast<value_type&>(slot);
+  }
+};
+
+// Control bytes of kGroupWidth slots, compared all at once. Bit i of the
+// masks stands for slot i of the group.
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+class HashTable<KeyT, ValT, Hash, KeyEqual>::Group {
+ public:
+  // Slots before the first full one or the end, kGroupWidth if there are
+  // none in the group
+  size_type countLeadingFree() const {
+    return size_type(__builtin_ctz(matchEmptyOrDeleted() ^ 0x1FFFFu));
+  }
+
+#if defined(__SSE2__)
+  explicit Group(const ctrl_t* ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  std::uint32_t match(ctrl_t hash) const {
+    return std::uint32_t(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), ctrl_)));
+  }
+  std::uint32_t matchEmpty() const { return match(kEmpty); }
+  std::uint32_t matchEmptyOrDeleted() const {
+    return std::uint32_t(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_)));
+  }
+
+ private:
+  __m128i ctrl_;
+#else
+  explicit Group(const ctrl_t* ctrl) { std::memcpy(ctrl_, ctrl, kGroupWidth); }
+
+  std::uint32_t match(ctrl_t hash) const {
+    std::uint32_t mask = 0;
+    for (size_type i = 0; i < kGroupWidth; ++i)
+      mask |= std::uint32_t(ctrl_[i] == hash) << i;
+    return mask;
+  }
+  std::uint32_t matchEmpty() const { return match(kEmpty); }
+  std::uint32_t matchEmptyOrDeleted() const {
+    std::uint32_t mask = 0;
+    for (size_type i = 0; i < kGroupWidth; ++i)
+      mask |= std::uint32_t(ctrl_[i] < kSentinel) << i;
+    return mask;
+  }
+
+ private:
+  ctrl_t ctrl_[kGroupWidth];
+#endif
+};
+
+// Walks the full slots in storage order. A position is its control byte
+// and slot, end() being the sentinel byte after the last control byte.
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <bool kConst>
+class HashTable<KeyT, ValT, Hash, KeyEqual>::Iterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = HashTable::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<kConst, const value_type*, value_type*>;
+  using reference = std::conditional_t<kConst, const value_type&, value_type&>;
+
+ public:
+  Iterator() = default;
+  // An iterator converts to a const_iterator
+  template <bool kOther, typename = std::enable_if_t<kConst && !kOther>>
+  Iterator(const Iterator<kOther>& other)
+      : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+  reference operator*() const { return asValue(*slot_); }
+  pointer operator->() const { return &asValue(*slot_); }
+
+  Iterator& operator++() {
+    ++ctrl_;
+    ++slot_;
+    skipFree();
+    return *this;
+  }
+
+  Iterator operator++(int) {
+    Iterator temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  friend bool operator==(const Iterator& a, const Iterator& b) {
+    return a.ctrl_ == b.ctrl_;
+  }
+  friend bool operator!=(const Iterator& a, const Iterator& b) {
+    return !(a == b);
+  }
+
+ private:
+  friend class HashTable;
+  template <bool>
+  friend class Iterator;
+
+  Iterator(const ctrl_t* ctrl, slot_type* slot) : ctrl_(ctrl), slot_(slot) {
+    skipFree();
+  }
+
+  // Moves on to the first full slot from here, or to the end
+  void skipFree() {
+    while (*ctrl_ < kSentinel) {
+      size_type shift = Group(ctrl_).countLeadingFree();
+      ctrl_ += shift;
+      slot_ += shift;
+    }
+  }
+
+  const ctrl_t* ctrl_ = nullptr;
+  slot_type* slot_ = nullptr;
+};
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+HashTable<KeyT, ValT, Hash, KeyEqual>::HashTable(const HashTable& other)
+    : hash_(other.hash_), keyEq_(other.keyEq_) {
+  if (other.size_ == 0) return;
+
+  allocate(other.capacity_);
+  std::memcpy(ctrl_, other.ctrl_, capacity_);
+  for (size_type i = 0; i < capacity_; ++i)
+    if (ctrl_[i] >= 0) new (slots_ + i) slot_type(other.slots_[i]);
+  size_ = other.size_;
+  growthLeft_ = other.growthLeft_;
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+HashTable<KeyT, ValT, Hash, KeyEqual>::HashTable(HashTable&& other) noexcept
+    : hash_(other.hash_), keyEq_(other.keyEq_) {
+  swap(other);
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+HashTable<KeyT, ValT, Hash, KeyEqual>::~HashTable() {
+  destroy();
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+HashTable<KeyT, ValT, Hash, KeyEqual>&
+HashTable<KeyT, ValT, Hash, KeyEqual>::operator=(const HashTable& other) {
+  if (this != &other) {
+    HashTable temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+HashTable<KeyT, ValT, Hash, KeyEqual>&
+HashTable<KeyT, ValT, Hash, KeyEqual>::operator=(HashTable&& other) noexcept {
+  if (this != &other) {
+    HashTable temp(std::move(other));
+    swap(temp);
+  }
+  return *this;
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename V>
+std::pair<typename HashTable<KeyT, ValT, Hash, KeyEqual>::iterator, bool>
+HashTable<KeyT, ValT, Hash, KeyEqual>::insert(V&& value) {
+  return emplaceKey(keyOf(value), std::forward<V>(value));
+}
+
+// The element is built first to find its key, and moved into its slot
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename HashTable<KeyT, ValT, Hash, KeyEqual>::iterator, bool>
+HashTable<KeyT, ValT, Hash, KeyEqual>::emplace(Args&&... args) {
+  slot_type value(std::forward<Args>(args)...);
+  return emplaceKey(keyOf(value), std::move(value));
+}
+
+/*
+  Unlike insert(), builds the value only when key is not there yet. The
+  value is built right in its slot, unless the table may grow and key or
+  args refer into the slots a resize moves: then it is built aside first.
+*/
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename K, typename... Args>
+std::pair<typename HashTable<KeyT, ValT, Hash, KeyEqual>::iterator, bool>
+HashTable<KeyT, ValT, Hash, KeyEqual>::tryEmplace(K&& key, Args&&... args) {
+  static_assert(!kKeyOnly, "tryEmplace() needs a mapped value");
+  if (growthLeft_ == 0 && (aliases(&key) || (aliases(&args) || ...))) {
+    iterator found = search(key);
+    if (found != end()) return std::make_pair(found, false);
+
+    slot_type value(std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+    return emplaceKey(keyOf(value), std::move(value));
+  }
+  return emplaceKey(key, std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+/*
+  Moves the elements of other whose keys are not here yet into this table
+  and leaves the rest in other. Every key is hashed once, for the lookup
+  and the insert. Returns the number of elements moved.
+*/
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::size_type
+HashTable<KeyT, ValT, Hash, KeyEqual>::merge(HashTable& other) {
+  if (this == &other) return 0;
+
+  size_type moved = 0;
+  for (size_type i = 0; i < other.capacity_; ++i) {
+    if (other.ctrl_[i] < 0) continue;
+    slot_type& slot = other.slots_[i];
+    size_type hash = hashOf(keyOf(slot));
+    if (findIndex(keyOf(slot), hash) != capacity_) continue;
+
+    size_type index = prepareInsert(hash);
+    new (slots_ + index) slot_type(std::move(slot));
+    ctrl_[index] = h2(hash);
+    ++size_;
+    other.eraseAt(i);
+    ++moved;
+  }
+  return moved;
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::iterator
+HashTable<KeyT, ValT, Hash, KeyEqual>::erase(const_iterator pos) {
+  size_type index = size_type(pos.ctrl_ - ctrl_);
+  eraseAt(index);
+  return iterator(ctrl_ + index, slots_ + index);
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename K>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::size_type
+HashTable<KeyT, ValT, Hash, KeyEqual>::eraseKey(const K& key) {
+  size_type index = findIndex(key, hashOf(key));
+  if (index == capacity_) return 0;
+  eraseAt(index);
+  return 1;
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename K>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::iterator
+HashTable<KeyT, ValT, Hash, KeyEqual>::search(const K& key) {
+  size_type index = findIndex(key, hashOf(key));
+  return iterator(ctrl_ + index, slots_ + index);
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename K>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::const_iterator
+HashTable<KeyT, ValT, Hash, KeyEqual>::search(const K& key) const {
+  size_type index = findIndex(key, hashOf(key));
+  return const_iterator(ctrl_ + index, slots_ + index);
+}
+
+// Makes room for count elements in all, so that inserts up to that size
+// don't rehash. Deleted slots in the way are cleared by a rehash.
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+void HashTable<KeyT, ValT, Hash, KeyEqual>::reserve(size_type count) {
+  if (count > size_ + growthLeft_)
+    resize(std::max(capacityFor(count), capacity_));
+}
+
+// Rehashes into at least count slots, and enough of them for the elements
+// there are, growing or shrinking the table. An empty table with count 0
+// gives its memory back.
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+void HashTable<KeyT, ValT, Hash, KeyEqual>::rehash(size_type count) {
+  if (count == 0 && size_ == 0) {
+    destroy();
+    slots_ = nullptr;
+    ctrl_ = emptyCtrl();
+    capacity_ = growthLeft_ = 0;
+    return;
+  }
+
+  size_type capacity = capacityFor(size_);
+  while (capacity < count) capacity *= 2;
+  resize(capacity);
+}
+
+// Keeps the slots, so refilling the table up to its former size doesn't
+// allocate
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+void HashTable<KeyT, ValT, Hash, KeyEqual>::clear() {
+  if (capacity_ == 0) return;
+
+  for (size_type i = 0; i < capacity_; ++i)
+    if (ctrl_[i] >= 0) slots_[i].~slot_type();
+  std::memset(ctrl_, kEmpty, capacity_);
+  size_ = 0;
+  growthLeft_ = maxLoad(capacity_);
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+void HashTable<KeyT, ValT, Hash, KeyEqual>::swap(HashTable& other) noexcept {
+  std::swap(slots_, other.slots_);
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growthLeft_, other.growthLeft_);
+  std::swap(hash_, other.hash_);
+  std::swap(keyEq_, other.keyEq_);
+}
+
+// Inserts an element built from args unless key is already there. key
+// must be the key the element will have.
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename K, typename... Args>
+std::pair<typename HashTable<KeyT, ValT, Hash, KeyEqual>::iterator, bool>
+HashTable<KeyT, ValT, Hash, KeyEqual>::emplaceKey(const K& key,
+                                                  Args&&... args) {
+  size_type hash = hashOf(key);
+  size_type index = findIndex(key, hash);
+  if (index != capacity_)
+    return std::make_pair(iterator(ctrl_ + index, slots_ + index), false);
+
+  index = prepareInsert(hash);
+  new (slots_ + index) slot_type(std::forward<Args>(args)...);
+  ctrl_[index] = h2(hash);
+  ++size_;
+  return std::make_pair(iterator(ctrl_ + index, slots_ + index), true);
+}
+
+// Index of the element with key, capacity_ when there is none
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename K>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::size_type
+HashTable<KeyT, ValT, Hash, KeyEqual>::findIndex(const K& key,
+                                                 size_type hash) const {
+  if (capacity_ == 0) return 0;
+
+  size_type groupMask = capacity_ / kGroupWidth - 1;
+  size_type group = (hash >> 7) & groupMask;
+  for (size_type step = 1;; ++step) {
+    size_type first = group * kGroupWidth;
+    Group controls(ctrl_ + first);
+    for (std::uint32_t mask = controls.match(h2(hash)); mask != 0;
+         mask &= mask - 1) {
+      size_type index = first + size_type(__builtin_ctz(mask));
+      if (keyEq_(keyOf(slots_[index]), key)) return index;
+    }
+    if (controls.matchEmpty() != 0) return capacity_;
+    group = (group + step) & groupMask;
+  }
+}
+
+// Index of the first empty or deleted slot on the probe sequence of hash
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::size_type
+HashTable<KeyT, ValT, Hash, KeyEqual>::findFree(size_type hash) const {
+  size_type groupMask = capacity_ / kGroupWidth - 1;
+  size_type group = (hash >> 7) & groupMask;
+  for (size_type step = 1;; ++step) {
+    size_type first = group * kGroupWidth;
+    std::uint32_t mask = Group(ctrl_ + first).matchEmptyOrDeleted();
+    if (mask != 0) return first + size_type(__builtin_ctz(mask));
+    group = (group + step) & groupMask;
+  }
+}
+
+// Finds the slot for a new element with hash, growing the table first when
+// that slot is empty and the growth left is used up
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::size_type
+HashTable<KeyT, ValT, Hash, KeyEqual>::prepareInsert(size_type hash) {
+  if (capacity_ == 0) allocate(capacityFor(1));
+
+  size_type index = findFree(hash);
+  if (growthLeft_ == 0 && ctrl_[index] == kEmpty) {
+    resize(size_ * 2 <= maxLoad(capacity_) ? capacity_ : capacity_ * 2);
+    index = findFree(hash);
+  }
+  if (ctrl_[index] == kEmpty) --growthLeft_;
+  return index;
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+void HashTable<KeyT, ValT, Hash, KeyEqual>::eraseAt(size_type index) {
+  slots_[index].~slot_type();
+  --size_;
+
+  size_type first = index & ~(kGroupWidth - 1);
+  if (Group(ctrl_ + first).matchEmpty() != 0) {
+    ctrl_[index] = kEmpty;
+    ++growthLeft_;
+  } else {
+    ctrl_[index] = kDeleted;
+  }
+}
+
+// Whether ptr points into one of the slots, which a resize moves
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+bool HashTable<KeyT, ValT, Hash, KeyEqual>::aliases(
+    const void* ptr) const noexcept {
+  const std::less_equal<const void*> lessEqual;
+  return size_ != 0 && lessEqual(slots_, ptr) &&
+         !lessEqual(slots_ + capacity_, ptr);
+}
+
+// Moves all elements into a new table of capacity slots
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+void HashTable<KeyT, ValT, Hash, KeyEqual>::resize(size_type capacity) {
+  slot_type* oldSlots = slots_;
+  ctrl_t* oldCtrl = ctrl_;
+  size_type oldCapacity = capacity_;
+
+  allocate(capacity);
+  for (size_type i = 0; i < oldCapacity; ++i) {
+    if (oldCtrl[i] < 0) continue;
+    size_type hash = hashOf(keyOf(oldSlots[i]));
+    size_type index = findFree(hash);
+    new (slots_ + index) slot_type(std::move(oldSlots[i]));
+    oldSlots[i].~slot_type();
+    ctrl_[index] = h2(hash);
+  }
+  growthLeft_ -= size_;
+
+  if (oldCapacity != 0) delete[] reinterpret_cast<std::byte*>(oldSlots);
+}
+
+// Sets up capacity empty slots, with their control bytes in the same block
+// behind them. The sentinels after the control bytes end every group read
+// from any of them.
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+void HashTable<KeyT, ValT, Hash, KeyEqual>::allocate(size_type capacity) {
+  std::byte* block =
+      new std::byte[capacity * sizeof(slot_type) + capacity + kGroupWidth];
+  slots_ = reinterpret_cast<slot_type*>(block);
+  ctrl_ = reinterpret_cast<ctrl_t*>(block + capacity * sizeof(slot_type));
+  std::memset(ctrl_, kEmpty, capacity);
+  std::memset(ctrl_ + capacity, kSentinel, kGroupWidth);
+  capacity_ = capacity;
+  growthLeft_ = maxLoad(capacity);
+}
+
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+void HashTable<KeyT, ValT, Hash, KeyEqual>::destroy() {
+  if (capacity_ == 0) return;
+
+  for (size_type i = 0; i < capacity_; ++i)
+    if (ctrl_[i] >= 0) slots_[i].~slot_type();
+  delete[] reinterpret_cast<std::byte*>(slots_);
+  size_ = 0;
+}
+
+// std::hash of an integer is the integer itself: the product spreads every
+// bit of it over the high half, which is folded onto the low bits that h1
+// and h2 are taken from
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+template <typename K>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::size_type
+HashTable<KeyT, ValT, Hash, KeyEqual>::hashOf(const K& key) const {
+  std::uint64_t hash =
+      std::uint64_t(hash_(key)) * UINT64_C(0x9E3779B97F4A7C15);
+  return size_type(hash ^ (hash >> 32));
+}
+
+// Smallest power of two slot count, from one group, that holds count
+// elements
+template <typename KeyT, typename ValT, typename Hash, typename KeyEqual>
+typename HashTable<KeyT, ValT, Hash, KeyEqual>::size_type
+HashTable<KeyT, ValT, Hash, KeyEqual>::capacityFor(size_type count) {
+  size_type capacity = kGroupWidth;
+  while (maxLoad(capacity) < count) capacity *= 2;
+  return capacity;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_HASH_TABLE_H_
@@ -4,13 +4,14 @@
 #include <limits>
 #include <type_traits>
 
+#include "s21_btree.h"
 #include "s21_container.h"
-#include "s21_rbtree.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename KeyT, typename ValT>
+template <typename KeyT, typename ValT, typename Compare = std::less<KeyT>,
+          typename Policy = default_tree_policy>
 class map : public IContainer {
  public:
   class MapIterator;
@@ -21,25 +22,34 @@ class map : public IContainer {
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = map<key_type, mapped_type>::MapIterator;
-  using const_iterator = map<key_type, mapped_type>::MapConstIterator;
+  using iterator = MapIterator;
+  using const_iterator = MapConstIterator;
   using typename IContainer::size_type;
+  using key_compare = Compare;
+  using tree_type = tree_engine_t<KeyT, ValT, false, Compare, Policy>;
+  using node_pool = typename tree_type::pool_type;
+  using node_pool_pointer = typename tree_type::pool_pointer;
+  using node_type = typename tree_type::NodeHandle;
 
  public:
   map();
+  explicit map(node_pool_pointer pool);
   map(std::initializer_list<value_type> const& items);
+  template <typename ForwardIt>
+  map(ForwardIt first, ForwardIt last, sorted_tag_t);
   map(const map& other);
   map(map&& other) noexcept;
   ~map(){};
 
-  map<key_type, mapped_type>& operator=(const map& other);
-  map<key_type, mapped_type>& operator=(map&& other);
+  map& operator=(const map& other);
+  map& operator=(map&& other);
   mapped_type& at(const key_type& key);
   mapped_type& at(const key_type& key) const;
   mapped_type& operator[](const key_type& key);
+  mapped_type& operator[](key_type&& key);
 
-  bool operator==(const map<key_type, mapped_type>& other) const;
-  bool operator!=(const map<key_type, mapped_type>& other) const;
+  bool operator==(const map& other) const;
+  bool operator!=(const map& other) const;
 
   iterator begin();
   const_iterator begin() const;
@@ -49,31 +59,63 @@ class map : public IContainer {
   bool empty() const noexcept override { return btree_.isEmpty(); }
   size_type size() const noexcept override { return size_; }
   static size_type max_size();
+  void reserve(size_type count);
+  node_pool_pointer get_node_pool();
+  key_compare key_comp() const { return btree_.keyComp(); }
 
   void clear();
+  template <typename ForwardIt>
+  void assign(ForwardIt first, ForwardIt last, sorted_tag_t);
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
   std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
+  iterator insert(const_iterator hint, const value_type& value);
+  iterator insert(const_iterator hint, value_type&& value);
+  std::pair<iterator, bool> insert(node_type&& node);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args);
   std::pair<iterator, bool> insert_or_assign(const key_type& key,
                                              const mapped_type& obj);
 
   void erase(iterator pos);
   void swap(map& other);
   void merge(map& other);
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type& key);
   bool contains(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  bool contains(const K& key);
+
+  iterator lower_bound(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  iterator lower_bound(const K& key);
+  iterator upper_bound(const key_type& key);
+  std::pair<iterator, iterator> equal_range(const key_type& key);
+
+  // Need order_statistic_policy
+  iterator nth(size_type index);
+  size_type rank(const key_type& key) const;
+  std::ptrdiff_t distance(const_iterator first, const_iterator last) const;
 
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
  private:
-  RBTree<KeyT, ValT, false> btree_;
+  tree_type btree_;
   size_type size_;
 
  private:
   void erase(value_type pos);
 };
 
-template <typename KeyT, typename ValT>
-class map<KeyT, ValT>::MapIterator {
+template <typename KeyT, typename ValT, typename Compare, typename Policy>
+class map<KeyT, ValT, Compare, Policy>::MapIterator {
  public:
   using iterator_category = std::bidirectional_iterator_tag;
   using value_type = std::pair<const KeyT, ValT>;
@@ -81,19 +123,18 @@ class map<KeyT, ValT>::MapIterator {
   using pointer = value_type*;
   using reference = value_type&;
 
-  using Node = typename RBTree<KeyT, ValT, false>::Node;
+  using Cursor = typename tree_type::Cursor;
 
  public:
   MapIterator() = default;
-  MapIterator(typename RBTree<KeyT, ValT, false>::Node* ptr,
-              RBTree<KeyT, ValT, false>* it_btree)
+  MapIterator(Cursor ptr, tree_type* it_btree)
       : ptr_(ptr), it_btree_(it_btree) {}
 
   bool operator==(const MapIterator& other) { return ptr_ == other.ptr_; }
   bool operator!=(const MapIterator& other) { return !(*this == other); }
 
   MapIterator& operator++() {
-    ptr_ = RBT_increment(ptr_);
+    ptr_ = it_btree_->getNext(ptr_);
     return *this;
   }
 
@@ -104,7 +145,7 @@ class map<KeyT, ValT>::MapIterator {
   }
 
   MapIterator& operator--() {
-    ptr_ = RBT_decrement(ptr_);
+    ptr_ = it_btree_->getPrev(ptr_);
     return *this;
   }
 
@@ -114,18 +155,18 @@ class map<KeyT, ValT>::MapIterator {
     return temp;
   }
 
-  reference operator*() { return ptr_->val_; }
+  reference operator*() { return tree_type::valueOf(ptr_); }
 
  private:
-  typename RBTree<KeyT, ValT, false>::Node* ptr_ = nullptr;
-  RBTree<KeyT, ValT, false>* it_btree_ = nullptr;
+  friend class map<KeyT, ValT, Compare, Policy>;
 
-  Node* RBT_increment(Node* ptr);
-  Node* RBT_decrement(Node* ptr);
+  Cursor ptr_ = Cursor();
+  tree_type* it_btree_ = nullptr;
 };
 
-template <typename KeyT, typename ValT>
-class map<KeyT, ValT>::MapConstIterator : public map<KeyT, ValT>::MapIterator {
+template <typename KeyT, typename ValT, typename Compare, typename Policy>
+class map<KeyT, ValT, Compare, Policy>::MapConstIterator
+    : public map<KeyT, ValT, Compare, Policy>::MapIterator {
  public:
   using value_type = std::pair<const KeyT, ValT>;
   using const_reference = const value_type&;
@@ -135,83 +176,73 @@ class map<KeyT, ValT>::MapConstIterator : public map<KeyT, ValT>::MapIterator {
   const_reference operator*() { return MapIterator::operator*(); }
 };
 
-template <typename key_type, typename mapped_type>
-typename RBTree<key_type, mapped_type, false>::Node*
-map<key_type, mapped_type>::MapIterator::RBT_increment(
-    typename RBTree<key_type, mapped_type, false>::Node* ptr) {
-  if (!it_btree_->isNil(ptr->right_)) {
-    ptr = ptr->right_;
-    while (!it_btree_->isNil(ptr->left_)) ptr = ptr->left_;
-  } else {
-    typename RBTree<key_type, mapped_type, false>::Node* parent = ptr->parent_;
-    while (ptr == parent->right_) {
-      ptr = parent;
-      parent = parent->parent_;
-    }
-    if (ptr->right_ != parent) ptr = parent;
-  }
-  return ptr;
-}
-
-template <typename key_type, typename mapped_type>
-typename RBTree<key_type, mapped_type, false>::Node*
-map<key_type, mapped_type>::MapIterator::RBT_decrement(
-    typename RBTree<key_type, mapped_type, false>::Node* ptr) {
-  if (!it_btree_->isNil(ptr->left_)) {
-    ptr = ptr->left_;
-    while (!it_btree_->isNil(ptr->right_)) ptr = ptr->right_;
-  } else {
-    typename RBTree<key_type, mapped_type, false>::Node* parent = ptr->parent_;
-    while (ptr == parent->left_) {
-      ptr = parent;
-      parent = parent->parent_;
-    }
-    if (ptr->left_ != parent) ptr = parent;
-  }
-  return ptr;
-}
-
-template <typename key_type, typename mapped_type>
-bool map<key_type, mapped_type>::operator==(
-    const map<key_type, mapped_type>& other) const {
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+bool map<key_type, mapped_type, compare_type, policy_type>::operator==(
+    const map<key_type, mapped_type, compare_type, policy_type>& other) const {
   if (this == &other) return true;
   if (size() != other.size()) return false;
 
   return (std::equal(begin(), end(), other.begin()));
 }
 
-template <typename key_type, typename mapped_type>
-bool map<key_type, mapped_type>::operator!=(
-    const map<key_type, mapped_type>& other) const {
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+bool map<key_type, mapped_type, compare_type, policy_type>::operator!=(
+    const map<key_type, mapped_type, compare_type, policy_type>& other) const {
   return !(*this == other);
 }
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::size_type
-map<key_type, mapped_type>::max_size() {
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::size_type
+map<key_type, mapped_type, compare_type, policy_type>::max_size() {
   return std::numeric_limits<size_type>::max() /
-         sizeof(typename RBTree<key_type, mapped_type, false>::Node) /
-         4294967296;
+         sizeof(typename tree_type::Node) / 4294967296;
 }
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map() : btree_(), size_(0) {}
-
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(std::initializer_list<value_type> const& items)
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+map<key_type, mapped_type, compare_type, policy_type>::map()
+    : btree_(), size_(0) {}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+map<key_type, mapped_type, compare_type, policy_type>::map(
+    node_pool_pointer pool)
+    : btree_(std::move(pool)), size_(0) {}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+map<key_type, mapped_type, compare_type, policy_type>::map(
+    std::initializer_list<value_type> const& items)
     : btree_(), size_(0) {
+  btree_.reserve(items.size());
   for (const_reference p : items)
     if (btree_.insert(p).second) size_++;
 }
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(const map& other)
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+template <typename ForwardIt>
+map<key_type, mapped_type, compare_type, policy_type>::map(ForwardIt first,
+                                                           ForwardIt last,
+                                                           sorted_tag_t)
+    : btree_(), size_(0) {
+  size_ = btree_.assignSorted(first, last);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+map<key_type, mapped_type, compare_type, policy_type>::map(const map& other)
     : btree_(), size_(other.size_) {
-  for (auto it : other) this->btree_.insert(it);
+  btree_.reserve(other.size_);
+  for (const_reference it : other) this->btree_.insert(it);
 }
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(map&& other) noexcept
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+map<key_type, mapped_type, compare_type, policy_type>::map(map&& other) noexcept
     : btree_(other.btree_), size_(other.size_) {
   if (this != &other) {
     other.btree_.makeNullRoot();
@@ -219,19 +250,23 @@ map<key_type, mapped_type>::map(map&& other) noexcept
   }
 }
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>& map<key_type, mapped_type>::operator=(
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+map<key_type, mapped_type, compare_type, policy_type>&
+map<key_type, mapped_type, compare_type, policy_type>::operator=(
     const map& other) {
   size_ = other.size_;
-  for (auto it : other) this->btree_.insert(it);
+  for (const_reference it : other) this->btree_.insert(it);
 
   return *this;
 }
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>& map<key_type, mapped_type>::operator=(map&& other) {
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+map<key_type, mapped_type, compare_type, policy_type>&
+map<key_type, mapped_type, compare_type, policy_type>::operator=(map&& other) {
   if (this == &other) return *this;
-  map<key_type, mapped_type> temp = std::move(*this);
+  map<key_type, mapped_type, compare_type, policy_type> temp = std::move(*this);
   btree_ = other.btree_;
   size_ = other.size_;
 
@@ -241,147 +276,382 @@ map<key_type, mapped_type>& map<key_type, mapped_type>::operator=(map&& other) {
   return *this;
 }
 
-template <typename key_type, typename mapped_type>
-mapped_type& map<key_type, mapped_type>::at(const key_type& key) {
-  typename RBTree<key_type, mapped_type, false>::Node* temp =
-      btree_.search(key);
-  if (temp == nullptr)
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+mapped_type& map<key_type, mapped_type, compare_type, policy_type>::at(
+    const key_type& key) {
+  typename tree_type::Cursor temp = btree_.search(key);
+  if (!temp)
     throw std::out_of_range("Element with the current key was not found!");
   else
-    return temp->val_.second;
+    return tree_type::valueOf(temp).second;
 }
 
-template <typename key_type, typename mapped_type>
-mapped_type& map<key_type, mapped_type>::at(const key_type& key) const {
-  typename RBTree<key_type, mapped_type, false>::Node* temp =
-      btree_.search(key);
-  if (temp == nullptr)
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+mapped_type& map<key_type, mapped_type, compare_type, policy_type>::at(
+    const key_type& key) const {
+  typename tree_type::Cursor temp = btree_.search(key);
+  if (!temp)
     throw std::out_of_range("Element with the current key was not found!");
   else
-    return temp->val_.second;
+    return tree_type::valueOf(temp).second;
 }
 
-template <typename key_type, typename mapped_type>
-mapped_type& map<key_type, mapped_type>::operator[](const key_type& key) {
-  std::pair<typename RBTree<key_type, mapped_type, false>::Node*, bool> temp =
-      btree_.insert(key);
-  if (temp.second) size_++;
-  return temp.first->val_.second;
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+mapped_type& map<key_type, mapped_type, compare_type, policy_type>::operator[](
+    const key_type& key) {
+  return (*try_emplace(key).first).second;
 }
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::iterator
-map<key_type, mapped_type>::begin() {
-  map<key_type, mapped_type>::iterator it(btree_.getMin(), &btree_);
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+mapped_type& map<key_type, mapped_type, compare_type, policy_type>::operator[](
+    key_type&& key) {
+  return (*try_emplace(std::move(key)).first).second;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::begin() {
+  iterator it(btree_.getMin(), &btree_);
   return it;
 }
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::const_iterator
-map<key_type, mapped_type>::begin() const {
-  MapIterator it(btree_.getMin(),
-                 const_cast<RBTree<key_type, mapped_type, false>*>(&btree_));
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::const_iterator
+map<key_type, mapped_type, compare_type, policy_type>::begin() const {
+  MapIterator it(btree_.getMin(), const_cast<tree_type*>(&btree_));
   return MapConstIterator(it);
 }
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::iterator
-map<key_type, mapped_type>::end() {
-  map<key_type, mapped_type>::iterator it(btree_.getMax(), &btree_);
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::end() {
+  iterator it(btree_.getMax(), &btree_);
   return it;
 }
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::const_iterator
-map<key_type, mapped_type>::end() const {
-  MapIterator it(btree_.getMax(),
-                 const_cast<RBTree<key_type, mapped_type, false>*>(&btree_));
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::const_iterator
+map<key_type, mapped_type, compare_type, policy_type>::end() const {
+  MapIterator it(btree_.getMax(), const_cast<tree_type*>(&btree_));
   return MapConstIterator(it);
 }
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::clear() {
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+void map<key_type, mapped_type, compare_type, policy_type>::reserve(
+    size_type count) {
+  if (count > size_) btree_.reserve(count - size_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type,
+             policy_type>::node_pool_pointer
+map<key_type, mapped_type, compare_type, policy_type>::get_node_pool() {
+  return btree_.getPool();
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+void map<key_type, mapped_type, compare_type, policy_type>::clear() {
   btree_.clear();
   size_ = 0;
 }
 
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert(const value_type& value) {
-  std::pair<typename RBTree<key_type, mapped_type, false>::Node*, bool> temp =
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+template <typename ForwardIt>
+void map<key_type, mapped_type, compare_type, policy_type>::assign(
+    ForwardIt first, ForwardIt last, sorted_tag_t) {
+  size_ = btree_.assignSorted(first, last);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          bool>
+map<key_type, mapped_type, compare_type, policy_type>::insert(
+    const value_type& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
       btree_.insert(value);
   if (temp.second) size_++;
-  return std::make_pair(
-      map<key_type, mapped_type>::iterator(temp.first, &btree_), temp.second);
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
 }
 
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert(const key_type& key,
-                                   const mapped_type& obj) {
-  std::pair<typename RBTree<key_type, mapped_type, false>::Node*, bool> temp =
-      btree_.insert(key, obj);
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          bool>
+map<key_type, mapped_type, compare_type, policy_type>::insert(
+    value_type&& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insert(std::move(value));
   if (temp.second) size_++;
-  return std::make_pair(
-      map<key_type, mapped_type>::iterator(temp.first, &btree_), temp.second);
-}
-
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert_or_assign(const key_type& key,
-                                             const mapped_type& obj) {
-  std::pair<typename RBTree<key_type, mapped_type, false>::Node*, bool> temp =
-      btree_.insert(key, obj);
-  if (temp.second)
-    size_++;
-  else
-    temp.first->val_.second = obj;
-  return std::make_pair(
-      map<key_type, mapped_type>::iterator(temp.first, &btree_), temp.second);
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          bool>
+map<key_type, mapped_type, compare_type, policy_type>::insert(
+    const key_type& key, const mapped_type& obj) {
+  return try_emplace(key, obj);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          bool>
+map<key_type, mapped_type, compare_type, policy_type>::insert_or_assign(
+    const key_type& key, const mapped_type& obj) {
+  std::pair<iterator, bool> temp = try_emplace(key, obj);
+  if (!temp.second) (*temp.first).second = obj;
+  return temp;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::insert(
+    const_iterator hint, const value_type& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHint(hint.ptr_, value);
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::insert(
+    const_iterator hint, value_type&& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHint(hint.ptr_, std::move(value));
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+// On failure the node stays in the handle
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          bool>
+map<key_type, mapped_type, compare_type, policy_type>::insert(
+    node_type&& node) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHandle(node);
+  if (temp.second) size_++;
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+// The pair is built right inside the new node
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          bool>
+map<key_type, mapped_type, compare_type, policy_type>::emplace(
+    Args&&... args) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.emplace(std::forward<Args>(args)...);
+  if (temp.second) size_++;
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+template <typename... Args>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::emplace_hint(
+    const_iterator hint, Args&&... args) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.emplaceHint(hint.ptr_, std::forward<Args>(args)...);
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
 }
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::erase(iterator pos) {
-  btree_.remove((*pos).first);
+// Unlike emplace(), leaves args untouched when key is already in the map
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          bool>
+map<key_type, mapped_type, compare_type, policy_type>::try_emplace(
+    const key_type& key, Args&&... args) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.tryEmplace(key, std::forward<Args>(args)...);
+  if (temp.second) size_++;
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          bool>
+map<key_type, mapped_type, compare_type, policy_type>::try_emplace(
+    key_type&& key, Args&&... args) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.tryEmplace(std::move(key), std::forward<Args>(args)...);
+  if (temp.second) size_++;
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+void map<key_type, mapped_type, compare_type, policy_type>::erase(
+    iterator pos) {
+  btree_.removeNode(pos.ptr_);
   size_--;
 }
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::erase(value_type pos) {
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+void map<key_type, mapped_type, compare_type, policy_type>::erase(
+    value_type pos) {
   btree_.remove(pos.first);
   size_--;
 }
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::swap(map& other) {
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+void map<key_type, mapped_type, compare_type, policy_type>::swap(map& other) {
   btree_.swapOtherRoot(other.btree_);
   std::swap(size_, other.size_);
 }
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::merge(map& other) {
-  map<key_type, mapped_type>::iterator itTemp;
-  vector<std::pair<const key_type, mapped_type>> buff;
-  for (map<key_type, mapped_type>::iterator it = other.begin();
-       it != other.end(); ++it) {
-    if (insert(*it).second) {
-      buff.push_back(*it);
-    }
-  }
-  for (auto it : buff) other.erase(it);
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+void map<key_type, mapped_type, compare_type, policy_type>::merge(map& other) {
+  size_type count = btree_.merge(other.btree_);
+  size_ += count;
+  other.size_ -= count;
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::node_type
+map<key_type, mapped_type, compare_type, policy_type>::extract(
+    const_iterator pos) {
+  size_--;
+  return btree_.extract(pos.ptr_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::node_type
+map<key_type, mapped_type, compare_type, policy_type>::extract(
+    const key_type& key) {
+  typename tree_type::Cursor node = btree_.search(key);
+  if (!node) return node_type();
+  size_--;
+  return btree_.extract(node);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+bool map<key_type, mapped_type, compare_type, policy_type>::contains(
+    const key_type& key) {
+  return static_cast<bool>(btree_.search(key));
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+template <typename K, typename>
+bool map<key_type, mapped_type, compare_type, policy_type>::contains(
+    const K& key) {
+  return static_cast<bool>(btree_.search(key));
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::lower_bound(
+    const key_type& key) {
+  return iterator(btree_.lowerBound(key), &btree_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+template <typename K, typename>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::lower_bound(
+    const K& key) {
+  return iterator(btree_.lowerBound(key), &btree_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::upper_bound(
+    const key_type& key) {
+  return iterator(btree_.upperBound(key), &btree_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+std::pair<typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator,
+          typename map<key_type, mapped_type, compare_type,
+                       policy_type>::iterator>
+map<key_type, mapped_type, compare_type, policy_type>::equal_range(
+    const key_type& key) {
+  std::pair<typename tree_type::Cursor, typename tree_type::Cursor>
+      range = btree_.equalRange(key);
+  return std::make_pair(iterator(range.first, &btree_),
+                        iterator(range.second, &btree_));
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::iterator
+map<key_type, mapped_type, compare_type, policy_type>::nth(size_type index) {
+  return iterator(btree_.select(index), &btree_);
+}
+
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+typename map<key_type, mapped_type, compare_type, policy_type>::size_type
+map<key_type, mapped_type, compare_type, policy_type>::rank(
+    const key_type& key) const {
+  return btree_.rank(key);
 }
 
-template <typename key_type, typename mapped_type>
-bool map<key_type, mapped_type>::contains(const key_type& key) {
-  return (btree_.search(key) == nullptr) ? false : true;
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+std::ptrdiff_t map<key_type, mapped_type, compare_type, policy_type>::distance(
+    const_iterator first, const_iterator last) const {
+  return static_cast<std::ptrdiff_t>(btree_.indexOf(last.ptr_)) -
+         static_cast<std::ptrdiff_t>(btree_.indexOf(first.ptr_));
 }
 
-template <typename key_type, typename mapped_type>
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
 template <typename... Args>
-vector<std::pair<typename map<key_type, mapped_type>::iterator, bool>>
-map<key_type, mapped_type>::insert_many(Args&&... args) {
-  vector<std::pair<map<key_type, mapped_type>::iterator, bool>> res;
-  for (auto it : {args...}) res.push_back(insert(it));
+vector<std::pair<typename map<key_type, mapped_type, compare_type,
+                              policy_type>::iterator,
+                 bool>>
+map<key_type, mapped_type, compare_type, policy_type>::insert_many(
+    Args&&... args) {
+  vector<std::pair<iterator, bool>> res;
+  (res.push_back(insert(std::forward<Args>(args))), ...);
   return res;
 }
 }  // namespace s21
@@ -4,13 +4,14 @@
 #include <limits>
 #include <type_traits>
 
+#include "s21_btree.h"
 #include "s21_container.h"
-#include "s21_rbtree.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename KeyT>
+template <typename KeyT, typename Compare = std::less<KeyT>,
+          typename Policy = default_tree_policy>
 class multiset : public IContainer {
  public:
   class MultisetIterator;
@@ -20,22 +21,30 @@ class multiset : public IContainer {
   using value_type = KeyT;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = multiset<key_type>::MultisetIterator;
-  using const_iterator = multiset<key_type>::MultisetConstIterator;
+  using iterator = MultisetIterator;
+  using const_iterator = MultisetConstIterator;
   using typename IContainer::size_type;
+  using key_compare = Compare;
+  using tree_type = tree_engine_t<KeyT, void, true, Compare, Policy>;
+  using node_pool = typename tree_type::pool_type;
+  using node_pool_pointer = typename tree_type::pool_pointer;
+  using node_type = typename tree_type::NodeHandle;
 
  public:
   multiset();
+  explicit multiset(node_pool_pointer pool);
   multiset(std::initializer_list<value_type> const& items);
+  template <typename ForwardIt>
+  multiset(ForwardIt first, ForwardIt last, sorted_tag_t);
   multiset(const multiset& other);
   multiset(multiset&& other) noexcept;
   ~multiset(){};
 
-  multiset<key_type>& operator=(const multiset& other);
-  multiset<key_type>& operator=(multiset&& other);
+  multiset& operator=(const multiset& other);
+  multiset& operator=(multiset&& other);
 
-  bool operator==(const multiset<key_type>& other) const;
-  bool operator!=(const multiset<key_type>& other) const;
+  bool operator==(const multiset& other) const;
+  bool operator!=(const multiset& other) const;
 
   iterator begin();
   const_iterator begin() const;
@@ -45,80 +54,143 @@ class multiset : public IContainer {
   bool empty() const noexcept override { return btree_.isEmpty(); }
   size_type size() const noexcept override { return size_; }
   static size_type max_size();
+  void reserve(size_type count);
+  node_pool_pointer get_node_pool();
+  key_compare key_comp() const { return btree_.keyComp(); }
 
   void clear();
+  template <typename ForwardIt>
+  void assign(ForwardIt first, ForwardIt last, sorted_tag_t);
   iterator insert(const value_type& value);
+  iterator insert(value_type&& value);
+  iterator insert(const_iterator hint, const value_type& value);
+  iterator insert(const_iterator hint, value_type&& value);
+  iterator insert(node_type&& node);
+  template <typename... Args>
+  iterator emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
 
   void erase(iterator pos);
+  size_type erase(const key_type& key);
   void swap(multiset& other);
   void merge(multiset& other);
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type& key);
   iterator find(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  iterator find(const K& key);
   bool contains(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  bool contains(const K& key);
 
   size_type count(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  size_type count(const K& key);
   iterator lower_bound(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  iterator lower_bound(const K& key);
   iterator upper_bound(const key_type& key);
   std::pair<iterator, iterator> equal_range(const key_type& key);
 
+  // Need order_statistic_policy
+  iterator nth(size_type index);
+  size_type rank(const key_type& key) const;
+  std::ptrdiff_t distance(const_iterator first, const_iterator last) const;
+
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
  private:
-  RBTree<KeyT, KeyT, true> btree_;
+  tree_type btree_;
   size_type size_;
 
  private:
-  void erase(value_type pos);
+  size_type countRange(iterator first, iterator last) const;
 };
 
-template <typename key_type>
-std::pair<typename multiset<key_type>::iterator,
-          typename multiset<key_type>::iterator>
-multiset<key_type>::equal_range(const key_type& key) {
-  return std::make_pair(lower_bound(key), upper_bound(key));
+template <typename key_type, typename compare_type, typename policy_type>
+std::pair<typename multiset<key_type, compare_type, policy_type>::iterator,
+          typename multiset<key_type, compare_type, policy_type>::iterator>
+multiset<key_type, compare_type, policy_type>::equal_range(
+    const key_type& key) {
+  std::pair<typename tree_type::Cursor, typename tree_type::Cursor>
+      range = btree_.equalRange(key);
+  return std::make_pair(iterator(range.first, &btree_),
+                        iterator(range.second, &btree_));
 }
 
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::upper_bound(
-    const key_type& key) {
-  iterator res = end();
-  for (iterator it = begin(); it != end(); ++it) {
-    if (*it > key) {
-      res = it;
-      break;
-    }
-  }
-  return res;
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::nth(size_type index) {
+  return iterator(btree_.select(index), &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::size_type
+multiset<key_type, compare_type, policy_type>::rank(const key_type& key) const {
+  return btree_.rank(key);
 }
 
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::lower_bound(
+template <typename key_type, typename compare_type, typename policy_type>
+std::ptrdiff_t multiset<key_type, compare_type, policy_type>::distance(
+    const_iterator first, const_iterator last) const {
+  return static_cast<std::ptrdiff_t>(btree_.indexOf(last.ptr_)) -
+         static_cast<std::ptrdiff_t>(btree_.indexOf(first.ptr_));
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::upper_bound(
     const key_type& key) {
-  iterator res = end();
-  for (iterator it = begin(); it != end(); ++it) {
-    if (*it >= key) {
-      res = it;
-      break;
-    }
-  }
-  return res;
+  return iterator(btree_.upperBound(key), &btree_);
 }
 
-template <typename key_type>
-typename multiset<key_type>::size_type multiset<key_type>::count(
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::lower_bound(
     const key_type& key) {
+  return iterator(btree_.lowerBound(key), &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename K, typename>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::lower_bound(const K& key) {
+  return iterator(btree_.lowerBound(key), &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::size_type
+multiset<key_type, compare_type, policy_type>::count(const key_type& key) {
+  std::pair<iterator, iterator> range = equal_range(key);
+  return countRange(range.first, range.second);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename K, typename>
+typename multiset<key_type, compare_type, policy_type>::size_type
+multiset<key_type, compare_type, policy_type>::count(const K& key) {
+  std::pair<typename tree_type::Cursor, typename tree_type::Cursor>
+      range = btree_.equalRange(key);
+  return countRange(iterator(range.first, &btree_),
+                    iterator(range.second, &btree_));
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::size_type
+multiset<key_type, compare_type, policy_type>::countRange(iterator first,
+                                                          iterator last) const {
+  if constexpr (policy_type::order_statistic)
+    return static_cast<size_type>(distance(first, last));
+
   size_type res = 0;
-  if (iterator it = find(key); it != end()) {
-    while (*it == key) {
-      ++res;
-      ++it;
-    }
-  }
+  for (; first != last; ++first) ++res;
   return res;
 }
 
-template <typename KeyT>
-class multiset<KeyT>::MultisetIterator {
+template <typename KeyT, typename Compare, typename Policy>
+class multiset<KeyT, Compare, Policy>::MultisetIterator {
  public:
   using iterator_category = std::bidirectional_iterator_tag;
   using value_type = KeyT;
@@ -126,18 +198,18 @@ class multiset<KeyT>::MultisetIterator {
   using pointer = value_type*;
   using reference = value_type&;
 
-  using Node = typename RBTree<KeyT, KeyT, true>::Node;
+  using Cursor = typename tree_type::Cursor;
 
  public:
   MultisetIterator() = default;
-  MultisetIterator(Node* ptr, RBTree<KeyT, KeyT, true>* it_btree)
+  MultisetIterator(Cursor ptr, tree_type* it_btree)
       : ptr_(ptr), it_btree_(it_btree) {}
 
   bool operator==(const MultisetIterator& other) { return ptr_ == other.ptr_; }
   bool operator!=(const MultisetIterator& other) { return !(*this == other); }
 
   MultisetIterator& operator++() {
-    ptr_ = RBT_increment(ptr_);
+    ptr_ = it_btree_->getNext(ptr_);
     return *this;
   }
 
@@ -148,7 +220,7 @@ class multiset<KeyT>::MultisetIterator {
   }
 
   MultisetIterator& operator--() {
-    ptr_ = RBT_decrement(ptr_);
+    ptr_ = it_btree_->getPrev(ptr_);
     return *this;
   }
 
@@ -158,19 +230,18 @@ class multiset<KeyT>::MultisetIterator {
     return temp;
   }
 
-  reference operator*() { return ptr_->val_.second; }
+  reference operator*() { return tree_type::valueOf(ptr_); }
 
  private:
-  Node* ptr_ = nullptr;
-  RBTree<KeyT, KeyT, true>* it_btree_ = nullptr;
+  friend class multiset<KeyT, Compare, Policy>;
 
-  Node* RBT_increment(Node* ptr);
-  Node* RBT_decrement(Node* ptr);
+  Cursor ptr_ = Cursor();
+  tree_type* it_btree_ = nullptr;
 };
 
-template <typename KeyT>
-class multiset<KeyT>::MultisetConstIterator
-    : public multiset<KeyT>::MultisetIterator {
+template <typename KeyT, typename Compare, typename Policy>
+class multiset<KeyT, Compare, Policy>::MultisetConstIterator
+    : public multiset<KeyT, Compare, Policy>::MultisetIterator {
  public:
   using value_type = KeyT;
   using const_reference = const value_type&;
@@ -180,86 +251,79 @@ class multiset<KeyT>::MultisetConstIterator
   const_reference operator*() { return MultisetIterator::operator*(); }
 };
 
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::find(
-    const key_type& key) {
-  typename RBTree<key_type, key_type, true>::Node* temp = btree_.search(key);
-  return (!temp) ? end() : multiset<key_type>::iterator(temp, &btree_);
-}
-
-template <typename key_type>
-typename RBTree<key_type, key_type, true>::Node*
-multiset<key_type>::MultisetIterator::RBT_increment(
-    typename RBTree<key_type, key_type, true>::Node* ptr) {
-  if (!it_btree_->isNil(ptr->right_)) {
-    ptr = ptr->right_;
-    while (!it_btree_->isNil(ptr->left_)) ptr = ptr->left_;
-  } else {
-    typename RBTree<key_type, key_type, true>::Node* parent = ptr->parent_;
-    while (ptr == parent->right_) {
-      ptr = parent;
-      parent = parent->parent_;
-    }
-    if (ptr->right_ != parent) ptr = parent;
-  }
-  return ptr;
-}
-
-template <typename key_type>
-typename RBTree<key_type, key_type, true>::Node*
-multiset<key_type>::MultisetIterator::RBT_decrement(
-    typename RBTree<key_type, key_type, true>::Node* ptr) {
-  if (!it_btree_->isNil(ptr->left_)) {
-    ptr = ptr->left_;
-    while (!it_btree_->isNil(ptr->right_)) ptr = ptr->right_;
-  } else {
-    typename RBTree<key_type, key_type, true>::Node* parent = ptr->parent_;
-    while (ptr == parent->left_) {
-      ptr = parent;
-      parent = parent->parent_;
-    }
-    if (ptr->left_ != parent) ptr = parent;
-  }
-  return ptr;
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::find(const key_type& key) {
+  typename tree_type::Cursor temp = btree_.search(key);
+  return (!temp) ? end() : iterator(temp, &btree_);
 }
 
-template <typename key_type>
-bool multiset<key_type>::operator==(const multiset<key_type>& other) const {
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename K, typename>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::find(const K& key) {
+  typename tree_type::Cursor temp = btree_.search(key);
+  return (!temp) ? end() : iterator(temp, &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+bool multiset<key_type, compare_type, policy_type>::operator==(
+    const multiset<key_type, compare_type, policy_type>& other) const {
   if (this == &other) return true;
   if (size() != other.size()) return false;
 
   return (std::equal(begin(), end(), other.begin()));
 }
 
-template <typename key_type>
-bool multiset<key_type>::operator!=(const multiset<key_type>& other) const {
+template <typename key_type, typename compare_type, typename policy_type>
+bool multiset<key_type, compare_type, policy_type>::operator!=(
+    const multiset<key_type, compare_type, policy_type>& other) const {
   return !(*this == other);
 }
 
-template <typename key_type>
-typename multiset<key_type>::size_type multiset<key_type>::max_size() {
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::size_type
+multiset<key_type, compare_type, policy_type>::max_size() {
   return std::numeric_limits<size_type>::max() /
-         sizeof(typename RBTree<key_type, key_type, true>::Node) / 4294967296;
+         sizeof(typename tree_type::Node) / 4294967296;
 }
 
-template <typename key_type>
-multiset<key_type>::multiset() : btree_(), size_(0) {}
+template <typename key_type, typename compare_type, typename policy_type>
+multiset<key_type, compare_type, policy_type>::multiset()
+    : btree_(), size_(0) {}
+
+template <typename key_type, typename compare_type, typename policy_type>
+multiset<key_type, compare_type, policy_type>::multiset(node_pool_pointer pool)
+    : btree_(std::move(pool)), size_(0) {}
 
-template <typename key_type>
-multiset<key_type>::multiset(std::initializer_list<value_type> const& items)
+template <typename key_type, typename compare_type, typename policy_type>
+multiset<key_type, compare_type, policy_type>::multiset(
+    std::initializer_list<value_type> const& items)
     : btree_(), size_(0) {
+  btree_.reserve(items.size());
   for (const_reference p : items)
-    if (btree_.insert(std::make_pair(p, p)).second) size_++;
+    if (btree_.insert(p).second) size_++;
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename ForwardIt>
+multiset<key_type, compare_type, policy_type>::multiset(ForwardIt first,
+                                                        ForwardIt last,
+                                                        sorted_tag_t)
+    : btree_(), size_(0) {
+  size_ = btree_.assignSorted(first, last);
 }
 
-template <typename key_type>
-multiset<key_type>::multiset(const multiset& other)
+template <typename key_type, typename compare_type, typename policy_type>
+multiset<key_type, compare_type, policy_type>::multiset(const multiset& other)
     : btree_(), size_(other.size_) {
-  for (auto it : other) this->btree_.insert(std::make_pair(it, it));
+  btree_.reserve(other.size_);
+  for (const_reference it : other) this->btree_.insert(it);
 }
 
-template <typename key_type>
-multiset<key_type>::multiset(multiset&& other) noexcept
+template <typename key_type, typename compare_type, typename policy_type>
+multiset<key_type, compare_type, policy_type>::multiset(
+    multiset&& other) noexcept
     : btree_(other.btree_), size_(other.size_) {
   if (this != &other) {
     other.btree_.makeNullRoot();
@@ -267,18 +331,21 @@ multiset<key_type>::multiset(multiset&& other) noexcept
   }
 }
 
-template <typename key_type>
-multiset<key_type>& multiset<key_type>::operator=(const multiset& other) {
+template <typename key_type, typename compare_type, typename policy_type>
+multiset<key_type, compare_type, policy_type>&
+multiset<key_type, compare_type, policy_type>::operator=(
+    const multiset& other) {
   size_ = other.size_;
-  for (auto it : other) this->btree_.insert(std::make_pair(it, it));
+  for (const_reference it : other) this->btree_.insert(it);
 
   return *this;
 }
 
-template <typename key_type>
-multiset<key_type>& multiset<key_type>::operator=(multiset&& other) {
+template <typename key_type, typename compare_type, typename policy_type>
+multiset<key_type, compare_type, policy_type>&
+multiset<key_type, compare_type, policy_type>::operator=(multiset&& other) {
   if (this == &other) return *this;
-  multiset<key_type> temp = std::move(*this);
+  multiset<key_type, compare_type, policy_type> temp = std::move(*this);
   btree_ = other.btree_;
   size_ = other.size_;
 
@@ -288,85 +355,194 @@ multiset<key_type>& multiset<key_type>::operator=(multiset&& other) {
   return *this;
 }
 
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::begin() {
-  multiset<key_type>::iterator it(btree_.getMin(), &btree_);
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::begin() {
+  iterator it(btree_.getMin(), &btree_);
   return it;
 }
 
-template <typename key_type>
-typename multiset<key_type>::const_iterator multiset<key_type>::begin() const {
-  MultisetIterator it(btree_.getMin(),
-                      const_cast<RBTree<key_type, key_type, true>*>(&btree_));
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::const_iterator
+multiset<key_type, compare_type, policy_type>::begin() const {
+  MultisetIterator it(btree_.getMin(), const_cast<tree_type*>(&btree_));
   return MultisetConstIterator(it);
 }
 
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::end() {
-  multiset<key_type>::iterator it(btree_.getMax(), &btree_);
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::end() {
+  iterator it(btree_.getMax(), &btree_);
   return it;
 }
 
-template <typename key_type>
-typename multiset<key_type>::const_iterator multiset<key_type>::end() const {
-  MultisetIterator it(btree_.getMax(),
-                      const_cast<RBTree<key_type, key_type, true>*>(&btree_));
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::const_iterator
+multiset<key_type, compare_type, policy_type>::end() const {
+  MultisetIterator it(btree_.getMax(), const_cast<tree_type*>(&btree_));
   return MultisetConstIterator(it);
 }
 
-template <typename key_type>
-void multiset<key_type>::clear() {
+template <typename key_type, typename compare_type, typename policy_type>
+void multiset<key_type, compare_type, policy_type>::reserve(size_type count) {
+  if (count > size_) btree_.reserve(count - size_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::node_pool_pointer
+multiset<key_type, compare_type, policy_type>::get_node_pool() {
+  return btree_.getPool();
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+void multiset<key_type, compare_type, policy_type>::clear() {
   btree_.clear();
   size_ = 0;
 }
 
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::insert(
-    const value_type& value) {
-  std::pair<typename RBTree<key_type, key_type, true>::Node*, bool> temp =
-      btree_.insert(std::make_pair(value, value));
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename ForwardIt>
+void multiset<key_type, compare_type, policy_type>::assign(ForwardIt first,
+                                                           ForwardIt last,
+                                                           sorted_tag_t) {
+  size_ = btree_.assignSorted(first, last);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::insert(const value_type& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insert(value);
   if (temp.second) size_++;
-  return multiset<key_type>::iterator(temp.first, &btree_);
+  return iterator(temp.first, &btree_);
 }
 
-template <typename key_type>
-void multiset<key_type>::erase(iterator pos) {
-  btree_.remove(*pos);
-  size_--;
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::insert(value_type&& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insert(std::move(value));
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::insert(const_iterator hint,
+                                                      const value_type& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHint(hint.ptr_, value);
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::insert(const_iterator hint,
+                                                      value_type&& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHint(hint.ptr_, std::move(value));
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::insert(node_type&& node) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHandle(node);
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+// The key is built right inside the new node
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename... Args>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::emplace(Args&&... args) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.emplace(std::forward<Args>(args)...);
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
 }
 
-template <typename key_type>
-void multiset<key_type>::erase(value_type pos) {
-  btree_.remove(pos);
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename... Args>
+typename multiset<key_type, compare_type, policy_type>::iterator
+multiset<key_type, compare_type, policy_type>::emplace_hint(const_iterator hint,
+                                                            Args&&... args) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.emplaceHint(hint.ptr_, std::forward<Args>(args)...);
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+void multiset<key_type, compare_type, policy_type>::erase(iterator pos) {
+  btree_.removeNode(pos.ptr_);
   size_--;
 }
 
-template <typename key_type>
-void multiset<key_type>::swap(multiset& other) {
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::size_type
+multiset<key_type, compare_type, policy_type>::erase(const key_type& key) {
+  std::pair<typename tree_type::Cursor, typename tree_type::Cursor>
+      range = btree_.equalRange(key);
+  size_type res = btree_.removeRange(range.first, range.second, size_);
+  size_ -= res;
+  return res;
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+void multiset<key_type, compare_type, policy_type>::swap(multiset& other) {
   btree_.swapOtherRoot(other.btree_);
   std::swap(size_, other.size_);
 }
 
-template <typename key_type>
-void multiset<key_type>::merge(multiset& other) {
-  multiset<key_type>::iterator itTemp;
-  for (auto it : other) {
-    insert(it);
-  }
-  other.clear();
+template <typename key_type, typename compare_type, typename policy_type>
+void multiset<key_type, compare_type, policy_type>::merge(multiset& other) {
+  size_type count = btree_.merge(other.btree_);
+  size_ += count;
+  other.size_ -= count;
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::node_type
+multiset<key_type, compare_type, policy_type>::extract(const_iterator pos) {
+  size_--;
+  return btree_.extract(pos.ptr_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename multiset<key_type, compare_type, policy_type>::node_type
+multiset<key_type, compare_type, policy_type>::extract(const key_type& key) {
+  typename tree_type::Cursor node = btree_.search(key);
+  if (!node) return node_type();
+  size_--;
+  return btree_.extract(node);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+bool multiset<key_type, compare_type, policy_type>::contains(
+    const key_type& key) {
+  return static_cast<bool>(btree_.search(key));
 }
 
-template <typename key_type>
-bool multiset<key_type>::contains(const key_type& key) {
-  return (btree_.search(key) == nullptr) ? false : true;
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename K, typename>
+bool multiset<key_type, compare_type, policy_type>::contains(const K& key) {
+  return static_cast<bool>(btree_.search(key));
 }
 
-template <typename key_type>
+template <typename key_type, typename compare_type, typename policy_type>
 template <typename... Args>
-vector<std::pair<typename multiset<key_type>::iterator, bool>>
-multiset<key_type>::insert_many(Args&&... args) {
-  vector<std::pair<multiset<key_type>::iterator, bool>> res;
-  for (auto it : {args...}) res.push_back(std::make_pair(insert(it), true));
+vector<std::pair<typename multiset<key_type, compare_type,
+                                   policy_type>::iterator,
+                 bool>>
+multiset<key_type, compare_type, policy_type>::insert_many(Args&&... args) {
+  vector<std::pair<iterator, bool>> res;
+  (res.push_back(std::make_pair(insert(std::forward<Args>(args)), true)),
+   ...);
   return res;
 }
 }  // namespace s21
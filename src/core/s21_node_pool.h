@@ -0,0 +1,161 @@
+#ifndef SRC_CORE_S21_NODE_POOL_H_
+#define SRC_CORE_S21_NODE_POOL_H_
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+
+/*
+  NodePool hands out fixed-size storage slots for the nodes of a tree.
+
+  Slots are carved from contiguous chunks and recycled through an intrusive
+  free list, so insert/erase churn stays away from the system allocator once
+  the pool is warm. The pool manages raw storage only: constructing and
+  destroying the objects placed into a slot is up to the owner.
+
+  - allocate(): returns storage for one T.
+  - deallocate(ptr): returns a slot obtained from allocate() to the pool.
+  - reserve(count): makes sure the next count allocations are served
+    without requesting memory from the system.
+  - release(): takes back every slot handed out, in time proportional to
+    the number of chunks. The objects in them must be destroyed first.
+
+  Chunks are returned to the system only when the pool itself is
+  destroyed.
+*/
+
+template <typename T>
+class NodePool {
+ public:
+  using size_type = std::size_t;
+
+ public:
+  NodePool() noexcept = default;
+  NodePool(const NodePool& other) = delete;
+  NodePool(NodePool&& other) = delete;
+  ~NodePool();
+
+  NodePool& operator=(const NodePool& other) = delete;
+  NodePool& operator=(NodePool&& other) = delete;
+
+  void* allocate();
+  void deallocate(void* ptr) noexcept;
+
+  void reserve(size_type count);
+  void release() noexcept;
+  size_type capacity() const noexcept { return capacity_; }
+  size_type available() const noexcept;
+
+ private:
+  union Slot;
+  struct ChunkHeader {
+    Slot* prev_;
+    std::size_t slots_;
+  };
+  union Slot {
+    Slot* next_;
+    ChunkHeader chunk_;
+    alignas(T) std::byte storage_[sizeof(T)];
+  };
+
+  static constexpr size_type kMinChunkSlots = 32;
+  static constexpr size_type kMaxChunkSlots = 4096;
+
+  // The first slot of every chunk is a header linking it to the previous
+  // one. After release() the chunks from spare_ on are handed out again
+  // one by one, before any new chunk is allocated.
+  Slot* chunks_ = nullptr;
+  Slot* spare_ = nullptr;
+  Slot* freeList_ = nullptr;
+  Slot* bumpBegin_ = nullptr;
+  Slot* bumpEnd_ = nullptr;
+  size_type freeCount_ = 0;
+  size_type spareCount_ = 0;
+  size_type capacity_ = 0;
+  size_type nextChunkSlots_ = kMinChunkSlots;
+
+ private:
+  void addChunk(size_type slots);
+};
+
+template <typename T>
+NodePool<T>::~NodePool() {
+  while (chunks_ != nullptr) {
+    Slot* prev = chunks_->chunk_.prev_;
+    delete[] chunks_;
+    chunks_ = prev;
+  }
+}
+
+template <typename T>
+typename NodePool<T>::size_type NodePool<T>::available() const noexcept {
+  return freeCount_ + spareCount_ +
+         static_cast<size_type>(bumpEnd_ - bumpBegin_);
+}
+
+template <typename T>
+void* NodePool<T>::allocate() {
+  if (freeList_ != nullptr) {
+    Slot* slot = freeList_;
+    freeList_ = slot->next_;
+    --freeCount_;
+    return slot;
+  }
+
+  if (bumpBegin_ == bumpEnd_) {
+    if (spare_ != nullptr) {
+      bumpBegin_ = spare_ + 1;
+      bumpEnd_ = bumpBegin_ + spare_->chunk_.slots_;
+      spareCount_ -= spare_->chunk_.slots_;
+      spare_ = spare_->chunk_.prev_;
+    } else {
+      addChunk(nextChunkSlots_);
+    }
+  }
+  return bumpBegin_++;
+}
+
+template <typename T>
+void NodePool<T>::deallocate(void* ptr) noexcept {
+  Slot* slot = static_cast<Slot*>(ptr);
+  slot->next_ = freeList_;
+  freeList_ = slot;
+  ++freeCount_;
+}
+
+template <typename T>
+void NodePool<T>::reserve(size_type count) {
+  size_type free = available();
+  if (free < count) addChunk(count - free);
+}
+
+// Forgets the free list and starts handing out all chunks anew
+template <typename T>
+void NodePool<T>::release() noexcept {
+  freeList_ = nullptr;
+  freeCount_ = 0;
+  bumpBegin_ = bumpEnd_ = nullptr;
+  spare_ = chunks_;
+  spareCount_ = capacity_;
+}
+
+template <typename T>
+void NodePool<T>::addChunk(size_type slots) {
+  Slot* chunk = new Slot[slots + 1];
+  chunk->chunk_.prev_ = chunks_;
+  chunk->chunk_.slots_ = slots;
+  chunks_ = chunk;
+
+  // Untouched tail of the previous chunk goes to the free list
+  for (; bumpBegin_ != bumpEnd_; ++bumpBegin_) deallocate(bumpBegin_);
+
+  bumpBegin_ = chunk + 1;
+  bumpEnd_ = bumpBegin_ + slots;
+  capacity_ += slots;
+  nextChunkSlots_ = std::min(nextChunkSlots_ * 2, kMaxChunkSlots);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_NODE_POOL_H_
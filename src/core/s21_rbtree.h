@@ -2,488 +2,1391 @@
 #define SRC_CORE_S21_RBTREE_H_
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_node_pool.h"
 
 namespace s21 {
-template <typename KeyT, typename ValT, bool multi_type>
+
+// Selects the constructors and assign() overloads of the tree based
+// containers that take a range already sorted by key
+struct sorted_tag_t {
+  explicit sorted_tag_t() = default;
+};
+inline constexpr sorted_tag_t sorted_tag{};
+
+// Enables the lookup overloads taking any key type K for comparators that
+// declare is_transparent, like std::less<>
+template <typename Compare, typename K, typename = void>
+struct transparent_key {};
+template <typename Compare, typename K>
+struct transparent_key<Compare, K,
+                       std::void_t<typename Compare::is_transparent>> {
+  using type = K;
+};
+template <typename Compare, typename K>
+using transparent_key_t = typename transparent_key<Compare, K>::type;
+
+/*
+  Node augmentation policies of the tree based containers.
+
+  order_statistic_policy keeps the size of every subtree in its root node.
+  It costs one word per node and a little work on every insert, erase and
+  rotation, and makes nth(), rank() and distance() logarithmic.
+
+  threaded_tree_policy links every node to its in-order neighbours, with
+  end() closing the list between the greatest and the least key.
+  It costs two words per node and makes ++ and -- of the iterators a
+  single pointer load instead of a walk over parent links.
+
+  A policy with both flags set gets both augmentations.
+*/
+struct default_tree_policy {
+  static constexpr bool order_statistic = false;
+  static constexpr bool threaded = false;
+};
+struct order_statistic_policy {
+  static constexpr bool order_statistic = true;
+  static constexpr bool threaded = false;
+};
+struct threaded_tree_policy {
+  static constexpr bool order_statistic = false;
+  static constexpr bool threaded = true;
+};
+
+template <typename KeyT, typename ValT, bool multi_type,
+          typename Compare = std::less<KeyT>,
+          typename Policy = default_tree_policy>
 class RBTree {
  private:
   enum class NodeColor { BLACK, RED };
 
+  static constexpr bool kOrderStatistic = Policy::order_statistic;
+  static constexpr bool kThreaded = Policy::threaded;
+  static constexpr bool kKeyOnly = std::is_void_v<ValT>;
+  static constexpr std::uintptr_t kRedBit = 1;
+
+  struct NodeBase {};
+  struct SizedNodeBase {
+    std::size_t size_ = 0;
+  };
+  struct UnlinkedNodeBase {};
+  template <typename N>
+  struct LinkedNodeBase {
+    N* prev_;
+    N* next_;
+  };
+
  public:
-  struct Node {
+  // A void ValT makes the nodes of set-like trees store the key only
+  using value_type =
+      std::conditional_t<kKeyOnly, KeyT, std::pair<const KeyT, ValT>>;
+
+  struct Node
+      : std::conditional_t<kOrderStatistic, SizedNodeBase, NodeBase>,
+        std::conditional_t<kThreaded, LinkedNodeBase<Node>, UnlinkedNodeBase> {
     Node* left_;
     Node* right_;
-    Node* parent_;
-    NodeColor color_ = NodeColor::BLACK;
-    std::pair<const KeyT, ValT> val_;
-
-    Node() : left_(nullptr), right_(nullptr), parent_(nullptr) {}
-    Node(std::pair<const KeyT, ValT> pair, Node* node)
+    // The parent link, with the color in its lowest bit: nodes are aligned
+    // to a pointer, so that bit of their address is always clear
+    std::uintptr_t parentColor_;
+    // Left unconstructed in the nil node only
+    union {
+      value_type val_;
+    };
+
+    // The nil node: black, without a value
+    Node() : left_(nullptr), right_(nullptr), parentColor_(0) {
+      if constexpr (kThreaded) this->prev_ = this->next_ = nullptr;
+    }
+    // Builds the value in place from args, so nothing is copied on the way
+    template <typename... Args>
+    explicit Node(Node* node, Args&&... args)
         : left_(node),
           right_(node),
-          parent_(node),
-          color_(NodeColor::RED),
-          val_(pair) {}
+          parentColor_(reinterpret_cast<std::uintptr_t>(node) | kRedBit),
+          val_(std::forward<Args>(args)...) {
+      if constexpr (kOrderStatistic) this->size_ = 1;
+    }
+    ~Node() { val_.~value_type(); }
+
+    Node* parent() const {
+      return reinterpret_cast<Node*>(parentColor_ & ~kRedBit);
+    }
+    void setParent(Node* parent) {
+      parentColor_ =
+          reinterpret_cast<std::uintptr_t>(parent) | (parentColor_ & kRedBit);
+    }
+    NodeColor color() const {
+      return (parentColor_ & kRedBit) ? NodeColor::RED : NodeColor::BLACK;
+    }
+    void setColor(NodeColor color) {
+      parentColor_ = (parentColor_ & ~kRedBit) |
+                     (color == NodeColor::RED ? kRedBit : 0);
+    }
+
+    const KeyT& key() const { return keyOf(val_); }
+  };
+
+ public:
+  // Position of an element, shared with BTree: the node holding it
+  using Cursor = Node*;
+  using size_type = std::size_t;
+  using pool_type = NodePool<Node>;
+  using pool_pointer = std::shared_ptr<pool_type>;
+
+  // Owns a node taken out of a tree by extract() until it is inserted into
+  // a tree again or destroyed. The pool of the node is kept alive with it.
+  class NodeHandle {
+   public:
+    NodeHandle() noexcept = default;
+    NodeHandle(const NodeHandle& other) = delete;
+    NodeHandle(NodeHandle&& other) noexcept
+        : node_(other.node_), pool_(std::move(other.pool_)) {
+      other.node_ = nullptr;
+    }
+    ~NodeHandle() { reset(); }
+
+    NodeHandle& operator=(const NodeHandle& other) = delete;
+    NodeHandle& operator=(NodeHandle&& other) noexcept {
+      if (this != &other) {
+        reset();
+        node_ = other.node_;
+        pool_ = std::move(other.pool_);
+        other.node_ = nullptr;
+      }
+      return *this;
+    }
+
+    bool empty() const noexcept { return node_ == nullptr; }
+    explicit operator bool() const noexcept { return !empty(); }
+    const KeyT& key() const { return node_->key(); }
+    value_type& value() const { return node_->val_; }
+    auto& mapped() const { return node_->val_.second; }
+
+   private:
+    friend class RBTree;
+
+    NodeHandle(Node* node, pool_pointer pool) noexcept
+        : node_(node), pool_(std::move(pool)) {}
+
+    void reset() noexcept {
+      if (node_ != nullptr) {
+        node_->~Node();
+        pool_->deallocate(node_);
+        node_ = nullptr;
+      }
+      pool_.reset();
+    }
+
+    Node* node_ = nullptr;
+    pool_pointer pool_;
   };
 
  private:
-  Node* nil_ = new Node();
+  // Shared by all trees of this type, see sentinel()
+  Node* nil_ = sentinel();
   Node* root_;
+  Node* leftmost_;
+  Node* rightmost_;
+  pool_pointer pool_;
+  Compare compare_;
 
  public:
-  RBTree() : root_(nil_) {}
-  RBTree(std::pair<const KeyT, ValT> pair) : root_(new Node(pair, nil_)) {}
+  RBTree() : root_(nil_), leftmost_(nil_), rightmost_(nil_) {}
+  explicit RBTree(pool_pointer pool)
+      : root_(nil_),
+        leftmost_(nil_),
+        rightmost_(nil_),
+        pool_(std::move(pool)) {}
   ~RBTree();
 
   bool isNil(Node* node) const { return node == nil_; }
   bool isEmpty() const { return root_ == nil_; }
-
-  std::pair<Node*, bool> insert(const std::pair<const KeyT, ValT>& pair);
-  std::pair<Node*, bool> insert(const KeyT& key);
-  std::pair<Node*, bool> insert(const KeyT& key, const ValT& obj);
-  void remove(const KeyT& key) { removeNode(key); }
-
-  Node* search(const KeyT& key) const { return search(root_, key); }
+  Compare keyComp() const { return compare_; }
+
+  template <typename V>
+  std::pair<Node*, bool> insert(V&& value);
+  template <typename V>
+  std::pair<Node*, bool> insertHint(Node* hint, V&& value);
+  template <typename... Args>
+  std::pair<Node*, bool> emplace(Args&&... args);
+  template <typename... Args>
+  std::pair<Node*, bool> emplaceHint(Node* hint, Args&&... args);
+  template <typename K, typename... Args>
+  std::pair<Node*, bool> tryEmplace(K&& key, Args&&... args);
+  void remove(const KeyT& key);
+  void removeNode(Node* node);
+  NodeHandle extract(Node* node);
+  std::pair<Node*, bool> insertHandle(NodeHandle& handle);
+  size_type merge(RBTree& other);
+  size_type removeRange(Node* first, Node* last, size_type treeSize);
+
+  template <typename ForwardIt>
+  size_type assignSorted(ForwardIt first, ForwardIt last);
+
+  // Lookups take any key type the comparator accepts next to KeyT
+  template <typename K>
+  Node* search(const K& key) const;
+  template <typename K>
+  Node* lowerBound(const K& key) const;
+  template <typename K>
+  Node* upperBound(const K& key) const;
+  template <typename K>
+  std::pair<Node*, Node*> equalRange(const K& key) const;
+
+  Node* select(size_type index) const;
+  size_type rank(const KeyT& key) const;
+  size_type indexOf(Node* node) const;
   Node* getMin() const;
   Node* getMax() const;
 
   Node* getMin(Node* node) const;
   Node* getMax(Node* node) const;
 
+  Node* getNext(Node* node) const;
+  Node* getPrev(Node* node) const;
+
+  static value_type& valueOf(Node* node) { return node->val_; }
+
+  pool_pointer getPool();
+  void reserve(size_type count) { getPool()->reserve(count); }
+
   void makeNullRoot();
   void clear();
   void printTree() { printTree(root_); }
   void swapOtherRoot(RBTree& other);
 
  private:
-  std::pair<Node*, bool> insertNode(const KeyT& key, const ValT& obj);
+  static Node* sentinel();
+  template <typename... Args>
+  Node* createNode(Args&&... args);
+  void destroyNode(Node* node) noexcept;
+
+  template <typename K>
+  Node* findSlot(const K& key, bool& toLeft, Node*& equal) const;
+  template <typename K>
+  Node* findHintSlot(Node* hint, const K& key, bool& toLeft,
+                     Node*& equal) const;
+  template <typename... Args>
+  Node* attachNode(Node* parent, bool toLeft, Args&&... args);
+  Node* linkNode(Node* parent, bool toLeft, Node* newNode);
+  void detachNode(Node* node);
+  void linkChain(Node* head, Node* tail, size_type count);
+  Node* linkSorted(size_type count, size_type depth, size_type redDepth,
+                   Node*& chain);
+  Node* flattenTree(Node* node, Node* chain);
+
+  template <typename T1, typename T2>
+  static const T1& keyOf(const std::pair<T1, T2>& value) {
+    return value.first;
+  }
+  static const KeyT& keyOf(const KeyT& key) { return key; }
+
   void balanceInsert(Node* newNode);
-  void removeNode(const KeyT& key);
-  void balanceRemove(Node* node);
+  void balanceRemove(Node* node, Node* parent);
   void rightRotate(Node* node);
   void leftRotate(Node* node);
+  void growPath(Node* node);
+  void shrinkPath(Node* node);
+  void updateRotated(Node* node);
 
-  Node* search(Node* node, const KeyT& key) const;
-  Node* getChildOrMock(Node* node);
-  int getChildrenCount(Node* node);
   void transplateNode(Node* dest, Node* src);
 
-  void swap(Node* a, Node* b);
-  void swapValue(Node* dest, Node* src);
-
   void printTree(Node* node);
-  void deleteTree(Node* node);
+  void deleteTree(Node* node, bool toPool);
+  void releaseNodes() noexcept;
 };
 
-template <typename KeyT, typename ValT, bool multi_type>
-std::pair<typename RBTree<KeyT, ValT, multi_type>::Node*, bool>
-RBTree<KeyT, ValT, multi_type>::insert(const KeyT& key, const ValT& obj) {
-  return insertNode(key, obj);
+/*
+  Finds the leaf slot for key: returns its parent and sets toLeft to the
+  side. For unique trees equal is set to the node already holding key, or
+  to nil when there is none.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::findSlot(const K& key,
+                                                          bool& toLeft,
+                                                          Node*& equal) const {
+  Node* parent = nil_;
+  Node* notGreater = nil_;
+  toLeft = true;
+  for (Node* current = root_; !isNil(current);) {
+    parent = current;
+    toLeft = compare_(key, current->key());
+    if (toLeft) {
+      current = current->left_;
+    } else {
+      notGreater = current;
+      current = current->right_;
+    }
+  }
+
+  // The last node we turned right at is the greatest one not above key,
+  // so it is the only node that can hold an equal key
+  equal = nil_;
+  if (!multi_type && !isNil(notGreater) && !compare_(notGreater->key(), key))
+    equal = notGreater;
+  return parent;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename V>
+std::pair<typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*, bool>
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::insert(V&& value) {
+  bool toLeft;
+  Node* equal;
+  Node* parent = findSlot(keyOf(value), toLeft, equal);
+  if (!isNil(equal)) return std::make_pair(equal, false);
+  return std::make_pair(attachNode(parent, toLeft, std::forward<V>(value)),
+                        true);
+}
+
+// The key is only known once the value is built, so the node is made first
+// and dropped again when a unique tree already holds its key
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename... Args>
+std::pair<typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*, bool>
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::emplace(Args&&... args) {
+  Node* newNode = createNode(nil_, std::forward<Args>(args)...);
+  bool toLeft;
+  Node* equal;
+  Node* parent = findSlot(newNode->key(), toLeft, equal);
+  if (!isNil(equal)) {
+    destroyNode(newNode);
+    return std::make_pair(equal, false);
+  }
+  return std::make_pair(linkNode(parent, toLeft, newNode), true);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-std::pair<typename RBTree<KeyT, ValT, multi_type>::Node*, bool>
-RBTree<KeyT, ValT, multi_type>::insert(const KeyT& key) {
-  ValT defaultValue = ValT();
-  return insertNode(key, defaultValue);
+// Builds the mapped value from args only when key is not in the tree yet
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K, typename... Args>
+std::pair<typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*, bool>
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::tryEmplace(K&& key,
+                                                            Args&&... args) {
+  static_assert(!kKeyOnly, "tryEmplace() needs a mapped value");
+  bool toLeft;
+  Node* equal;
+  Node* parent = findSlot(key, toLeft, equal);
+  if (!isNil(equal)) return std::make_pair(equal, false);
+  return std::make_pair(
+      attachNode(parent, toLeft, std::piecewise_construct,
+                 std::forward_as_tuple(std::forward<K>(key)),
+                 std::forward_as_tuple(std::forward<Args>(args)...)),
+      true);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-std::pair<typename RBTree<KeyT, ValT, multi_type>::Node*, bool>
-RBTree<KeyT, ValT, multi_type>::insert(
-    const std::pair<const KeyT, ValT>& pair) {
-  return insertNode(pair.first, pair.second);
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::pool_pointer
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::getPool() {
+  if (!pool_) pool_ = std::make_shared<pool_type>();
+  return pool_;
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-typename RBTree<KeyT, ValT, multi_type>::Node*
-RBTree<KeyT, ValT, multi_type>::getChildOrMock(
-    typename RBTree<KeyT, ValT, multi_type>::Node* node) {
-  return isNil(node->left_) ? node->right_ : node->left_;
+/*
+  The nil node that all trees of one type share as their leaves and end().
+  It is built once in static storage and never destroyed. No tree writes to
+  it, so an empty tree allocates nothing and trees on different threads can
+  use it at the same time.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::sentinel() {
+  alignas(Node) static std::byte storage[sizeof(Node)];
+  static Node* nil = new (storage) Node();
+  return nil;
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::makeNullRoot() {
-  root_ = nullptr;
-  nil_ = nullptr;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename... Args>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::createNode(Args&&... args) {
+  if (!pool_) pool_ = std::make_shared<pool_type>();
+  void* place = pool_->allocate();
+  try {
+    return new (place) Node(std::forward<Args>(args)...);
+  } catch (...) {
+    pool_->deallocate(place);
+    throw;
+  }
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::swapOtherRoot(
-    RBTree<KeyT, ValT, multi_type>& other) {
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::destroyNode(
+    Node* node) noexcept {
+  node->~Node();
+  pool_->deallocate(node);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::makeNullRoot() {
+  root_ = nil_;
+  leftmost_ = nil_;
+  rightmost_ = nil_;
+  pool_.reset();
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::swapOtherRoot(
+    RBTree<KeyT, ValT, multi_type, Compare, Policy>& other) {
   std::swap(root_, other.root_);
-  std::swap(nil_, other.nil_);
+  std::swap(leftmost_, other.leftmost_);
+  std::swap(rightmost_, other.rightmost_);
+  std::swap(pool_, other.pool_);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-RBTree<KeyT, ValT, multi_type>::~RBTree() {
-  deleteTree(root_);
-  delete nil_;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::~RBTree() {
+  releaseNodes();
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-std::pair<typename RBTree<KeyT, ValT, multi_type>::Node*, bool>
-RBTree<KeyT, ValT, multi_type>::insertNode(const KeyT& key, const ValT& value) {
-  Node* checkNode = search(key);
-  if (checkNode != nullptr && (!multi_type))
-    return std::make_pair(checkNode, false);
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename... Args>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::attachNode(Node* parent,
+                                                            bool toLeft,
+                                                            Args&&... args) {
+  Node* newNode = createNode(nil_, std::forward<Args>(args)...);
+  return linkNode(parent, toLeft, newNode);
+}
 
-  Node* currentNode = root_;
-  Node* parent = nil_;
-  while (!isNil(currentNode)) {
-    parent = currentNode;
-    (key < currentNode->val_.first) ? currentNode = currentNode->left_
-                                    : currentNode = currentNode->right_;
-  }
-  Node* newNode = new Node(std::make_pair(key, value), nil_);
-  newNode->parent_ = parent;
-  if (parent == nil_)
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::linkNode(Node* parent,
+                                                          bool toLeft,
+                                                          Node* newNode) {
+  newNode->left_ = nil_;
+  newNode->right_ = nil_;
+  newNode->setParent(parent);
+  newNode->setColor(NodeColor::RED);
+  if constexpr (kOrderStatistic) newNode->size_ = 1;
+  if constexpr (kThreaded) {
+    Node* next = (toLeft || isNil(parent)) ? parent : parent->next_;
+    Node* prev = isNil(next) ? rightmost_ : next->prev_;
+    newNode->next_ = next;
+    newNode->prev_ = prev;
+    if (!isNil(prev)) prev->next_ = newNode;
+    if (!isNil(next)) next->prev_ = newNode;
+  }
+  if (isNil(parent)) {
     root_ = newNode;
-  else if (key < parent->val_.first)
+    leftmost_ = newNode;
+    rightmost_ = newNode;
+  } else if (toLeft) {
     parent->left_ = newNode;
-  else
+    if (parent == leftmost_) leftmost_ = newNode;
+  } else {
     parent->right_ = newNode;
+    if (parent == rightmost_) rightmost_ = newNode;
+  }
+  growPath(parent);
   balanceInsert(newNode);
-  return std::make_pair(newNode, true);
+  return newNode;
+}
+
+/*
+  Replaces the content with the elements of a range sorted by key. The
+  nodes are created in one pass (the pool is reserved for all of them up
+  front) and then linked into a perfectly balanced tree in O(n) without any
+  rotation. Duplicate keys are skipped for unique trees. A range that turns
+  out not to be sorted is inserted element by element instead.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename ForwardIt>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::assignSorted(ForwardIt first,
+                                                              ForwardIt last) {
+  clear();
+
+  size_type count = 0;
+  bool sorted = true;
+  ForwardIt prev = first;
+  for (ForwardIt it = first; it != last && sorted; prev = it++) {
+    if (it != first) {
+      sorted = !compare_(keyOf(*it), keyOf(*prev));
+      if (!multi_type && !compare_(keyOf(*prev), keyOf(*it))) continue;
+    }
+    ++count;
+  }
+
+  if (!sorted) {
+    count = 0;
+    for (; first != last; ++first)
+      if (insert(*first).second) ++count;
+    return count;
+  }
+
+  getPool()->reserve(count);
+  Node* head = nil_;
+  Node* tail = nil_;
+  try {
+    prev = first;
+    for (ForwardIt it = first; it != last; prev = it++) {
+      if (!multi_type && it != first && !compare_(keyOf(*prev), keyOf(*it)))
+        continue;
+      Node* node = createNode(nil_, *it);
+      if (isNil(tail))
+        head = node;
+      else
+        tail->right_ = node;
+      tail = node;
+    }
+  } catch (...) {
+    while (!isNil(head)) {
+      Node* next = head->right_;
+      destroyNode(head);
+      head = next;
+    }
+    throw;
+  }
+
+  linkChain(head, tail, count);
+  return count;
+}
+
+// Makes the tree out of count nodes chained through right_ in key order
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::linkChain(
+    Node* head, Node* tail, size_type count) {
+  if constexpr (kThreaded) {
+    Node* prev = nil_;
+    Node* node = head;
+    for (size_type i = 0; i < count; ++i, prev = node, node = node->right_) {
+      node->prev_ = prev;
+      node->next_ = nil_;
+      if (!isNil(prev)) prev->next_ = node;
+    }
+  }
+  if (count == 0) {
+    root_ = leftmost_ = rightmost_ = nil_;
+    return;
+  }
+
+  // Nodes on the deepest level, floor(log2(count + 1)), are colored red
+  size_type redDepth = 0;
+  while ((size_type(2) << redDepth) <= count + 1) ++redDepth;
+
+  leftmost_ = head;
+  rightmost_ = tail;
+  root_ = linkSorted(count, 0, redDepth, head);
+  root_->setParent(nil_);
+}
+
+// Turns count nodes of a chain linked through right_ into a balanced subtree
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::linkSorted(size_type count,
+                                                            size_type depth,
+                                                            size_type redDepth,
+                                                            Node*& chain) {
+  if (count == 0) return nil_;
+
+  size_type leftCount = (count - 1) / 2;
+  Node* left = linkSorted(leftCount, depth + 1, redDepth, chain);
+
+  Node* node = chain;
+  chain = chain->right_;
+
+  node->left_ = left;
+  if (!isNil(left)) left->setParent(node);
+  node->right_ = linkSorted(count - 1 - leftCount, depth + 1, redDepth, chain);
+  if (!isNil(node->right_)) node->right_->setParent(node);
+  node->setColor((depth == redDepth) ? NodeColor::RED : NodeColor::BLACK);
+  if constexpr (kOrderStatistic) node->size_ = count;
+  return node;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename V>
+std::pair<typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*, bool>
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::insertHint(Node* hint,
+                                                            V&& value) {
+  bool toLeft;
+  Node* equal;
+  Node* parent = findHintSlot(hint, keyOf(value), toLeft, equal);
+  if (!isNil(equal)) return std::make_pair(equal, false);
+  return std::make_pair(attachNode(parent, toLeft, std::forward<V>(value)),
+                        true);
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename... Args>
+std::pair<typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*, bool>
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::emplaceHint(Node* hint,
+                                                             Args&&... args) {
+  Node* newNode = createNode(nil_, std::forward<Args>(args)...);
+  bool toLeft;
+  Node* equal;
+  Node* parent = findHintSlot(hint, newNode->key(), toLeft, equal);
+  if (!isNil(equal)) {
+    destroyNode(newNode);
+    return std::make_pair(equal, false);
+  }
+  return std::make_pair(linkNode(parent, toLeft, newNode), true);
+}
+
+/*
+  Slot lookup next to a known position. When key fits right before hint (or
+  after the greatest key for the end() hint) the slot is taken there without
+  descending from the root, so feeding sorted keys costs amortized O(1) per
+  insert. Any other hint falls back to a regular descent.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::findHintSlot(
+    Node* hint, const K& key, bool& toLeft, Node*& equal) const {
+  equal = nil_;
+  if (isNil(hint)) {
+    toLeft = false;
+    if (!isEmpty() && (multi_type ? !compare_(key, rightmost_->key())
+                                  : compare_(rightmost_->key(), key)))
+      return rightmost_;
+    return findSlot(key, toLeft, equal);
+  }
+
+  bool beforeHint = compare_(key, hint->key());
+  if (!beforeHint && !multi_type) {
+    if (!compare_(hint->key(), key)) {
+      equal = hint;
+      return hint;
+    }
+
+    Node* next = getNext(hint);
+    if (isNil(next) || compare_(key, next->key())) {
+      toLeft = !isNil(hint->right_);
+      return toLeft ? next : hint;
+    }
+    return findSlot(key, toLeft, equal);
+  }
+
+  // For multiset an equal key also goes right before hint
+  if (beforeHint || !compare_(hint->key(), key)) {
+    Node* prev = getPrev(hint);
+    if (isNil(prev) || (multi_type ? !compare_(key, prev->key())
+                                   : compare_(prev->key(), key))) {
+      toLeft = isNil(hint->left_);
+      return toLeft ? hint : prev;
+    }
+  }
+  return findSlot(key, toLeft, equal);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::balanceInsert(Node* newNode) {
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::balanceInsert(
+    Node* newNode) {
   Node* uncle;
-  while (newNode->parent_->color_ == NodeColor::RED) {
-    if (newNode->parent_ == newNode->parent_->parent_->left_) {
-      uncle = newNode->parent_->parent_->right_;
-      if (uncle->color_ == NodeColor::RED) {
-        newNode->parent_->color_ = NodeColor::BLACK;
-        uncle->color_ = NodeColor::BLACK;
-        newNode->parent_->parent_->color_ = NodeColor::RED;
-        newNode = newNode->parent_->parent_;
+  while (newNode->parent()->color() == NodeColor::RED) {
+    if (newNode->parent() == newNode->parent()->parent()->left_) {
+      uncle = newNode->parent()->parent()->right_;
+      if (uncle->color() == NodeColor::RED) {
+        newNode->parent()->setColor(NodeColor::BLACK);
+        uncle->setColor(NodeColor::BLACK);
+        newNode->parent()->parent()->setColor(NodeColor::RED);
+        newNode = newNode->parent()->parent();
       } else {
-        if (newNode == newNode->parent_->right_) {
-          leftRotate(newNode->parent_);
+        if (newNode == newNode->parent()->right_) {
+          leftRotate(newNode->parent());
 
-          newNode->color_ = NodeColor::BLACK;
-          newNode->parent_->color_ = NodeColor::RED;
-          rightRotate(newNode->parent_);
-          newNode = newNode->parent_;
+          newNode->setColor(NodeColor::BLACK);
+          newNode->parent()->setColor(NodeColor::RED);
+          rightRotate(newNode->parent());
+          break;
         } else {
-          newNode->parent_->color_ = NodeColor::BLACK;
-          newNode->parent_->parent_->color_ = NodeColor::RED;
-          rightRotate(newNode->parent_->parent_);
+          newNode->parent()->setColor(NodeColor::BLACK);
+          newNode->parent()->parent()->setColor(NodeColor::RED);
+          rightRotate(newNode->parent()->parent());
         }
       }
     } else {
-      uncle = newNode->parent_->parent_->left_;
-      if (uncle->color_ == NodeColor::RED) {
-        newNode->parent_->color_ = NodeColor::BLACK;
-        uncle->color_ = NodeColor::BLACK;
-        newNode->parent_->parent_->color_ = NodeColor::RED;
-        newNode = newNode->parent_->parent_;
+      uncle = newNode->parent()->parent()->left_;
+      if (uncle->color() == NodeColor::RED) {
+        newNode->parent()->setColor(NodeColor::BLACK);
+        uncle->setColor(NodeColor::BLACK);
+        newNode->parent()->parent()->setColor(NodeColor::RED);
+        newNode = newNode->parent()->parent();
       } else {
-        if (newNode == newNode->parent_->left_) {
-          rightRotate(newNode->parent_);
+        if (newNode == newNode->parent()->left_) {
+          rightRotate(newNode->parent());
 
-          newNode->color_ = NodeColor::BLACK;
-          newNode->parent_->color_ = NodeColor::RED;
-          leftRotate(newNode->parent_);
-          newNode = newNode->parent_;
+          newNode->setColor(NodeColor::BLACK);
+          newNode->parent()->setColor(NodeColor::RED);
+          leftRotate(newNode->parent());
+          break;
         } else {
-          newNode->parent_->color_ = NodeColor::BLACK;
-          newNode->parent_->parent_->color_ = NodeColor::RED;
-          leftRotate(newNode->parent_->parent_);
+          newNode->parent()->setColor(NodeColor::BLACK);
+          newNode->parent()->parent()->setColor(NodeColor::RED);
+          leftRotate(newNode->parent()->parent());
         }
       }
     }
   }
-  root_->color_ = NodeColor::BLACK;
+  root_->setColor(NodeColor::BLACK);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-typename RBTree<KeyT, ValT, multi_type>::Node*
-RBTree<KeyT, ValT, multi_type>::search(Node* node, const KeyT& key) const {
-  if (isNil(node)) return nullptr;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::search(const K& key) const {
+  // Equal keys of a multiset may sit on both sides of the first match
+  if (multi_type) {
+    Node* node = lowerBound(key);
+    return (isNil(node) || compare_(key, node->key())) ? nullptr : node;
+  }
 
-  if (node->val_.first == key) {
-    if (!multi_type)
-      return node;
+  Node* node = root_;
+  while (!isNil(node)) {
+    if (compare_(key, node->key()))
+      node = node->left_;
+    else if (compare_(node->key(), key))
+      node = node->right_;
     else
-      return (node->left_->val_.first == key) ? search(node->left_, key) : node;
+      return node;
+  }
+  return nullptr;
+}
+
+// First node whose key is not less than key, nil if there is none
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::lowerBound(
+    const K& key) const {
+  Node* bound = nil_;
+  for (Node* node = root_; !isNil(node);) {
+    if (compare_(node->key(), key)) {
+      node = node->right_;
+    } else {
+      bound = node;
+      node = node->left_;
+    }
+  }
+  return bound;
+}
+
+// First node whose key is greater than key, nil if there is none
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::upperBound(
+    const K& key) const {
+  Node* bound = nil_;
+  for (Node* node = root_; !isNil(node);) {
+    if (compare_(key, node->key())) {
+      bound = node;
+      node = node->left_;
+    } else {
+      node = node->right_;
+    }
+  }
+  return bound;
+}
+
+/*
+  Both bounds in one descent: the walk is shared until it reaches the first
+  node equal to key, then the lower bound is searched in its left subtree and
+  the upper bound in its right subtree.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+template <typename K>
+std::pair<typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*,
+          typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*>
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::equalRange(
+    const K& key) const {
+  Node* upper = nil_;
+  Node* node = root_;
+  while (!isNil(node)) {
+    if (compare_(node->key(), key)) {
+      node = node->right_;
+    } else if (compare_(key, node->key())) {
+      upper = node;
+      node = node->left_;
+    } else {
+      break;
+    }
   }
+  if (isNil(node)) return std::make_pair(upper, upper);
 
-  return (key < node->val_.first) ? search(node->left_, key)
-                                  : search(node->right_, key);
+  Node* lower = node;
+  for (Node* left = node->left_; !isNil(left);) {
+    if (compare_(left->key(), key)) {
+      left = left->right_;
+    } else {
+      lower = left;
+      left = left->left_;
+    }
+  }
+  for (Node* right = node->right_; !isNil(right);) {
+    if (compare_(key, right->key())) {
+      upper = right;
+      right = right->left_;
+    } else {
+      right = right->right_;
+    }
+  }
+  return std::make_pair(lower, upper);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::printTree(Node* node) {
+// Node at in-order position index, nil if there is none
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::select(size_type index) const {
+  static_assert(kOrderStatistic, "select() needs order_statistic_policy");
+  Node* node = root_;
+  while (!isNil(node)) {
+    size_type leftSize = node->left_->size_;
+    if (index < leftSize) {
+      node = node->left_;
+    } else if (index == leftSize) {
+      break;
+    } else {
+      index -= leftSize + 1;
+      node = node->right_;
+    }
+  }
+  return node;
+}
+
+// Number of keys less than key
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::rank(const KeyT& key) const {
+  static_assert(kOrderStatistic, "rank() needs order_statistic_policy");
+  size_type less = 0;
+  for (Node* node = root_; !isNil(node);) {
+    if (compare_(node->key(), key)) {
+      less += node->left_->size_ + 1;
+      node = node->right_;
+    } else {
+      node = node->left_;
+    }
+  }
+  return less;
+}
+
+// In-order position of node, the number of nodes for nil
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::indexOf(Node* node) const {
+  static_assert(kOrderStatistic, "indexOf() needs order_statistic_policy");
+  if (isNil(node)) return root_->size_;
+
+  size_type index = node->left_->size_;
+  for (; !isNil(node->parent()); node = node->parent()) {
+    if (node == node->parent()->right_)
+      index += node->parent()->left_->size_ + 1;
+  }
+  return index;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::printTree(Node* node) {
   if (isNil(node)) return;
 
   printTree(node->left_);
-  std::cout << node->val_.first << ' ';
+  std::cout << node->key() << ' ';
   printTree(node->right_);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-int RBTree<KeyT, ValT, multi_type>::getChildrenCount(Node* node) {
-  int count = 0;
-  if (!isNil(node->left_)) count++;
-  if (!isNil(node->right_)) count++;
-  return count;
-}
-
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::transplateNode(Node* dest, Node* src) {
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::transplateNode(
+    Node* dest, Node* src) {
   if (dest == root_)
     root_ = src;
-  else if (dest == dest->parent_->left_)
-    dest->parent_->left_ = src;
+  else if (dest == dest->parent()->left_)
+    dest->parent()->left_ = src;
   else
-    dest->parent_->right_ = src;
-  src->parent_ = dest->parent_;
-  delete dest;
+    dest->parent()->right_ = src;
+  if (!isNil(src)) src->setParent(dest->parent());
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::swapValue(Node* dest, Node* src) {
-  Node* temp = new Node(src->val_, nil_);
-  temp->color_ = dest->color_;
-
-  temp->left_ = dest->left_;
-  temp->right_ = dest->right_;
-  temp->parent_ = dest->parent_;
-
-  dest->left_->parent_ = temp;
-  dest->right_->parent_ = temp;
-  if (dest != root_) {
-    if (dest == dest->parent_->left_)
-      dest->parent_->left_ = temp;
-    else
-      dest->parent_->right_ = temp;
-  } else
-    root_ = temp;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::remove(const KeyT& key) {
+  Node* node = search(key);
+  if (node != nullptr) removeNode(node);
+}
 
-  delete dest;
+/*
+  Unlinks node and destroys it. A node with two children is replaced by its
+  in-order successor, which is relinked into its place, so every other node
+  keeps its address and iterators to them stay valid.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::removeNode(Node* node) {
+  detachNode(node);
+  destroyNode(node);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::removeNode(const KeyT& key) {
-  Node* nodeToDelete = search(key);
-  if (nodeToDelete == nullptr) return;
+// Unlinks node from the tree and rebalances it, the node itself is kept
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::detachNode(Node* node) {
+  if constexpr (kThreaded) {
+    if (!isNil(node->prev_)) node->prev_->next_ = node->next_;
+    if (!isNil(node->next_)) node->next_->prev_ = node->prev_;
+  }
+  Node* newLeftmost = (node == leftmost_) ? getNext(node) : leftmost_;
+  Node* newRightmost = (node == rightmost_) ? getPrev(node) : rightmost_;
 
-  NodeColor removedNodeColor = nodeToDelete->color_;
+  // child takes the place of the node taken out and may be nil, so its
+  // parent is tracked aside
+  NodeColor removedNodeColor = node->color();
   Node* child;
+  Node* childParent;
+  if (isNil(node->left_)) {
+    shrinkPath(node->parent());
+    child = node->right_;
+    childParent = node->parent();
+    transplateNode(node, child);
+  } else if (isNil(node->right_)) {
+    shrinkPath(node->parent());
+    child = node->left_;
+    childParent = node->parent();
+    transplateNode(node, child);
+  } else {
+    Node* successor = getMin(node->right_);
+    shrinkPath(successor->parent());
+    if constexpr (kOrderStatistic) successor->size_ = node->size_;
+    removedNodeColor = successor->color();
+    child = successor->right_;
+    if (successor->parent() == node) {
+      childParent = successor;
+    } else {
+      childParent = successor->parent();
+      transplateNode(successor, child);
+      successor->right_ = node->right_;
+      successor->right_->setParent(successor);
+    }
+    transplateNode(node, successor);
+    successor->left_ = node->left_;
+    successor->left_->setParent(successor);
+    successor->setColor(node->color());
+  }
 
-  if (getChildrenCount(nodeToDelete) < 2) {
-    child = getChildOrMock(nodeToDelete);
-    transplateNode(nodeToDelete, child);
+  if (removedNodeColor == NodeColor::BLACK)
+    balanceRemove(child, childParent);
+  leftmost_ = isEmpty() ? nil_ : newLeftmost;
+  rightmost_ = isEmpty() ? nil_ : newRightmost;
+}
+
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::NodeHandle
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::extract(Node* node) {
+  detachNode(node);
+  return NodeHandle(node, pool_);
+}
+
+// A handle whose key is already in a unique tree is left untouched
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+std::pair<typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*, bool>
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::insertHandle(
+    NodeHandle& handle) {
+  if (handle.empty()) return std::make_pair(nil_, false);
+
+  bool toLeft;
+  Node* equal;
+  Node* parent = findSlot(handle.key(), toLeft, equal);
+  if (!isNil(equal)) return std::make_pair(equal, false);
+
+  Node* node = handle.node_;
+  if (handle.pool_ == pool_) {
+    handle.node_ = nullptr;
+    handle.pool_.reset();
   } else {
-    Node* minNode = getMin(nodeToDelete->right_);
-    swapValue(nodeToDelete, minNode);
-    removedNodeColor = minNode->color_;
-    child = getChildOrMock(minNode);
-    transplateNode(minNode, child);
+    node = createNode(nil_, std::move(handle.node_->val_));
+    handle.reset();
+  }
+  return std::make_pair(linkNode(parent, toLeft, node), true);
+}
+
+/*
+  Moves the nodes of other whose keys are not in this tree yet (all of them
+  for multi trees) and returns their number. When both trees allocate from
+  one pool, passed to their constructors, the nodes are relinked as they
+  are: no key is copied and nothing is allocated. Otherwise the values are
+  moved into new nodes, so trees with pools of their own keep them apart.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::merge(RBTree& other) {
+  if (this == &other || other.isEmpty()) return 0;
+
+  bool shared = other.pool_ == pool_;
+  size_type count = 0;
+  for (Node* node = other.leftmost_; !other.isNil(node);) {
+    Node* next = other.getNext(node);
+    bool toLeft;
+    Node* equal;
+    Node* parent = findSlot(node->key(), toLeft, equal);
+    if (isNil(equal)) {
+      if (shared) {
+        other.detachNode(node);
+      } else {
+        Node* moved = createNode(nil_, std::move(node->val_));
+        other.removeNode(node);
+        node = moved;
+      }
+      linkNode(parent, toLeft, node);
+      ++count;
+    }
+    node = next;
+  }
+  return count;
+}
+
+/*
+  Removes the nodes in [first, last) and returns their number. treeSize is
+  the number of nodes in the whole tree. When the range is a large part of
+  it, the survivors are flattened and relinked into a balanced tree in one
+  O(n) pass instead of repairing the tree after every single removal.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::size_type
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::removeRange(
+    Node* first, Node* last, size_type treeSize) {
+  size_type count = 0;
+  for (Node* node = first; node != last; node = getNext(node)) ++count;
+  if (count == 0) return 0;
+
+  size_type height = 1;
+  while ((treeSize >> height) != 0) ++height;
+
+  if (count * height < treeSize) {
+    while (first != last) {
+      Node* next = getNext(first);
+      removeNode(first);
+      first = next;
+    }
+    return count;
+  }
+
+  Node* head = nil_;
+  Node* tail = nil_;
+  bool inRange = false;
+  Node* node = flattenTree(root_, nil_);
+  while (!isNil(node)) {
+    Node* next = node->right_;
+    if (node == first) inRange = true;
+    if (node == last) inRange = false;
+    if (inRange) {
+      destroyNode(node);
+    } else {
+      node->right_ = nil_;
+      if (isNil(tail))
+        head = node;
+      else
+        tail->right_ = node;
+      tail = node;
+    }
+    node = next;
   }
-  if (removedNodeColor == NodeColor::BLACK) balanceRemove(child);
+  linkChain(head, tail, treeSize - count);
+  return count;
+}
+
+// Chains the nodes of a subtree through right_ in order, followed by chain
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::flattenTree(Node* node,
+                                                             Node* chain) {
+  if (isNil(node)) return chain;
+
+  node->right_ = flattenTree(node->right_, chain);
+  return flattenTree(node->left_, node);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::balanceRemove(Node* node) {
-  while (node != root_ && node->color_ == NodeColor::BLACK) {
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::balanceRemove(
+    Node* node, Node* parent) {
+  while (node != root_ && node->color() == NodeColor::BLACK) {
     Node* brother;
-    if (node == node->parent_->left_) {
-      brother = node->parent_->right_;
-      if (brother->color_ == NodeColor::RED) {
-        brother->color_ = NodeColor::BLACK;
-        node->parent_->color_ = NodeColor::RED;
-        leftRotate(node->parent_);
-        brother = node->parent_->right_;
+    if (node == parent->left_) {
+      brother = parent->right_;
+      if (brother->color() == NodeColor::RED) {
+        brother->setColor(NodeColor::BLACK);
+        parent->setColor(NodeColor::RED);
+        leftRotate(parent);
+        brother = parent->right_;
       }
-      if (brother->left_->color_ == NodeColor::BLACK &&
-          brother->right_->color_ == NodeColor::BLACK) {
-        brother->color_ = NodeColor::RED;
-        node = node->parent_;
+      if (brother->left_->color() == NodeColor::BLACK &&
+          brother->right_->color() == NodeColor::BLACK) {
+        brother->setColor(NodeColor::RED);
+        node = parent;
+        parent = parent->parent();
       } else {
-        if (brother->right_->color_ == NodeColor::BLACK) {
-          brother->left_->color_ = NodeColor::BLACK;
-          brother->color_ = NodeColor::RED;
+        if (brother->right_->color() == NodeColor::BLACK) {
+          brother->left_->setColor(NodeColor::BLACK);
+          brother->setColor(NodeColor::RED);
           rightRotate(brother);
-          node->parent_ = brother->parent_->parent_;
-          brother = node->parent_->right_;
+          brother = parent->right_;
         }
-        brother->color_ = node->parent_->color_;
-        node->parent_->color_ = NodeColor::BLACK;
-        brother->right_->color_ = NodeColor::BLACK;
-        leftRotate(node->parent_);
+        brother->setColor(parent->color());
+        parent->setColor(NodeColor::BLACK);
+        brother->right_->setColor(NodeColor::BLACK);
+        leftRotate(parent);
         node = root_;
       }
     } else {
-      brother = node->parent_->left_;
-      if (brother->color_ == NodeColor::RED) {
-        brother->color_ = NodeColor::BLACK;
-        node->parent_->color_ = NodeColor::RED;
-        rightRotate(node->parent_);
-        brother = node->parent_->left_;
+      brother = parent->left_;
+      if (brother->color() == NodeColor::RED) {
+        brother->setColor(NodeColor::BLACK);
+        parent->setColor(NodeColor::RED);
+        rightRotate(parent);
+        brother = parent->left_;
       }
-      if (brother->left_->color_ == NodeColor::BLACK &&
-          brother->right_->color_ == NodeColor::BLACK) {
-        brother->color_ = NodeColor::RED;
-        node = node->parent_;
+      if (brother->left_->color() == NodeColor::BLACK &&
+          brother->right_->color() == NodeColor::BLACK) {
+        brother->setColor(NodeColor::RED);
+        node = parent;
+        parent = parent->parent();
       } else {
-        if (brother->left_->color_ == NodeColor::BLACK) {
-          brother->right_->color_ = NodeColor::BLACK;
-          brother->color_ = NodeColor::RED;
+        if (brother->left_->color() == NodeColor::BLACK) {
+          brother->right_->setColor(NodeColor::BLACK);
+          brother->setColor(NodeColor::RED);
           leftRotate(brother);
-          node->parent_ = brother->parent_->parent_;
-          brother = node->parent_->left_;
+          brother = parent->left_;
         }
-        brother->color_ = node->parent_->color_;
-        node->parent_->color_ = NodeColor::BLACK;
-        brother->left_->color_ = NodeColor::BLACK;
-        rightRotate(node->parent_);
+        brother->setColor(parent->color());
+        parent->setColor(NodeColor::BLACK);
+        brother->left_->setColor(NodeColor::BLACK);
+        rightRotate(parent);
         node = root_;
       }
     }
   }
-  node->color_ = NodeColor::BLACK;
+  if (!isNil(node)) node->setColor(NodeColor::BLACK);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-typename RBTree<KeyT, ValT, multi_type>::Node*
-RBTree<KeyT, ValT, multi_type>::getMin(Node* node) const {
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::getMin(Node* node) const {
   if (isNil(node)) return nullptr;
 
-  if (isNil(node->left_)) return node;
-  return getMin(node->left_);
+  while (!isNil(node->left_)) node = node->left_;
+  return node;
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-typename RBTree<KeyT, ValT, multi_type>::Node*
-RBTree<KeyT, ValT, multi_type>::getMin() const {
-  if (isNil(root_) || isNil(root_->left_)) return root_;
-
-  Node* temp = root_->left_;
-  while (!isNil(temp->left_)) temp = temp->left_;
-
-  return temp;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::getMin() const {
+  return leftmost_;
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-typename RBTree<KeyT, ValT, multi_type>::Node*
-RBTree<KeyT, ValT, multi_type>::getMax(Node* node) const {
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::getMax(Node* node) const {
   if (isNil(node)) return nullptr;
 
-  if (isNil(node->right_)) return node;
-  return getMax(node->right_);
+  while (!isNil(node->right_)) node = node->right_;
+  return node;
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-typename RBTree<KeyT, ValT, multi_type>::Node*
-RBTree<KeyT, ValT, multi_type>::getMax() const {
-  if (isNil(root_)) return nil_;
-
-  Node* temp = root_;
-  while (!isNil(temp->right_)) temp = temp->right_;
-
-  return temp->right_;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::getMax() const {
+  return nil_;
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::deleteTree(Node* node) {
-  if (isNil(node)) return;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::getNext(Node* node) const {
+  // The nil node is shared, so the threaded list is closed through it here
+  if constexpr (kThreaded) return isNil(node) ? leftmost_ : node->next_;
+  if (isNil(node) || node == rightmost_) return nil_;
+
+  if (!isNil(node->right_)) {
+    node = node->right_;
+    while (!isNil(node->left_)) node = node->left_;
+    return node;
+  }
 
-  deleteTree(node->left_);
-  deleteTree(node->right_);
-  delete node;
+  Node* parent = node->parent();
+  while (!isNil(parent) && node == parent->right_) {
+    node = parent;
+    parent = parent->parent();
+  }
+  return parent;
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::swap(Node* a, Node* b) {
-  if (b == a->left_) {
-    Node* aRight = a->right_;
-    Node* bLeft = b->left_;
-    a->right_ = b->right_;
-    b->right_ = aRight;
-
-    b->left_ = a;
-    a->left_ = bLeft;
-
-    if (!isNil(a->parent_)) {
-      if (a == a->parent_->left_)
-        a->parent_->left_ = b;
-      else
-        a->parent_->right_ = b;
-      b->parent_ = a->parent_;
-    } else
-      b->parent_ = nil_;
-    a->parent_ = b;
-
-    if (!isNil(b->right_)) b->right_->parent_ = b;
-
-    if (!isNil(a->right_)) a->right_->parent_ = a;
-
-    if (!isNil(a->left_)) a->left_->parent_ = a;
-  } else {
-    Node* aLeft = a->left_;
-    Node* bRight = b->right_;
-    a->left_ = b->left_;
-    b->left_ = aLeft;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+typename RBTree<KeyT, ValT, multi_type, Compare, Policy>::Node*
+RBTree<KeyT, ValT, multi_type, Compare, Policy>::getPrev(Node* node) const {
+  if (isNil(node)) return rightmost_;
+  if constexpr (kThreaded) return node->prev_;
+  if (node == leftmost_) return nil_;
+
+  if (!isNil(node->left_)) {
+    node = node->left_;
+    while (!isNil(node->right_)) node = node->right_;
+    return node;
+  }
 
-    b->right_ = a;
-    a->right_ = bRight;
+  Node* parent = node->parent();
+  while (!isNil(parent) && node == parent->left_) {
+    node = parent;
+    parent = parent->parent();
+  }
+  return parent;
+}
 
-    if (!isNil(a->parent_)) {
-      if (a == a->parent_->left_)
-        a->parent_->left_ = b;
+/*
+  Destroys the nodes of a subtree with constant stack: a node with a left
+  child is rotated right until the least node of the subtree has none,
+  then that node goes and its right subtree is next. Every rotation moves
+  one node off the left spine for good, so the work stays linear. With
+  toPool unset the slots of the nodes are not returned to the pool.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::deleteTree(Node* node,
+                                                             bool toPool) {
+  while (!isNil(node)) {
+    Node* left = node->left_;
+    if (isNil(left)) {
+      Node* right = node->right_;
+      if (toPool)
+        destroyNode(node);
       else
-        a->parent_->right_ = b;
-      b->parent_ = a->parent_;
-    } else
-      b->parent_ = nil_;
-    a->parent_ = b;
-
-    if (!isNil(b->left_)) b->left_->parent_ = b;
-
-    if (!isNil(a->left_)) a->left_->parent_ = a;
+        node->~Node();
+      node = right;
+    } else {
+      node->left_ = left->right_;
+      left->right_ = node;
+      node = left;
+    }
+  }
+}
 
-    if (!isNil(a->right_)) a->right_->parent_ = a;
+/*
+  Frees all nodes of the tree. A pool no other container or node handle
+  shares takes back all its slots at once, so the nodes are visited only
+  when their values have destructors to run.
+*/
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::releaseNodes() noexcept {
+  if (isNil(root_)) return;
+
+  if (pool_.use_count() != 1) {
+    deleteTree(root_, true);
+    return;
   }
+  if constexpr (!std::is_trivially_destructible_v<value_type>)
+    deleteTree(root_, false);
+  pool_->release();
+}
 
-  if (a == root_) root_ = b;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::rightRotate(Node* node) {
+  Node* pivot = node->left_;
+  node->left_ = pivot->right_;
+  if (!isNil(pivot->right_)) pivot->right_->setParent(node);
+  transplateNode(node, pivot);
+  pivot->right_ = node;
+  node->setParent(pivot);
+  updateRotated(node);
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::rightRotate(Node* node) {
-  swap(node, node->left_);
-  Node* temp = node->parent_->right_;
-  node->parent_->right_ = node->parent_->left_;
-  node->parent_->left_ = node->parent_->right_->left_;
-  node->parent_->right_->left_ = node->parent_->right_->right_;
-  node->parent_->right_->right_ = temp;
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::leftRotate(Node* node) {
+  Node* pivot = node->right_;
+  node->right_ = pivot->left_;
+  if (!isNil(pivot->left_)) pivot->left_->setParent(node);
+  transplateNode(node, pivot);
+  pivot->left_ = node;
+  node->setParent(pivot);
+  updateRotated(node);
+}
 
-  node->parent_->left_->parent_ = node->parent_;
-  if (!isNil(node->parent_->right_->right_->parent_))
-    node->parent_->right_->right_->parent_ = node->parent_->right_;
+// Subtree sizes of the ancestors of a node that just got a new descendant
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::growPath(Node* node) {
+  if constexpr (kOrderStatistic)
+    for (; !isNil(node); node = node->parent()) ++node->size_;
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::leftRotate(Node* node) {
-  swap(node, node->right_);
-  Node* temp = node->parent_->left_;
-  node->parent_->left_ = node->parent_->right_;
-  node->parent_->right_ = node->parent_->left_->right_;
-  node->parent_->left_->right_ = node->parent_->left_->left_;
-  node->parent_->left_->left_ = temp;
+// Subtree sizes of the ancestors of a node that is about to be unlinked
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::shrinkPath(Node* node) {
+  if constexpr (kOrderStatistic)
+    for (; !isNil(node); node = node->parent()) --node->size_;
+}
 
-  node->parent_->right_->parent_ = node->parent_;
-  if (!isNil(node->parent_->left_->left_->parent_))
-    node->parent_->left_->left_->parent_ = node->parent_->left_;
+// node has just been rotated below its parent, which took over its subtree
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::updateRotated(
+    Node* node) {
+  if constexpr (kOrderStatistic) {
+    node->parent()->size_ = node->size_;
+    node->size_ = node->left_->size_ + node->right_->size_ + 1;
+  }
 }
 
-template <typename KeyT, typename ValT, bool multi_type>
-void RBTree<KeyT, ValT, multi_type>::clear() {
-  deleteTree(root_);
+template <typename KeyT, typename ValT, bool multi_type, typename Compare,
+          typename Policy>
+void RBTree<KeyT, ValT, multi_type, Compare, Policy>::clear() {
+  releaseNodes();
   root_ = nil_;
+  leftmost_ = nil_;
+  rightmost_ = nil_;
 }
 }  // namespace s21
 
@@ -4,13 +4,14 @@
 #include <limits>
 #include <type_traits>
 
+#include "s21_btree.h"
 #include "s21_container.h"
-#include "s21_rbtree.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename KeyT>
+template <typename KeyT, typename Compare = std::less<KeyT>,
+          typename Policy = default_tree_policy>
 class set : public IContainer {
  public:
   class SetIterator;
@@ -20,22 +21,30 @@ class set : public IContainer {
   using value_type = KeyT;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = set<key_type>::SetIterator;
-  using const_iterator = set<key_type>::SetConstIterator;
+  using iterator = SetIterator;
+  using const_iterator = SetConstIterator;
   using typename IContainer::size_type;
+  using key_compare = Compare;
+  using tree_type = tree_engine_t<KeyT, void, false, Compare, Policy>;
+  using node_pool = typename tree_type::pool_type;
+  using node_pool_pointer = typename tree_type::pool_pointer;
+  using node_type = typename tree_type::NodeHandle;
 
  public:
   set();
+  explicit set(node_pool_pointer pool);
   set(std::initializer_list<value_type> const& items);
+  template <typename ForwardIt>
+  set(ForwardIt first, ForwardIt last, sorted_tag_t);
   set(const set& other);
   set(set&& other) noexcept;
   ~set(){};
 
-  set<key_type>& operator=(const set& other);
-  set<key_type>& operator=(set&& other);
+  set& operator=(const set& other);
+  set& operator=(set&& other);
 
-  bool operator==(const set<key_type>& other) const;
-  bool operator!=(const set<key_type>& other) const;
+  bool operator==(const set& other) const;
+  bool operator!=(const set& other) const;
 
   iterator begin();
   const_iterator begin() const;
@@ -45,29 +54,59 @@ class set : public IContainer {
   bool empty() const noexcept override { return btree_.isEmpty(); }
   size_type size() const noexcept override { return size_; }
   static size_type max_size();
+  void reserve(size_type count);
+  node_pool_pointer get_node_pool();
+  key_compare key_comp() const { return btree_.keyComp(); }
 
   void clear();
+  template <typename ForwardIt>
+  void assign(ForwardIt first, ForwardIt last, sorted_tag_t);
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  iterator insert(const_iterator hint, const value_type& value);
+  iterator insert(const_iterator hint, value_type&& value);
+  std::pair<iterator, bool> insert(node_type&& node);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args&&... args);
 
   void erase(iterator pos);
   void swap(set& other);
   void merge(set& other);
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type& key);
   iterator find(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  iterator find(const K& key);
   bool contains(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  bool contains(const K& key);
+
+  iterator lower_bound(const key_type& key);
+  template <typename K, typename = transparent_key_t<Compare, K>>
+  iterator lower_bound(const K& key);
+  iterator upper_bound(const key_type& key);
+  std::pair<iterator, iterator> equal_range(const key_type& key);
+
+  // Need order_statistic_policy
+  iterator nth(size_type index);
+  size_type rank(const key_type& key) const;
+  std::ptrdiff_t distance(const_iterator first, const_iterator last) const;
 
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
  private:
-  RBTree<KeyT, KeyT, false> btree_;
+  tree_type btree_;
   size_type size_;
 
  private:
   void erase(value_type pos);
 };
 
-template <typename KeyT>
-class set<KeyT>::SetIterator {
+template <typename KeyT, typename Compare, typename Policy>
+class set<KeyT, Compare, Policy>::SetIterator {
  public:
   using iterator_category = std::bidirectional_iterator_tag;
   using value_type = KeyT;
@@ -75,18 +114,18 @@ class set<KeyT>::SetIterator {
   using pointer = value_type*;
   using reference = value_type&;
 
-  using Node = typename RBTree<KeyT, KeyT, false>::Node;
+  using Cursor = typename tree_type::Cursor;
 
  public:
   SetIterator() = default;
-  SetIterator(Node* ptr, RBTree<KeyT, KeyT, false>* it_btree)
+  SetIterator(Cursor ptr, tree_type* it_btree)
       : ptr_(ptr), it_btree_(it_btree) {}
 
   bool operator==(const SetIterator& other) { return ptr_ == other.ptr_; }
   bool operator!=(const SetIterator& other) { return !(*this == other); }
 
   SetIterator& operator++() {
-    ptr_ = RBT_increment(ptr_);
+    ptr_ = it_btree_->getNext(ptr_);
     return *this;
   }
 
@@ -97,7 +136,7 @@ class set<KeyT>::SetIterator {
   }
 
   SetIterator& operator--() {
-    ptr_ = RBT_decrement(ptr_);
+    ptr_ = it_btree_->getPrev(ptr_);
     return *this;
   }
 
@@ -107,18 +146,18 @@ class set<KeyT>::SetIterator {
     return temp;
   }
 
-  reference operator*() { return ptr_->val_.second; }
+  reference operator*() { return tree_type::valueOf(ptr_); }
 
  private:
-  Node* ptr_ = nullptr;
-  RBTree<KeyT, KeyT, false>* it_btree_ = nullptr;
+  friend class set<KeyT, Compare, Policy>;
 
-  Node* RBT_increment(Node* ptr);
-  Node* RBT_decrement(Node* ptr);
+  Cursor ptr_ = Cursor();
+  tree_type* it_btree_ = nullptr;
 };
 
-template <typename KeyT>
-class set<KeyT>::SetConstIterator : public set<KeyT>::SetIterator {
+template <typename KeyT, typename Compare, typename Policy>
+class set<KeyT, Compare, Policy>::SetConstIterator
+    : public set<KeyT, Compare, Policy>::SetIterator {
  public:
   using value_type = KeyT;
   using const_reference = const value_type&;
@@ -128,84 +167,76 @@ class set<KeyT>::SetConstIterator : public set<KeyT>::SetIterator {
   const_reference operator*() { return SetIterator::operator*(); }
 };
 
-template <typename key_type>
-typename set<key_type>::iterator set<key_type>::find(const key_type& key) {
-  typename RBTree<key_type, key_type, false>::Node* temp = btree_.search(key);
-  return (!temp) ? end() : set<key_type>::iterator(temp, &btree_);
-}
-
-template <typename key_type>
-typename RBTree<key_type, key_type, false>::Node*
-set<key_type>::SetIterator::RBT_increment(
-    typename RBTree<key_type, key_type, false>::Node* ptr) {
-  if (!it_btree_->isNil(ptr->right_)) {
-    ptr = ptr->right_;
-    while (!it_btree_->isNil(ptr->left_)) ptr = ptr->left_;
-  } else {
-    typename RBTree<key_type, key_type, false>::Node* parent = ptr->parent_;
-    while (ptr == parent->right_) {
-      ptr = parent;
-      parent = parent->parent_;
-    }
-    if (ptr->right_ != parent) ptr = parent;
-  }
-  return ptr;
-}
-
-template <typename key_type>
-typename RBTree<key_type, key_type, false>::Node*
-set<key_type>::SetIterator::RBT_decrement(
-    typename RBTree<key_type, key_type, false>::Node* ptr) {
-  if (!it_btree_->isNil(ptr->left_)) {
-    ptr = ptr->left_;
-    while (!it_btree_->isNil(ptr->right_)) ptr = ptr->right_;
-  } else {
-    typename RBTree<key_type, key_type, false>::Node* parent = ptr->parent_;
-    while (ptr == parent->left_) {
-      ptr = parent;
-      parent = parent->parent_;
-    }
-    if (ptr->left_ != parent) ptr = parent;
-  }
-  return ptr;
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::find(const key_type& key) {
+  typename tree_type::Cursor temp = btree_.search(key);
+  return (!temp) ? end() : iterator(temp, &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename K, typename>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::find(const K& key) {
+  typename tree_type::Cursor temp = btree_.search(key);
+  return (!temp) ? end() : iterator(temp, &btree_);
 }
 
-template <typename key_type>
-bool set<key_type>::operator==(const set<key_type>& other) const {
+template <typename key_type, typename compare_type, typename policy_type>
+bool set<key_type, compare_type, policy_type>::operator==(
+    const set<key_type, compare_type, policy_type>& other) const {
   if (this == &other) return true;
   if (size() != other.size()) return false;
 
   return (std::equal(begin(), end(), other.begin()));
 }
 
-template <typename key_type>
-bool set<key_type>::operator!=(const set<key_type>& other) const {
+template <typename key_type, typename compare_type, typename policy_type>
+bool set<key_type, compare_type, policy_type>::operator!=(
+    const set<key_type, compare_type, policy_type>& other) const {
   return !(*this == other);
 }
 
-template <typename key_type>
-typename set<key_type>::size_type set<key_type>::max_size() {
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::size_type
+set<key_type, compare_type, policy_type>::max_size() {
   return std::numeric_limits<size_type>::max() /
-         sizeof(typename RBTree<key_type, key_type, false>::Node) / 4294967296;
+         sizeof(typename tree_type::Node) / 4294967296;
 }
 
-template <typename key_type>
-set<key_type>::set() : btree_(), size_(0) {}
+template <typename key_type, typename compare_type, typename policy_type>
+set<key_type, compare_type, policy_type>::set() : btree_(), size_(0) {}
 
-template <typename key_type>
-set<key_type>::set(std::initializer_list<value_type> const& items)
+template <typename key_type, typename compare_type, typename policy_type>
+set<key_type, compare_type, policy_type>::set(node_pool_pointer pool)
+    : btree_(std::move(pool)), size_(0) {}
+
+template <typename key_type, typename compare_type, typename policy_type>
+set<key_type, compare_type, policy_type>::set(
+    std::initializer_list<value_type> const& items)
     : btree_(), size_(0) {
+  btree_.reserve(items.size());
   for (const_reference p : items)
-    if (btree_.insert(std::make_pair(p, p)).second) size_++;
+    if (btree_.insert(p).second) size_++;
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename ForwardIt>
+set<key_type, compare_type, policy_type>::set(ForwardIt first, ForwardIt last,
+                                              sorted_tag_t)
+    : btree_(), size_(0) {
+  size_ = btree_.assignSorted(first, last);
 }
 
-template <typename key_type>
-set<key_type>::set(const set& other) : btree_(), size_(other.size_) {
-  for (auto it : other) this->btree_.insert(std::make_pair(it, it));
+template <typename key_type, typename compare_type, typename policy_type>
+set<key_type, compare_type, policy_type>::set(const set& other)
+    : btree_(), size_(other.size_) {
+  btree_.reserve(other.size_);
+  for (const_reference it : other) this->btree_.insert(it);
 }
 
-template <typename key_type>
-set<key_type>::set(set&& other) noexcept
+template <typename key_type, typename compare_type, typename policy_type>
+set<key_type, compare_type, policy_type>::set(set&& other) noexcept
     : btree_(other.btree_), size_(other.size_) {
   if (this != &other) {
     other.btree_.makeNullRoot();
@@ -213,18 +244,20 @@ set<key_type>::set(set&& other) noexcept
   }
 }
 
-template <typename key_type>
-set<key_type>& set<key_type>::operator=(const set& other) {
+template <typename key_type, typename compare_type, typename policy_type>
+set<key_type, compare_type, policy_type>&
+set<key_type, compare_type, policy_type>::operator=(const set& other) {
   size_ = other.size_;
-  for (auto it : other) this->btree_.insert(std::make_pair(it, it));
+  for (const_reference it : other) this->btree_.insert(it);
 
   return *this;
 }
 
-template <typename key_type>
-set<key_type>& set<key_type>::operator=(set&& other) {
+template <typename key_type, typename compare_type, typename policy_type>
+set<key_type, compare_type, policy_type>&
+set<key_type, compare_type, policy_type>::operator=(set&& other) {
   if (this == &other) return *this;
-  set<key_type> temp = std::move(*this);
+  set<key_type, compare_type, policy_type> temp = std::move(*this);
   btree_ = other.btree_;
   size_ = other.size_;
 
@@ -234,89 +267,236 @@ set<key_type>& set<key_type>::operator=(set&& other) {
   return *this;
 }
 
-template <typename key_type>
-typename set<key_type>::iterator set<key_type>::begin() {
-  set<key_type>::iterator it(btree_.getMin(), &btree_);
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::begin() {
+  iterator it(btree_.getMin(), &btree_);
   return it;
 }
 
-template <typename key_type>
-typename set<key_type>::const_iterator set<key_type>::begin() const {
-  SetIterator it(btree_.getMin(),
-                 const_cast<RBTree<key_type, key_type, false>*>(&btree_));
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::const_iterator
+set<key_type, compare_type, policy_type>::begin() const {
+  SetIterator it(btree_.getMin(), const_cast<tree_type*>(&btree_));
   return SetConstIterator(it);
 }
 
-template <typename key_type>
-typename set<key_type>::iterator set<key_type>::end() {
-  set<key_type>::iterator it(btree_.getMax(), &btree_);
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::end() {
+  iterator it(btree_.getMax(), &btree_);
   return it;
 }
 
-template <typename key_type>
-typename set<key_type>::const_iterator set<key_type>::end() const {
-  SetIterator it(btree_.getMax(),
-                 const_cast<RBTree<key_type, key_type, false>*>(&btree_));
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::const_iterator
+set<key_type, compare_type, policy_type>::end() const {
+  SetIterator it(btree_.getMax(), const_cast<tree_type*>(&btree_));
   return SetConstIterator(it);
 }
 
-template <typename key_type>
-void set<key_type>::clear() {
+template <typename key_type, typename compare_type, typename policy_type>
+void set<key_type, compare_type, policy_type>::reserve(size_type count) {
+  if (count > size_) btree_.reserve(count - size_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::node_pool_pointer
+set<key_type, compare_type, policy_type>::get_node_pool() {
+  return btree_.getPool();
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+void set<key_type, compare_type, policy_type>::clear() {
   btree_.clear();
   size_ = 0;
 }
 
-template <typename key_type>
-std::pair<typename set<key_type>::iterator, bool> set<key_type>::insert(
-    const value_type& value) {
-  std::pair<typename RBTree<key_type, key_type, false>::Node*, bool> temp =
-      btree_.insert(std::make_pair(value, value));
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename ForwardIt>
+void set<key_type, compare_type, policy_type>::assign(ForwardIt first,
+                                                      ForwardIt last,
+                                                      sorted_tag_t) {
+  size_ = btree_.assignSorted(first, last);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+std::pair<typename set<key_type, compare_type, policy_type>::iterator, bool>
+set<key_type, compare_type, policy_type>::insert(const value_type& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insert(value);
+  if (temp.second) size_++;
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+std::pair<typename set<key_type, compare_type, policy_type>::iterator, bool>
+set<key_type, compare_type, policy_type>::insert(value_type&& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insert(std::move(value));
+  if (temp.second) size_++;
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::insert(const_iterator hint,
+                                                 const value_type& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHint(hint.ptr_, value);
   if (temp.second) size_++;
-  return std::make_pair(set<key_type>::iterator(temp.first, &btree_),
-                        temp.second);
+  return iterator(temp.first, &btree_);
 }
 
-template <typename key_type>
-void set<key_type>::erase(iterator pos) {
-  btree_.remove(*pos);
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::insert(const_iterator hint,
+                                                 value_type&& value) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHint(hint.ptr_, std::move(value));
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+// On failure the node stays in the handle
+template <typename key_type, typename compare_type, typename policy_type>
+std::pair<typename set<key_type, compare_type, policy_type>::iterator, bool>
+set<key_type, compare_type, policy_type>::insert(node_type&& node) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.insertHandle(node);
+  if (temp.second) size_++;
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+// The key is built right inside the new node
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename... Args>
+std::pair<typename set<key_type, compare_type, policy_type>::iterator, bool>
+set<key_type, compare_type, policy_type>::emplace(Args&&... args) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.emplace(std::forward<Args>(args)...);
+  if (temp.second) size_++;
+  return std::make_pair(iterator(temp.first, &btree_), temp.second);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename... Args>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::emplace_hint(const_iterator hint,
+                                                       Args&&... args) {
+  std::pair<typename tree_type::Cursor, bool> temp =
+      btree_.emplaceHint(hint.ptr_, std::forward<Args>(args)...);
+  if (temp.second) size_++;
+  return iterator(temp.first, &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+void set<key_type, compare_type, policy_type>::erase(iterator pos) {
+  btree_.removeNode(pos.ptr_);
   size_--;
 }
 
-template <typename key_type>
-void set<key_type>::erase(value_type pos) {
+template <typename key_type, typename compare_type, typename policy_type>
+void set<key_type, compare_type, policy_type>::erase(value_type pos) {
   btree_.remove(pos);
   size_--;
 }
 
-template <typename key_type>
-void set<key_type>::swap(set& other) {
+template <typename key_type, typename compare_type, typename policy_type>
+void set<key_type, compare_type, policy_type>::swap(set& other) {
   btree_.swapOtherRoot(other.btree_);
   std::swap(size_, other.size_);
 }
 
-template <typename key_type>
-void set<key_type>::merge(set& other) {
-  set<key_type>::iterator itTemp;
-  vector<key_type> buff;
-  for (set<key_type>::iterator it = other.begin(); it != other.end(); ++it) {
-    if (insert(*it).second) {
-      buff.push_back(*it);
-    }
-  }
-  for (auto it : buff) other.erase(it);
+template <typename key_type, typename compare_type, typename policy_type>
+void set<key_type, compare_type, policy_type>::merge(set& other) {
+  size_type count = btree_.merge(other.btree_);
+  size_ += count;
+  other.size_ -= count;
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::node_type
+set<key_type, compare_type, policy_type>::extract(const_iterator pos) {
+  size_--;
+  return btree_.extract(pos.ptr_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::node_type
+set<key_type, compare_type, policy_type>::extract(const key_type& key) {
+  typename tree_type::Cursor node = btree_.search(key);
+  if (!node) return node_type();
+  size_--;
+  return btree_.extract(node);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+bool set<key_type, compare_type, policy_type>::contains(const key_type& key) {
+  return static_cast<bool>(btree_.search(key));
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename K, typename>
+bool set<key_type, compare_type, policy_type>::contains(const K& key) {
+  return static_cast<bool>(btree_.search(key));
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::lower_bound(const key_type& key) {
+  return iterator(btree_.lowerBound(key), &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+template <typename K, typename>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::lower_bound(const K& key) {
+  return iterator(btree_.lowerBound(key), &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::upper_bound(const key_type& key) {
+  return iterator(btree_.upperBound(key), &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+std::pair<typename set<key_type, compare_type, policy_type>::iterator,
+          typename set<key_type, compare_type, policy_type>::iterator>
+set<key_type, compare_type, policy_type>::equal_range(const key_type& key) {
+  std::pair<typename tree_type::Cursor, typename tree_type::Cursor>
+      range = btree_.equalRange(key);
+  return std::make_pair(iterator(range.first, &btree_),
+                        iterator(range.second, &btree_));
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::iterator
+set<key_type, compare_type, policy_type>::nth(size_type index) {
+  return iterator(btree_.select(index), &btree_);
+}
+
+template <typename key_type, typename compare_type, typename policy_type>
+typename set<key_type, compare_type, policy_type>::size_type
+set<key_type, compare_type, policy_type>::rank(const key_type& key) const {
+  return btree_.rank(key);
 }
 
-template <typename key_type>
-bool set<key_type>::contains(const key_type& key) {
-  return (btree_.search(key) == nullptr) ? false : true;
+template <typename key_type, typename compare_type, typename policy_type>
+std::ptrdiff_t set<key_type, compare_type, policy_type>::distance(
+    const_iterator first, const_iterator last) const {
+  return static_cast<std::ptrdiff_t>(btree_.indexOf(last.ptr_)) -
+         static_cast<std::ptrdiff_t>(btree_.indexOf(first.ptr_));
 }
 
-template <typename key_type>
+template <typename key_type, typename compare_type, typename policy_type>
 template <typename... Args>
-vector<std::pair<typename set<key_type>::iterator, bool>>
-set<key_type>::insert_many(Args&&... args) {
-  vector<std::pair<set<key_type>::iterator, bool>> res;
-  for (auto it : {args...}) res.push_back(insert(it));
+vector<std::pair<typename set<key_type, compare_type, policy_type>::iterator,
+                 bool>>
+set<key_type, compare_type, policy_type>::insert_many(Args&&... args) {
+  vector<std::pair<iterator, bool>> res;
+  (res.push_back(insert(std::forward<Args>(args))), ...);
   return res;
 }
 }  // namespace s21
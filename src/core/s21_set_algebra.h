@@ -0,0 +1,206 @@
+#ifndef SRC_CORE_S21_SET_ALGEBRA_H_
+#define SRC_CORE_S21_SET_ALGEBRA_H_
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "s21_multiset.h"
+#include "s21_set.h"
+
+namespace s21 {
+
+/*
+  Set algebra on set and multiset.
+
+  Both operands are walked in key order at once and the result is made by
+  the sorted bulk build, so every operation costs O(n + m) and copies each
+  key of the result exactly once, straight into its node.
+
+  For multisets the operations follow std::set_union and friends: a key
+  found m times in lhs and n times in rhs is taken max(m, n) times by the
+  union, min(m, n) times by the intersection, max(m - n, 0) times by the
+  difference and |m - n| times by the symmetric difference.
+*/
+
+enum class SetOperation {
+  kUnion,
+  kIntersection,
+  kDifference,
+  kSymmetricDifference
+};
+
+// Forward iterator over the result of op applied to two sorted ranges
+template <typename InputIt, typename Compare, SetOperation op>
+class SetOperationIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename InputIt::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type*;
+  using reference = const value_type&;
+
+ public:
+  SetOperationIterator(InputIt first1, InputIt last1, InputIt first2,
+                       InputIt last2, Compare compare)
+      : first1_(first1),
+        last1_(last1),
+        first2_(first2),
+        last2_(last2),
+        compare_(compare) {
+    settle();
+  }
+
+  bool operator==(const SetOperationIterator& other) {
+    return first1_ == other.first1_ && first2_ == other.first2_;
+  }
+  bool operator!=(const SetOperationIterator& other) {
+    return !(*this == other);
+  }
+
+  SetOperationIterator& operator++() {
+    if (source_ != Source::kSecond) ++first1_;
+    if (source_ != Source::kFirst) ++first2_;
+    settle();
+    return *this;
+  }
+
+  SetOperationIterator operator++(int) {
+    SetOperationIterator temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  reference operator*() {
+    return (source_ == Source::kSecond) ? *first2_ : *first1_;
+  }
+
+ private:
+  // Where the current key is found, kBoth for keys in both ranges
+  enum class Source { kFirst, kSecond, kBoth };
+
+  static constexpr bool kKeepFirst = op != SetOperation::kIntersection;
+  static constexpr bool kKeepSecond =
+      op == SetOperation::kUnion || op == SetOperation::kSymmetricDifference;
+  static constexpr bool kKeepBoth =
+      op == SetOperation::kUnion || op == SetOperation::kIntersection;
+
+  InputIt first1_;
+  InputIt last1_;
+  InputIt first2_;
+  InputIt last2_;
+  Compare compare_;
+  Source source_ = Source::kBoth;
+
+ private:
+  void settle();
+};
+
+// Skips the keys op drops, up to the next key of the result or the end
+template <typename InputIt, typename Compare, SetOperation op>
+void SetOperationIterator<InputIt, Compare, op>::settle() {
+  while (first1_ != last1_ || first2_ != last2_) {
+    // Once a range runs out, nothing more of the other one may be kept
+    if ((!kKeepSecond && first1_ == last1_) ||
+        (!kKeepFirst && first2_ == last2_)) {
+      first1_ = last1_;
+      first2_ = last2_;
+      return;
+    }
+
+    if (first2_ == last2_ ||
+        (first1_ != last1_ && compare_(*first1_, *first2_))) {
+      source_ = Source::kFirst;
+      if (kKeepFirst) return;
+      ++first1_;
+    } else if (first1_ == last1_ || compare_(*first2_, *first1_)) {
+      source_ = Source::kSecond;
+      if (kKeepSecond) return;
+      ++first2_;
+    } else {
+      source_ = Source::kBoth;
+      if (kKeepBoth) return;
+      ++first1_;
+      ++first2_;
+    }
+  }
+}
+
+// The result is walked once into a buffer of references to the keys, so
+// the two passes of the sorted build run over contiguous memory
+template <SetOperation op, typename TreeSet>
+TreeSet applySetOperation(const TreeSet& lhs, const TreeSet& rhs) {
+  using walker = SetOperationIterator<typename TreeSet::const_iterator,
+                                      typename TreeSet::key_compare, op>;
+  using key_ref = std::reference_wrapper<const typename TreeSet::key_type>;
+
+  vector<key_ref> keys;
+  keys.reserve(op == SetOperation::kIntersection
+                   ? std::min(lhs.size(), rhs.size())
+                   : lhs.size() + rhs.size());
+  walker last(lhs.end(), lhs.end(), rhs.end(), rhs.end(), lhs.key_comp());
+  for (walker it(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                 lhs.key_comp());
+       it != last; ++it)
+    keys.push_back(*it);
+  return TreeSet(keys.begin(), keys.end(), sorted_tag);
+}
+
+template <typename KeyT, typename Compare, typename Policy>
+set<KeyT, Compare, Policy> set_union(const set<KeyT, Compare, Policy>& lhs,
+                                     const set<KeyT, Compare, Policy>& rhs) {
+  return applySetOperation<SetOperation::kUnion>(lhs, rhs);
+}
+
+template <typename KeyT, typename Compare, typename Policy>
+set<KeyT, Compare, Policy> set_intersection(
+    const set<KeyT, Compare, Policy>& lhs,
+    const set<KeyT, Compare, Policy>& rhs) {
+  return applySetOperation<SetOperation::kIntersection>(lhs, rhs);
+}
+
+template <typename KeyT, typename Compare, typename Policy>
+set<KeyT, Compare, Policy> set_difference(
+    const set<KeyT, Compare, Policy>& lhs,
+    const set<KeyT, Compare, Policy>& rhs) {
+  return applySetOperation<SetOperation::kDifference>(lhs, rhs);
+}
+
+template <typename KeyT, typename Compare, typename Policy>
+set<KeyT, Compare, Policy> set_symmetric_difference(
+    const set<KeyT, Compare, Policy>& lhs,
+    const set<KeyT, Compare, Policy>& rhs) {
+  return applySetOperation<SetOperation::kSymmetricDifference>(lhs, rhs);
+}
+
+template <typename KeyT, typename Compare, typename Policy>
+multiset<KeyT, Compare, Policy> set_union(
+    const multiset<KeyT, Compare, Policy>& lhs,
+    const multiset<KeyT, Compare, Policy>& rhs) {
+  return applySetOperation<SetOperation::kUnion>(lhs, rhs);
+}
+
+template <typename KeyT, typename Compare, typename Policy>
+multiset<KeyT, Compare, Policy> set_intersection(
+    const multiset<KeyT, Compare, Policy>& lhs,
+    const multiset<KeyT, Compare, Policy>& rhs) {
+  return applySetOperation<SetOperation::kIntersection>(lhs, rhs);
+}
+
+template <typename KeyT, typename Compare, typename Policy>
+multiset<KeyT, Compare, Policy> set_difference(
+    const multiset<KeyT, Compare, Policy>& lhs,
+    const multiset<KeyT, Compare, Policy>& rhs) {
+  return applySetOperation<SetOperation::kDifference>(lhs, rhs);
+}
+
+template <typename KeyT, typename Compare, typename Policy>
+multiset<KeyT, Compare, Policy> set_symmetric_difference(
+    const multiset<KeyT, Compare, Policy>& lhs,
+    const multiset<KeyT, Compare, Policy>& rhs) {
+  return applySetOperation<SetOperation::kSymmetricDifference>(lhs, rhs);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_SET_ALGEBRA_H_
@@ -0,0 +1,644 @@
+#ifndef SRC_CORE_S21_SMALL_VECTOR_H_
+#define SRC_CORE_S21_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_container.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+  Vector keeping up to N elements inside the object itself, with the
+  interface of s21::vector.
+
+  A small_vector holding N elements or fewer allocates nothing: they sit in
+  an inline buffer and the capacity is N. The first push past N moves them
+  to the heap, from where the buffer grows as the Growth policy says, just
+  like a vector. shrink_to_fit() brings them back inline once they fit.
+
+  Moving or swapping a small_vector whose elements are inline moves the
+  elements one by one instead of handing over a pointer, so it is linear
+  in N and invalidates iterators to them. The iterators are those of
+  s21::vector<T>.
+*/
+template <typename T, std::size_t N, typename Growth = growth_policy<>>
+class small_vector : public IContainer {
+  static_assert(N > 0, "A small_vector needs room for one element inline");
+
+  // Types
+ public:
+  using typename IContainer::size_type;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = typename vector<T>::iterator;
+  using const_iterator = typename vector<T>::const_iterator;
+
+  static constexpr size_type inline_capacity = N;
+
+  // Public Methods
+ public:
+  small_vector() noexcept;
+  small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const& items);
+  small_vector(const small_vector& other);
+  small_vector(small_vector&& other) noexcept(kNothrowMove);
+  ~small_vector();
+
+  small_vector& operator=(const small_vector& other);
+  small_vector& operator=(small_vector&& other) noexcept(kNothrowMove);
+
+  static size_type max_size() { return vector<T>::max_size(); }
+
+  size_type capacity() const noexcept { return capacity_; }
+  size_type size() const noexcept override { return size_; }
+  bool empty() const noexcept override { return size_ == 0; }
+  void clear();
+
+  value_type* data() noexcept { return data_; }
+  const value_type* data() const noexcept { return data_; }
+
+  iterator begin() { return iterator(data_); }
+  const_iterator begin() const { return const_iterator(data_); }
+
+  iterator end() { return iterator(data_ + size_); }
+  const_iterator end() const { return const_iterator(data_ + size_); }
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+
+  reference operator[](size_type pos) { return data_[pos]; }
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+
+  const_reference front() const { return data_[0]; }
+  const_reference back() const { return data_[size_ - 1]; }
+
+  void reserve(size_type size);
+  void reserve_exact(size_type size);
+  void shrink_to_fit();
+
+  void swap(small_vector& other) noexcept(kNothrowMove);
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename ForwardIt,
+            typename = std::enable_if_t<!std::is_integral_v<ForwardIt>>>
+  iterator insert(const_iterator pos, ForwardIt first, ForwardIt last);
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  void pop_back();
+  void erase(iterator pos);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+
+  bool operator==(const small_vector& other) const;
+  bool operator!=(const small_vector& other) const;
+
+  // Data
+ private:
+  static constexpr bool kRelocatable = is_trivially_relocatable_v<T>;
+  static constexpr bool kNothrowMove =
+      std::is_nothrow_move_constructible_v<T>;
+
+  size_type size_;
+  size_type capacity_;
+  value_type* data_;
+  alignas(T) std::byte inline_[N * sizeof(T)];
+
+  // Private Methods
+ private:
+  value_type* inlineData() noexcept {
+    return reinterpret_cast<value_type*>(inline_);
+  }
+  const value_type* inlineData() const noexcept {
+    return reinterpret_cast<const value_type*>(inline_);
+  }
+  bool isInline() const noexcept { return data_ == inlineData(); }
+
+  void makeData(size_type newCapacity, bool exact);
+  void moveElements(value_type* to);
+  void freeData() noexcept;
+  void takeElements(small_vector&& other);
+  void shiftTail(size_type from, size_type to);
+  void growCapacity(size_type needed);
+
+  size_type checkedIndex(const_iterator pos) const;
+  bool aliases(const void* ptr) const noexcept;
+  size_type openGap(const_iterator pos, size_type count);
+  void closeGap(size_type index, size_type count, size_type built);
+};
+
+template <typename T, std::size_t N, typename Growth>
+small_vector<T, N, Growth>::small_vector() noexcept
+    : size_{0}, capacity_{N}, data_{inlineData()} {}
+
+// The constructors delegate to the default one, so should they throw, the
+// destructor frees what was built
+template <typename T, std::size_t N, typename Growth>
+small_vector<T, N, Growth>::small_vector(size_type n) : small_vector() {
+  reserve_exact(n);
+
+  for (; size_ < n; size_++) {
+    new (data_ + size_) value_type();
+  }
+}
+
+template <typename T, std::size_t N, typename Growth>
+small_vector<T, N, Growth>::small_vector(
+    std::initializer_list<value_type> const& items)
+    : small_vector() {
+  insert(end(), items.begin(), items.end());
+}
+
+template <typename T, std::size_t N, typename Growth>
+small_vector<T, N, Growth>::small_vector(const small_vector& other)
+    : small_vector() {
+  insert(end(), other.begin(), other.end());
+}
+
+template <typename T, std::size_t N, typename Growth>
+small_vector<T, N, Growth>::small_vector(small_vector&& other) noexcept(
+    kNothrowMove)
+    : small_vector() {
+  takeElements(std::move(other));
+}
+
+template <typename T, std::size_t N, typename Growth>
+small_vector<T, N, Growth>::~small_vector() {
+  freeData();
+}
+
+template <typename T, std::size_t N, typename Growth>
+small_vector<T, N, Growth>& small_vector<T, N, Growth>::operator=(
+    const small_vector& other) {
+  if (this != &other) {
+    small_vector tmp{other};
+    *this = std::move(tmp);
+  }
+
+  return *this;
+}
+
+template <typename T, std::size_t N, typename Growth>
+small_vector<T, N, Growth>& small_vector<T, N, Growth>::operator=(
+    small_vector&& other) noexcept(kNothrowMove) {
+  if (this != &other) {
+    freeData();
+    takeElements(std::move(other));
+  }
+
+  return *this;
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::swap(small_vector& other) noexcept(
+    kNothrowMove) {
+  if (this == &other) return;
+
+  if (!isInline() && !other.isInline()) {
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(data_, other.data_);
+  } else {
+    small_vector tmp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::clear() {
+  for (size_type i = 0; i < size_; i++) {
+    (data_ + i)->~value_type();
+  }
+
+  size_ = 0;
+}
+
+template <typename T, std::size_t N, typename Growth>
+typename small_vector<T, N, Growth>::reference small_vector<T, N, Growth>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of vector boundary");
+
+  return data_[pos];
+}
+
+template <typename T, std::size_t N, typename Growth>
+typename small_vector<T, N, Growth>::const_reference
+small_vector<T, N, Growth>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of vector boundary");
+
+  return data_[pos];
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::reserve(size_type newCapacity) {
+  if (newCapacity <= capacity_) return;
+  makeData(newCapacity, false);
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::reserve_exact(size_type newCapacity) {
+  if (newCapacity <= capacity_) return;
+  makeData(newCapacity, true);
+}
+
+// Brings the elements back inline when they fit there
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::shrink_to_fit() {
+  if (size_ == capacity_ || isInline()) return;
+  makeData(size_, true);
+}
+
+/*
+  Moves the elements into a buffer of newCapacity: the inline one when they
+  fit in it, a heap block otherwise. A heap block of relocatable elements
+  is grown with realloc. Unless exact is set, the policy may let the
+  vector take up the slack at the end of the block.
+*/
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::makeData(size_type newCapacity, bool exact) {
+  if (newCapacity > max_size())
+    throw std::length_error("Cannot expand s21::vector larger than max_size()");
+
+  if (newCapacity <= N) {
+    if (!isInline()) {
+      value_type* heapData = data_;
+      moveElements(inlineData());
+      std::free(heapData);
+    }
+    capacity_ = N;
+    return;
+  }
+
+  if (kRelocatable && !isInline()) {
+    void* ptr = std::realloc(static_cast<void*>(data_),
+                             newCapacity * sizeof(value_type));
+    if (ptr == nullptr) throw std::bad_alloc();
+    data_ = static_cast<value_type*>(ptr);
+  } else {
+    void* ptr = std::malloc(newCapacity * sizeof(value_type));
+    if (ptr == nullptr) throw std::bad_alloc();
+    value_type* oldData = data_;
+    try {
+      moveElements(static_cast<value_type*>(ptr));
+    } catch (...) {
+      std::free(ptr);
+      throw;
+    }
+    if (oldData != inlineData()) std::free(oldData);
+  }
+
+#if defined(__GLIBC__)
+  if constexpr (Growth::usable_size) {
+    if (!exact) {
+      size_type usable = malloc_usable_size(data_) / sizeof(value_type);
+      newCapacity = std::max(newCapacity, std::min(usable, max_size()));
+    }
+  }
+#else
+  (void)exact;
+#endif
+  capacity_ = newCapacity;
+}
+
+// Moves the elements into the empty buffer to, which data_ then points at.
+// If a move throws, the elements stay where they were.
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::moveElements(value_type* to) {
+  if constexpr (kRelocatable) {
+    std::memcpy(static_cast<void*>(to), static_cast<const void*>(data_),
+                size_ * sizeof(value_type));
+  } else {
+    for (size_type i = 0; i < size_; i++) {
+      try {
+        new (to + i) value_type(std::move(data_[i]));
+      } catch (...) {
+        for (size_type j = 0; j < i; j++) {
+          (to + j)->~value_type();
+        }
+        throw;
+      }
+    }
+
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_type i = 0; i < size_; i++) {
+        (data_ + i)->~value_type();
+      }
+    }
+  }
+
+  data_ = to;
+}
+
+// Destroys the elements and returns to the empty inline buffer
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::freeData() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<value_type>) {
+    for (size_type i = 0; i < size_; i++) {
+      (data_ + i)->~value_type();
+    }
+  }
+
+  if (!isInline()) std::free(data_);
+  data_ = inlineData();
+  size_ = 0;
+  capacity_ = N;
+}
+
+// Takes over the heap block of other, or moves its inline elements over.
+// This vector must be empty and inline.
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::takeElements(small_vector&& other) {
+  if (other.isInline()) {
+    data_ = other.data_;
+    size_ = other.size_;
+    try {
+      moveElements(inlineData());
+    } catch (...) {
+      data_ = inlineData();
+      size_ = 0;
+      throw;
+    }
+    other.data_ = other.inlineData();
+    other.size_ = 0;
+  } else {
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    data_ = other.data_;
+    other.data_ = other.inlineData();
+    other.size_ = 0;
+    other.capacity_ = N;
+  }
+}
+
+// Moves the elements from index from to the end so that they start at
+// index to, the same way s21::vector does
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::shiftTail(size_type from, size_type to) {
+  if (from == to) return;
+
+  const size_type count = size_ - from;
+  if constexpr (kRelocatable) {
+    std::memmove(static_cast<void*>(data_ + to),
+                 static_cast<const void*>(data_ + from),
+                 count * sizeof(value_type));
+  } else if (to > from) {
+    for (size_type i = count; i > 0; i--) {
+      new (data_ + to + i - 1) value_type(std::move(data_[from + i - 1]));
+      (data_ + from + i - 1)->~value_type();
+    }
+  } else {
+    for (size_type i = 0; i < count; i++) {
+      new (data_ + to + i) value_type(std::move(data_[from + i]));
+      (data_ + from + i)->~value_type();
+    }
+  }
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::growCapacity(size_type needed) {
+  size_type newCapacity = Growth::grow(capacity_, needed, sizeof(value_type));
+  reserve(std::max(needed, std::min(newCapacity, max_size())));
+}
+
+template <typename T, std::size_t N, typename Growth>
+typename small_vector<T, N, Growth>::size_type
+small_vector<T, N, Growth>::checkedIndex(const_iterator pos) const {
+  const auto index = (size_type)const_iterator::distance(begin(), pos);
+  if (index > size_)
+    throw std::out_of_range("Selected position is out of range of the vector");
+
+  return index;
+}
+
+template <typename T, std::size_t N, typename Growth>
+bool small_vector<T, N, Growth>::aliases(const void* ptr) const noexcept {
+  const std::less_equal<const void*> lessEqual;
+  return size_ != 0 && lessEqual(data_, ptr) && !lessEqual(data_ + size_, ptr);
+}
+
+// Makes room for count elements at pos like s21::vector::openGap()
+template <typename T, std::size_t N, typename Growth>
+typename small_vector<T, N, Growth>::size_type
+small_vector<T, N, Growth>::openGap(const_iterator pos, size_type count) {
+  const size_type index = checkedIndex(pos);
+  if (count > max_size() - size_)
+    throw std::length_error("Cannot expand s21::vector larger than max_size()");
+
+  if (size_ + count > capacity_) growCapacity(size_ + count);
+
+  shiftTail(index, index + count);
+  size_ += count;
+
+  return index;
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::closeGap(size_type index, size_type count,
+                                          size_type built) {
+  for (size_type i = 0; i < built; i++) {
+    (data_ + index + i)->~value_type();
+  }
+
+  shiftTail(index + count, index);
+  size_ -= count;
+}
+
+template <typename T, std::size_t N, typename Growth>
+typename small_vector<T, N, Growth>::iterator
+small_vector<T, N, Growth>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, std::size_t N, typename Growth>
+typename small_vector<T, N, Growth>::iterator
+small_vector<T, N, Growth>::insert(iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, std::size_t N, typename Growth>
+typename small_vector<T, N, Growth>::iterator
+small_vector<T, N, Growth>::insert(const_iterator pos, size_type count,
+                                   const_reference value) {
+  if (aliases(&value)) {
+    value_type tmp{value};
+    return insert(pos, count, tmp);
+  }
+
+  const size_type index = openGap(pos, count);
+  size_type built = 0;
+  try {
+    for (; built < count; built++) {
+      new (data_ + index + built) value_type(value);
+    }
+  } catch (...) {
+    closeGap(index, count, built);
+    throw;
+  }
+
+  return begin() + index;
+}
+
+template <typename T, std::size_t N, typename Growth>
+template <typename ForwardIt, typename>
+typename small_vector<T, N, Growth>::iterator
+small_vector<T, N, Growth>::insert(const_iterator pos, ForwardIt first,
+                                   ForwardIt last) {
+  size_type count = 0;
+  for (ForwardIt it = first; it != last; ++it) {
+    count++;
+  }
+
+  const size_type index = openGap(pos, count);
+  size_type built = 0;
+  try {
+    for (; built < count; built++, ++first) {
+      new (data_ + index + built) value_type(*first);
+    }
+  } catch (...) {
+    closeGap(index, count, built);
+    throw;
+  }
+
+  return begin() + index;
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::pop_back() {
+  if (empty()) throw std::out_of_range("Vector is empty");
+  --size_;
+
+  (data_ + size_)->~value_type();
+}
+
+template <typename T, std::size_t N, typename Growth>
+void small_vector<T, N, Growth>::erase(iterator pos) {
+  const auto index = (size_type)iterator::distance(begin(), pos);
+  if (index >= size_) return;
+
+  (data_ + index)->~value_type();
+  shiftTail(index + 1, index);
+
+  --size_;
+}
+
+template <typename T, std::size_t N, typename Growth>
+template <typename... Args>
+typename small_vector<T, N, Growth>::iterator
+small_vector<T, N, Growth>::emplace(const_iterator pos, Args&&... args) {
+  if ((aliases(&args) || ...)) {
+    value_type tmp(std::forward<Args>(args)...);
+    return emplace(pos, std::move(tmp));
+  }
+
+  const size_type index = openGap(pos, 1);
+  try {
+    new (data_ + index) value_type(std::forward<Args>(args)...);
+  } catch (...) {
+    closeGap(index, 1, 0);
+    throw;
+  }
+
+  return begin() + index;
+}
+
+template <typename T, std::size_t N, typename Growth>
+template <typename... Args>
+typename small_vector<T, N, Growth>::reference
+small_vector<T, N, Growth>::emplace_back(Args&&... args) {
+  if (size_ >= capacity_) {
+    if ((aliases(&args) || ...)) {
+      value_type tmp(std::forward<Args>(args)...);
+      return emplace_back(std::move(tmp));
+    }
+    growCapacity(size_ + 1);
+  }
+
+  new (data_ + size_) value_type(std::forward<Args>(args)...);
+  ++size_;
+
+  return data_[size_ - 1];
+}
+
+template <typename T, std::size_t N, typename Growth>
+template <typename... Args>
+void small_vector<T, N, Growth>::insert_many_back(Args&&... args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, std::size_t N, typename Growth>
+template <typename... Args>
+typename small_vector<T, N, Growth>::iterator
+small_vector<T, N, Growth>::insert_many(const_iterator pos, Args&&... args) {
+  constexpr size_type count = sizeof...(Args);
+
+  if ((aliases(&args) || ...)) {
+    small_vector items;
+    items.reserve(count);
+    (items.emplace_back(std::forward<Args>(args)), ...);
+    return insert(pos, std::make_move_iterator(items.begin()),
+                  std::make_move_iterator(items.end())) +
+           count;
+  }
+
+  const size_type index = openGap(pos, count);
+  size_type built = 0;
+  try {
+    ((new (data_ + index + built) value_type(std::forward<Args>(args)),
+      built++),
+     ...);
+  } catch (...) {
+    closeGap(index, count, built);
+    throw;
+  }
+
+  return begin() + index + count;
+}
+
+template <typename T, std::size_t N, typename Growth>
+bool small_vector<T, N, Growth>::operator==(const small_vector& other) const {
+  if (this == &other) return true;
+  if (size() != other.size()) return false;
+
+  return std::equal(data_, data_ + size_, other.data_);
+}
+
+template <typename T, std::size_t N, typename Growth>
+bool small_vector<T, N, Growth>::operator!=(const small_vector& other) const {
+  return !(*this == other);
+}
+
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_SMALL_VECTOR_H_
@@ -0,0 +1,255 @@
+#ifndef SRC_CORE_S21_STATIC_MAP_H_
+#define SRC_CORE_S21_STATIC_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_container.h"
+#include "s21_map.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+  Read-only map laid out for lookups, made once from a map or a range by
+  freeze() or a constructor and never changed after that.
+
+  The keys sit in one array in Eytzinger order: the implicit binary search
+  tree is stored level by level, so index k has its children at 2k and
+  2k + 1 and the top levels of every search share the first cache lines.
+  The mapped values sit in a second array in the same order and are only
+  touched once the key is found. Index 0 is unused and stands for end().
+
+  A search descends with k = 2k + (key of k < key) and no branch on the
+  outcome. It prefetches the line holding the 16 descendants four levels
+  down, so the memory latency of deep levels overlaps with the
+  comparisons. Iteration is in key order and yields
+  std::pair<const key_type&, const mapped_type&>.
+*/
+template <typename KeyT, typename ValT, typename Compare = std::less<KeyT>>
+class static_map : public IContainer {
+ public:
+  class StaticMapIterator;
+
+  using key_type = KeyT;
+  using mapped_type = ValT;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = std::pair<const key_type&, const mapped_type&>;
+  using const_reference = reference;
+  using iterator = StaticMapIterator;
+  using const_iterator = StaticMapIterator;
+  using typename IContainer::size_type;
+  using key_compare = Compare;
+
+ public:
+  static_map() = default;
+  template <typename Policy>
+  explicit static_map(const map<KeyT, ValT, Compare, Policy>& source);
+  template <typename ForwardIt>
+  static_map(ForwardIt first, ForwardIt last);
+
+  const mapped_type& at(const key_type& key) const;
+  bool contains(const key_type& key) const;
+  iterator find(const key_type& key) const;
+  iterator lower_bound(const key_type& key) const;
+
+  iterator begin() const;
+  iterator end() const { return iterator(this, 0); }
+
+  bool empty() const noexcept override { return size_ == 0; }
+  size_type size() const noexcept override { return size_; }
+  key_compare key_comp() const { return compare_; }
+
+ private:
+  // Levels between a node and the descendants prefetched for it
+  static constexpr size_type kPrefetchDepth = 4;
+
+  vector<key_type> keys_;
+  vector<mapped_type> values_;
+  size_type size_ = 0;
+  Compare compare_;
+
+ private:
+  template <typename ForwardIt>
+  void build(ForwardIt first, ForwardIt last);
+  size_type lowerBoundIndex(const key_type& key) const;
+  size_type leftmost(size_type index) const;
+  size_type next(size_type index) const;
+};
+
+template <typename KeyT, typename ValT, typename Compare>
+class static_map<KeyT, ValT, Compare>::StaticMapIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::pair<const KeyT, ValT>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = std::pair<const KeyT&, const ValT&>;
+
+ public:
+  StaticMapIterator() = default;
+  StaticMapIterator(const static_map* owner, size_type index)
+      : owner_(owner), index_(index) {}
+
+  bool operator==(const StaticMapIterator& other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const StaticMapIterator& other) const {
+    return !(*this == other);
+  }
+
+  StaticMapIterator& operator++() {
+    index_ = owner_->next(index_);
+    return *this;
+  }
+
+  StaticMapIterator operator++(int) {
+    StaticMapIterator temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  reference operator*() const {
+    return reference(owner_->keys_[index_], owner_->values_[index_]);
+  }
+
+ private:
+  const static_map* owner_ = nullptr;
+  size_type index_ = 0;
+};
+
+// Builds the static map holding the pairs of source
+template <typename KeyT, typename ValT, typename Compare, typename Policy>
+static_map<KeyT, ValT, Compare> freeze(
+    const map<KeyT, ValT, Compare, Policy>& source) {
+  return static_map<KeyT, ValT, Compare>(source);
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+template <typename Policy>
+static_map<KeyT, ValT, Compare>::static_map(
+    const map<KeyT, ValT, Compare, Policy>& source)
+    : compare_(source.key_comp()) {
+  build(source.begin(), source.end());
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+template <typename ForwardIt>
+static_map<KeyT, ValT, Compare>::static_map(ForwardIt first, ForwardIt last) {
+  build(first, last);
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+const ValT& static_map<KeyT, ValT, Compare>::at(const key_type& key) const {
+  size_type index = lowerBoundIndex(key);
+  if (index == 0 || compare_(key, keys_[index]))
+    throw std::out_of_range("Element with the current key was not found!");
+  return values_[index];
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+bool static_map<KeyT, ValT, Compare>::contains(const key_type& key) const {
+  size_type index = lowerBoundIndex(key);
+  return index != 0 && !compare_(key, keys_[index]);
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+typename static_map<KeyT, ValT, Compare>::iterator
+static_map<KeyT, ValT, Compare>::find(const key_type& key) const {
+  size_type index = lowerBoundIndex(key);
+  if (index != 0 && compare_(key, keys_[index])) index = 0;
+  return iterator(this, index);
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+typename static_map<KeyT, ValT, Compare>::iterator
+static_map<KeyT, ValT, Compare>::lower_bound(const key_type& key) const {
+  return iterator(this, lowerBoundIndex(key));
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+typename static_map<KeyT, ValT, Compare>::iterator
+static_map<KeyT, ValT, Compare>::begin() const {
+  return iterator(this, size_ == 0 ? 0 : leftmost(1));
+}
+
+/*
+  Copies the pairs of [first, last) in Eytzinger order. The range is
+  sorted first unless it already is, and of equal keys the first is kept.
+  An in-order walk of the implicit tree gives the rank of every index.
+*/
+template <typename KeyT, typename ValT, typename Compare>
+template <typename ForwardIt>
+void static_map<KeyT, ValT, Compare>::build(ForwardIt first, ForwardIt last) {
+  using source_pointer = std::remove_reference_t<decltype(*first)>*;
+  auto keyLess = [this](source_pointer a, source_pointer b) {
+    return compare_(a->first, b->first);
+  };
+
+  vector<source_pointer> sorted;
+  for (; first != last; ++first) sorted.push_back(std::addressof(*first));
+  source_pointer* begin = sorted.data();
+  source_pointer* end = begin + sorted.size();
+  if (!std::is_sorted(begin, end, keyLess))
+    std::stable_sort(begin, end, keyLess);
+  end = std::unique(begin, end,
+                    [&keyLess](source_pointer a, source_pointer b) {
+                      return !keyLess(a, b);
+                    });
+
+  size_ = end - begin;
+  if (size_ == 0) return;
+
+  vector<size_type> rank(size_ + 1);
+  size_type count = 0;
+  for (size_type index = leftmost(1); index != 0; index = next(index))
+    rank[index] = count++;
+
+  keys_.reserve(size_ + 1);
+  values_.reserve(size_ + 1);
+  keys_.push_back(begin[0]->first);
+  values_.push_back(begin[0]->second);
+  for (size_type index = 1; index <= size_; ++index) {
+    keys_.push_back(begin[rank[index]]->first);
+    values_.push_back(begin[rank[index]]->second);
+  }
+}
+
+// Index of the least key not less than key, or 0 when there is none. The
+// descent ends in a right turn after the last left one: shifting off the
+// trailing right turns and that left turn leaves the answer.
+template <typename KeyT, typename ValT, typename Compare>
+typename static_map<KeyT, ValT, Compare>::size_type
+static_map<KeyT, ValT, Compare>::lowerBoundIndex(const key_type& key) const {
+  const key_type* keys = keys_.data();
+  size_type index = 1;
+  while (index <= size_) {
+    __builtin_prefetch(keys + std::min(index << kPrefetchDepth, size_));
+    index = 2 * index + compare_(keys[index], key);
+  }
+  return index >> __builtin_ffsll(static_cast<long long>(~index));
+}
+
+template <typename KeyT, typename ValT, typename Compare>
+typename static_map<KeyT, ValT, Compare>::size_type
+static_map<KeyT, ValT, Compare>::leftmost(size_type index) const {
+  while (2 * index <= size_) index *= 2;
+  return index;
+}
+
+// In-order successor: the leftmost index of the right subtree, otherwise
+// the first ancestor reached from its left side
+template <typename KeyT, typename ValT, typename Compare>
+typename static_map<KeyT, ValT, Compare>::size_type
+static_map<KeyT, ValT, Compare>::next(size_type index) const {
+  if (2 * index + 1 <= size_) return leftmost(2 * index + 1);
+  while (index & 1) index >>= 1;
+  return index >> 1;
+}
+
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_STATIC_MAP_H_
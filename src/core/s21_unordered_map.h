@@ -0,0 +1,487 @@
+#ifndef SRC_CORE_S21_UNORDERED_MAP_H_
+#define SRC_CORE_S21_UNORDERED_MAP_H_
+
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_container.h"
+#include "s21_hash_table.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+  Map with unique keys kept in an open addressing hash table.
+
+  A lookup hashes the key and compares it against the few keys whose
+  control bytes match, instead of chasing log(n) pointers as s21::map
+  does. Iteration is in no particular order. The pairs live in the slots of
+  the table: an insert that grows it moves them and invalidates all
+  iterators, so reserve() ahead of bulk inserts. An erase invalidates
+  iterators to the erased pair only.
+*/
+template <typename KeyT, typename ValT, typename Hash = std::hash<KeyT>,
+          typename KeyEqual = std::equal_to<KeyT>>
+class unordered_map : public IContainer {
+ public:
+  using key_type = KeyT;
+  using mapped_type = ValT;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using table_type = HashTable<KeyT, ValT, Hash, KeyEqual>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using typename IContainer::size_type;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+ public:
+  unordered_map();
+  explicit unordered_map(size_type bucket_count);
+  unordered_map(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  unordered_map(InputIt first, InputIt last);
+  unordered_map(const unordered_map& other);
+  unordered_map(unordered_map&& other) noexcept;
+  ~unordered_map(){};
+
+  unordered_map& operator=(const unordered_map& other);
+  unordered_map& operator=(unordered_map&& other);
+  mapped_type& at(const key_type& key);
+  const mapped_type& at(const key_type& key) const;
+  template <typename K, typename = transparent_hash_key_t<Hash, KeyEqual, K>>
+  mapped_type& at(const K& key);
+  template <typename K, typename = transparent_hash_key_t<Hash, KeyEqual, K>>
+  const mapped_type& at(const K& key) const;
+  mapped_type& operator[](const key_type& key);
+  mapped_type& operator[](key_type&& key);
+
+  bool operator==(const unordered_map& other) const;
+  bool operator!=(const unordered_map& other) const;
+
+  iterator begin() { return table_.begin(); }
+  const_iterator begin() const { return table_.begin(); }
+  iterator end() { return table_.end(); }
+  const_iterator end() const { return table_.end(); }
+
+  bool empty() const noexcept override { return table_.isEmpty(); }
+  size_type size() const noexcept override { return table_.size(); }
+  static size_type max_size();
+
+  size_type bucket_count() const noexcept { return table_.bucketCount(); }
+  float load_factor() const noexcept;
+  float max_load_factor() const noexcept { return 0.875f; }
+  void reserve(size_type count) { table_.reserve(count); }
+  void rehash(size_type count) { table_.rehash(count); }
+  hasher hash_function() const { return table_.hashFunction(); }
+  key_equal key_eq() const { return table_.keyEq(); }
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args);
+  std::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                             const mapped_type& obj);
+
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type& key);
+  // Iterators convert to const_iterator and keep to erase(pos)
+  template <typename K, typename = transparent_hash_key_t<Hash, KeyEqual, K>,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<const K&, const_iterator>>>
+  size_type erase(const K& key);
+  void swap(unordered_map& other);
+  void merge(unordered_map& other);
+  iterator find(const key_type& key);
+  const_iterator find(const key_type& key) const;
+  template <typename K, typename = transparent_hash_key_t<Hash, KeyEqual, K>>
+  iterator find(const K& key);
+  template <typename K, typename = transparent_hash_key_t<Hash, KeyEqual, K>>
+  const_iterator find(const K& key) const;
+  bool contains(const key_type& key) const;
+  template <typename K, typename = transparent_hash_key_t<Hash, KeyEqual, K>>
+  bool contains(const K& key) const;
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+ private:
+  table_type table_;
+};
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+bool unordered_map<key_type, mapped_type, hash_type, equal_type>::operator==(
+    const unordered_map& other) const {
+  if (this == &other) return true;
+  if (size() != other.size()) return false;
+
+  for (const value_type& item : *this) {
+    const_iterator found = other.find(item.first);
+    if (found == other.end() || !(found->second == item.second)) return false;
+  }
+  return true;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+bool unordered_map<key_type, mapped_type, hash_type, equal_type>::operator!=(
+    const unordered_map& other) const {
+  return !(*this == other);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+typename unordered_map<key_type, mapped_type, hash_type, equal_type>::size_type
+unordered_map<key_type, mapped_type, hash_type, equal_type>::max_size() {
+  return std::numeric_limits<size_type>::max() / (sizeof(value_type) + 1);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+float unordered_map<key_type, mapped_type, hash_type,
+                    equal_type>::load_factor() const noexcept {
+  if (bucket_count() == 0) return 0.0f;
+  return float(size()) / float(bucket_count());
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::unordered_map()
+    : table_() {}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::unordered_map(
+    size_type bucket_count)
+    : table_() {
+  table_.rehash(bucket_count);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::unordered_map(
+    std::initializer_list<value_type> const& items)
+    : table_() {
+  table_.reserve(items.size());
+  for (const value_type& item : items) table_.insert(item);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename InputIt>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::unordered_map(
+    InputIt first, InputIt last)
+    : table_() {
+  insert(first, last);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::unordered_map(
+    const unordered_map& other)
+    : table_(other.table_) {}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::unordered_map(
+    unordered_map&& other) noexcept
+    : table_(std::move(other.table_)) {}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+unordered_map<key_type, mapped_type, hash_type, equal_type>&
+unordered_map<key_type, mapped_type, hash_type, equal_type>::operator=(
+    const unordered_map& other) {
+  table_ = other.table_;
+  return *this;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+unordered_map<key_type, mapped_type, hash_type, equal_type>&
+unordered_map<key_type, mapped_type, hash_type, equal_type>::operator=(
+    unordered_map&& other) {
+  table_ = std::move(other.table_);
+  return *this;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+mapped_type& unordered_map<key_type, mapped_type, hash_type, equal_type>::at(
+    const key_type& key) {
+  iterator temp = table_.search(key);
+  if (temp == end())
+    throw std::out_of_range("Element with the current key was not found!");
+  else
+    return temp->second;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+const mapped_type&
+unordered_map<key_type, mapped_type, hash_type, equal_type>::at(
+    const key_type& key) const {
+  const_iterator temp = table_.search(key);
+  if (temp == end())
+    throw std::out_of_range("Element with the current key was not found!");
+  else
+    return temp->second;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename K, typename>
+mapped_type& unordered_map<key_type, mapped_type, hash_type, equal_type>::at(
+    const K& key) {
+  iterator temp = table_.search(key);
+  if (temp == end())
+    throw std::out_of_range("Element with the current key was not found!");
+  else
+    return temp->second;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename K, typename>
+const mapped_type&
+unordered_map<key_type, mapped_type, hash_type, equal_type>::at(
+    const K& key) const {
+  const_iterator temp = table_.search(key);
+  if (temp == end())
+    throw std::out_of_range("Element with the current key was not found!");
+  else
+    return temp->second;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+mapped_type&
+unordered_map<key_type, mapped_type, hash_type, equal_type>::operator[](
+    const key_type& key) {
+  return try_emplace(key).first->second;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+mapped_type&
+unordered_map<key_type, mapped_type, hash_type, equal_type>::operator[](
+    key_type&& key) {
+  return try_emplace(std::move(key)).first->second;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+void unordered_map<key_type, mapped_type, hash_type, equal_type>::clear() {
+  table_.clear();
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+std::pair<typename unordered_map<key_type, mapped_type, hash_type,
+                                 equal_type>::iterator,
+          bool>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::insert(
+    const value_type& value) {
+  return table_.insert(value);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+std::pair<typename unordered_map<key_type, mapped_type, hash_type,
+                                 equal_type>::iterator,
+          bool>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::insert(
+    value_type&& value) {
+  return table_.insert(std::move(value));
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+std::pair<typename unordered_map<key_type, mapped_type, hash_type,
+                                 equal_type>::iterator,
+          bool>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::insert(
+    const key_type& key, const mapped_type& obj) {
+  return try_emplace(key, obj);
+}
+
+// A range of known length is reserved for up front, so the table grows at
+// most once
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename InputIt>
+void unordered_map<key_type, mapped_type, hash_type, equal_type>::insert(
+    InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>)
+    table_.reserve(size() + size_type(std::distance(first, last)));
+  for (; first != last; ++first) table_.insert(*first);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename... Args>
+std::pair<typename unordered_map<key_type, mapped_type, hash_type,
+                                 equal_type>::iterator,
+          bool>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::emplace(
+    Args&&... args) {
+  return table_.emplace(std::forward<Args>(args)...);
+}
+
+// Unlike emplace(), leaves args untouched when key is already in the map
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename... Args>
+std::pair<typename unordered_map<key_type, mapped_type, hash_type,
+                                 equal_type>::iterator,
+          bool>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::try_emplace(
+    const key_type& key, Args&&... args) {
+  return table_.tryEmplace(key, std::forward<Args>(args)...);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename... Args>
+std::pair<typename unordered_map<key_type, mapped_type, hash_type,
+                                 equal_type>::iterator,
+          bool>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::try_emplace(
+    key_type&& key, Args&&... args) {
+  return table_.tryEmplace(std::move(key), std::forward<Args>(args)...);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+std::pair<typename unordered_map<key_type, mapped_type, hash_type,
+                                 equal_type>::iterator,
+          bool>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::insert_or_assign(
+    const key_type& key, const mapped_type& obj) {
+  std::pair<iterator, bool> temp = try_emplace(key, obj);
+  if (!temp.second) temp.first->second = obj;
+  return temp;
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+typename unordered_map<key_type, mapped_type, hash_type, equal_type>::iterator
+unordered_map<key_type, mapped_type, hash_type, equal_type>::erase(
+    const_iterator pos) {
+  return table_.erase(pos);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+typename unordered_map<key_type, mapped_type, hash_type, equal_type>::size_type
+unordered_map<key_type, mapped_type, hash_type, equal_type>::erase(
+    const key_type& key) {
+  return table_.eraseKey(key);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename K, typename, typename>
+typename unordered_map<key_type, mapped_type, hash_type, equal_type>::size_type
+unordered_map<key_type, mapped_type, hash_type, equal_type>::erase(
+    const K& key) {
+  return table_.eraseKey(key);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+void unordered_map<key_type, mapped_type, hash_type, equal_type>::swap(
+    unordered_map& other) {
+  table_.swap(other.table_);
+}
+
+// The pairs with keys missing here are moved over, the rest stay in other
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+void unordered_map<key_type, mapped_type, hash_type, equal_type>::merge(
+    unordered_map& other) {
+  table_.merge(other.table_);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+typename unordered_map<key_type, mapped_type, hash_type, equal_type>::iterator
+unordered_map<key_type, mapped_type, hash_type, equal_type>::find(
+    const key_type& key) {
+  return table_.search(key);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+typename unordered_map<key_type, mapped_type, hash_type,
+                       equal_type>::const_iterator
+unordered_map<key_type, mapped_type, hash_type, equal_type>::find(
+    const key_type& key) const {
+  return table_.search(key);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename K, typename>
+typename unordered_map<key_type, mapped_type, hash_type, equal_type>::iterator
+unordered_map<key_type, mapped_type, hash_type, equal_type>::find(
+    const K& key) {
+  return table_.search(key);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename K, typename>
+typename unordered_map<key_type, mapped_type, hash_type,
+                       equal_type>::const_iterator
+unordered_map<key_type, mapped_type, hash_type, equal_type>::find(
+    const K& key) const {
+  return table_.search(key);
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+bool unordered_map<key_type, mapped_type, hash_type, equal_type>::contains(
+    const key_type& key) const {
+  return table_.search(key) != end();
+}
+
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename K, typename>
+bool unordered_map<key_type, mapped_type, hash_type, equal_type>::contains(
+    const K& key) const {
+  return table_.search(key) != end();
+}
+
+// Room for all pairs is made first, so the returned iterators stay valid
+template <typename key_type, typename mapped_type, typename hash_type,
+          typename equal_type>
+template <typename... Args>
+vector<std::pair<typename unordered_map<key_type, mapped_type, hash_type,
+                                        equal_type>::iterator,
+                 bool>>
+unordered_map<key_type, mapped_type, hash_type, equal_type>::insert_many(
+    Args&&... args) {
+  vector<std::pair<iterator, bool>> result;
+  result.reserve(sizeof...(Args));
+  table_.reserve(size() + sizeof...(Args));
+  (result.push_back(table_.insert(value_type(std::forward<Args>(args)))),
+   ...);
+  return result;
+}
+}  // namespace s21
+
+#endif  // SRC_CORE_S21_UNORDERED_MAP_H_
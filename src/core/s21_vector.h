@@ -2,13 +2,95 @@
 #define SRC_CORE_S21_VECTOR_H_
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 #include "s21_container.h"
 
 namespace s21 {
 
+/*
+  Growth policies of s21::vector: how far a full vector grows its buffer.
+
+  grow(capacity, needed, elementBytes) returns the capacity to grow to from
+  capacity, at least needed elements. With usable_size the vector also
+  takes up the slack the allocator leaves at the end of the block it hands
+  out (glibc rounds requests up to its size classes), so that slack holds
+  elements instead of going unused.
+
+  - growth_policy<2, 1>: doubles the capacity, as std::vector does. The
+    default.
+  - growth_policy<3, 2>: grows it by half, wasting at most a third of the
+    buffer instead of half of it, at the cost of more reallocations.
+  - page_growth_policy<>: grows like Base (by half, taking up the slack,
+    by default), then rounds buffers of a page or more up to whole pages
+    and those of a huge page or more up to whole huge pages, the units
+    the kernel maps large blocks in.
+
+  reserve_exact() and shrink_to_fit() ask for exactly the capacity given
+  whatever the policy.
+*/
+template <std::size_t Num = 2, std::size_t Den = 1, bool UsableSize = false>
+struct growth_policy {
+  static_assert(Num > Den && Den > 0, "The growth factor must exceed 1");
+
+  static constexpr bool usable_size = UsableSize;
+
+  static std::size_t grow(std::size_t capacity, std::size_t needed,
+                          std::size_t) noexcept {
+    return std::max(needed, capacity * Num / Den);
+  }
+};
+
+template <typename Base = growth_policy<3, 2, true>,
+          std::size_t PageBytes = 4096, std::size_t HugePageBytes = 2 << 20>
+struct page_growth_policy {
+  static_assert(HugePageBytes % PageBytes == 0,
+                "A huge page must be made of whole pages");
+
+  static constexpr bool usable_size = Base::usable_size;
+
+  static std::size_t grow(std::size_t capacity, std::size_t needed,
+                          std::size_t elementBytes) noexcept {
+    std::size_t bytes =
+        Base::grow(capacity, needed, elementBytes) * elementBytes;
+    std::size_t unit = bytes >= HugePageBytes ? HugePageBytes : PageBytes;
+    if (bytes >= PageBytes) bytes = (bytes + unit - 1) / unit * unit;
+    return bytes / elementBytes;
+  }
+};
+
+template <typename T, typename Growth = growth_policy<>>
+class vector;
+
+/*
+  Types whose objects may be moved to another address by copying their
+  bytes, with nothing left to destroy at the old one. s21::vector moves
+  such elements with memmove and grows their buffer with realloc, which
+  can extend it in place. Trivially copyable types qualify, as does
+  s21::vector itself. Specialize it for other types that only own memory
+  through pointers and never point into themselves (std::string of
+  libstdc++ does, through its inline buffer).
+*/
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+template <typename T, typename Growth>
+struct is_trivially_relocatable<vector<T, Growth>> : std::true_type {};
 template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+template <typename T, typename Growth>
 class vector : public IContainer {
   // Types
  public:
@@ -19,8 +101,8 @@ class vector : public IContainer {
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
-  using iterator = vector<value_type>::VectorIterator;
-  using const_iterator = vector<value_type>::VectorConstIterator;
+  using iterator = vector::VectorIterator;
+  using const_iterator = vector::VectorConstIterator;
 
   // Public Methods
  public:
@@ -31,8 +113,8 @@ class vector : public IContainer {
   vector(vector&& other) noexcept;
   ~vector();
 
-  vector<value_type>& operator=(const vector<value_type>& other);
-  vector<value_type>& operator=(vector<value_type>&& other);
+  vector& operator=(const vector& other);
+  vector& operator=(vector&& other);
 
   static size_type max_size();
 
@@ -59,22 +141,34 @@ class vector : public IContainer {
   const_reference back() const;
 
   void reserve(size_type size);
+  void reserve_exact(size_type size);
   void shrink_to_fit();
 
-  void swap(vector<value_type>& other) noexcept;
+  void swap(vector& other) noexcept;
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename ForwardIt,
+            typename = std::enable_if_t<!std::is_integral_v<ForwardIt>>>
+  iterator insert(const_iterator pos, ForwardIt first, ForwardIt last);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
   void pop_back();
   void erase(iterator pos);
 
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
   template <typename... Args>
   void insert_many_back(Args&&... args);
 
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args);
 
-  bool operator==(const vector<value_type>& other) const;
-  bool operator!=(const vector<value_type>& other) const;
+  bool operator==(const vector& other) const;
+  bool operator!=(const vector& other) const;
 
   // Data
  private:
@@ -82,24 +176,31 @@ class vector : public IContainer {
   size_type capacity_;
   value_type* data_;
 
+  static constexpr bool kRelocatable = is_trivially_relocatable_v<T>;
+
   // Private Methods
  private:
   void moveValData(size_type indx, value_type&& val);
   void freeValData(size_type indx);
 
-  void makeData();
+  static value_type* allocate(size_type count);
+  static size_type usableCapacity(value_type* data, size_type count);
+  void makeData(size_type newCapacity, bool exact = false);
   void freeData();
+  void shiftTail(size_type from, size_type to);
 
-  void setCapacity(size_type newCapacity);
-  void growCapacity();
+  void setCapacity(size_type newCapacity, bool exact = false);
+  void growCapacity(size_type needed);
 
   void checkRange(const_iterator begin, const_iterator pos) const;
+  bool aliases(const void* ptr) const noexcept;
 
-  iterator insertImpl(iterator pos, const_reference value);
+  size_type openGap(const_iterator pos, size_type count);
+  void closeGap(size_type index, size_type count, size_type built);
 };
 
-template <typename T>
-class vector<T>::VectorIterator {
+template <typename T, typename Growth>
+class vector<T, Growth>::VectorIterator {
   // Types
  public:
   using iterator_category = std::random_access_iterator_tag;
@@ -112,7 +213,8 @@ class vector<T>::VectorIterator {
   // Public Methods
  public:
   VectorIterator(value_type* ptr) : ptr_(ptr) {}
-  VectorIterator(VectorIterator& other) : ptr_(other.ptr_) {}
+  VectorIterator(const VectorIterator& other) = default;
+  VectorIterator& operator=(const VectorIterator& other) = default;
 
   VectorIterator& operator++() {
     ++ptr_;
@@ -180,8 +282,9 @@ class vector<T>::VectorIterator {
   value_type* ptr_;
 };
 
-template <typename T>
-class vector<T>::VectorConstIterator : public vector<T>::VectorIterator {
+template <typename T, typename Growth>
+class vector<T, Growth>::VectorConstIterator
+    : public vector<T, Growth>::VectorIterator {
   // Types
  public:
   using iterator_category = std::random_access_iterator_tag;
@@ -196,50 +299,65 @@ class vector<T>::VectorConstIterator : public vector<T>::VectorIterator {
   const_reference operator*() { return VectorIterator::operator*(); }
 };
 
-template <typename value_type>
-vector<value_type>::vector() noexcept
+template <typename value_type, typename growth_type>
+vector<value_type, growth_type>::vector() noexcept
     : size_{0}, capacity_{0}, data_{nullptr} {}
 
-template <typename value_type>
-vector<value_type>::vector(size_type n)
-    : size_{n}, capacity_{n}, data_{nullptr} {
-  if (capacity_ > max_size())
+template <typename value_type, typename growth_type>
+vector<value_type, growth_type>::vector(size_type n)
+    : size_{0}, capacity_{0}, data_{nullptr} {
+  if (n > max_size())
     throw std::length_error("Cannot create s21::vector larger than max_size()");
 
-  makeData();
+  makeData(n);
 
-  for (size_type i = 0; i < size_; i++) {
-    new (data_ + i) value_type();
+  try {
+    for (; size_ < n; size_++) {
+      new (data_ + size_) value_type();
+    }
+  } catch (...) {
+    freeData();
+    throw;
   }
 }
 
-template <typename value_type>
-vector<value_type>::vector(std::initializer_list<value_type> const& items)
-    : size_{items.size()}, capacity_{items.size()}, data_{nullptr} {
-  if (capacity_ > max_size())
+template <typename value_type, typename growth_type>
+vector<value_type, growth_type>::vector(
+    std::initializer_list<value_type> const& items)
+    : size_{0}, capacity_{0}, data_{nullptr} {
+  if (items.size() > max_size())
     throw std::length_error("Cannot create s21::vector larger than max_size()");
 
-  makeData();
+  makeData(items.size());
 
-  size_type i = 0;
-  for (auto item : items) {
-    new (data_ + i) value_type(item);
-    i++;
+  try {
+    for (const value_type& item : items) {
+      new (data_ + size_) value_type(item);
+      size_++;
+    }
+  } catch (...) {
+    freeData();
+    throw;
   }
 }
 
-template <typename value_type>
-vector<value_type>::vector(const vector& other)
-    : size_{other.size_}, capacity_{other.capacity_}, data_{nullptr} {
-  makeData();
+template <typename value_type, typename growth_type>
+vector<value_type, growth_type>::vector(const vector& other)
+    : size_{0}, capacity_{0}, data_{nullptr} {
+  makeData(other.capacity_);
 
-  for (size_type i = 0; i < size_; i++) {
-    new (data_ + i) value_type(other[i]);
+  try {
+    for (; size_ < other.size_; size_++) {
+      new (data_ + size_) value_type(other[size_]);
+    }
+  } catch (...) {
+    freeData();
+    throw;
   }
 }
 
-template <typename value_type>
-vector<value_type>::vector(vector&& other) noexcept
+template <typename value_type, typename growth_type>
+vector<value_type, growth_type>::vector(vector&& other) noexcept
     : size_{other.size_}, capacity_{other.capacity_}, data_{other.data_} {
   if (this != &other) {
     other.size_ = 0;
@@ -248,162 +366,248 @@ vector<value_type>::vector(vector&& other) noexcept
   }
 }
 
-template <typename value_type>
-vector<value_type>::~vector() {
+template <typename value_type, typename growth_type>
+vector<value_type, growth_type>::~vector() {
   freeData();
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::begin() {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::iterator
+vector<value_type, growth_type>::begin() {
   return iterator(&data_[0]);
 };
 
-template <typename value_type>
-typename vector<value_type>::const_iterator vector<value_type>::begin() const {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::const_iterator
+vector<value_type, growth_type>::begin() const {
   return const_iterator(&data_[0]);
 };
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::end() {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::iterator
+vector<value_type, growth_type>::end() {
   return iterator(&data_[size_]);
 };
 
-template <typename value_type>
-typename vector<value_type>::const_iterator vector<value_type>::end() const {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::const_iterator
+vector<value_type, growth_type>::end() const {
   return const_iterator(&data_[size_]);
 };
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::size()
-    const noexcept {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::size_type
+vector<value_type, growth_type>::size() const noexcept {
   return size_;
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::max_size() {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::size_type
+vector<value_type, growth_type>::max_size() {
   return ((std::numeric_limits<size_type>::max() / sizeof(value_type)) /
           4294967296);  // #NOTE: 4294967296 -> 2^32
 }
 
-template <typename value_type>
-bool vector<value_type>::empty() const noexcept {
+template <typename value_type, typename growth_type>
+bool vector<value_type, growth_type>::empty() const noexcept {
   return (size_ == 0);
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::capacity()
-    const noexcept {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::size_type
+vector<value_type, growth_type>::capacity() const noexcept {
   return capacity_;
 }
 
-template <typename value_type>
-value_type* vector<value_type>::data() const noexcept {
+template <typename value_type, typename growth_type>
+value_type* vector<value_type, growth_type>::data() const noexcept {
   return data_;
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::at(size_type pos) {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::reference
+vector<value_type, growth_type>::at(size_type pos) {
   if (pos >= size_) throw std::out_of_range("Index out of vector boundary");
 
   return data_[pos];
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::at(
-    size_type pos) const {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::const_reference
+vector<value_type, growth_type>::at(size_type pos) const {
   if (pos >= size_) throw std::out_of_range("Index out of vector boundary");
 
   return data_[pos];
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::operator[](
-    size_type pos) {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::reference
+vector<value_type, growth_type>::operator[](size_type pos) {
   return data_[pos];
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::operator[](
-    size_type pos) const {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::const_reference
+vector<value_type, growth_type>::operator[](size_type pos) const {
   return data_[pos];
 }
 
-template <typename value_type>
-void vector<value_type>::moveValData(size_type indx, value_type&& val) {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::moveValData(size_type indx,
+                                                  value_type&& val) {
   new (data_ + indx) value_type(std::move(val));
 }
 
-template <typename value_type>
-void vector<value_type>::freeValData(size_type indx) {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::freeValData(size_type indx) {
   if (data_ != nullptr) (data_ + indx)->~value_type();
 }
 
-template <typename value_type>
-void vector<value_type>::makeData() {
-  value_type* newData = reinterpret_cast<value_type*>(
-      new std::byte[capacity_ * sizeof(value_type)]);
-  if (data_ != nullptr) {
+// Buffers come from malloc, so realloc can grow them for relocatable types.
+// Like new[] of no elements, an empty buffer may still get an address.
+template <typename value_type, typename growth_type>
+value_type* vector<value_type, growth_type>::allocate(size_type count) {
+  void* ptr = std::malloc(count * sizeof(value_type));
+  if (ptr == nullptr && count != 0) throw std::bad_alloc();
+  return static_cast<value_type*>(ptr);
+}
+
+// Elements that fit in the block the allocator handed out for count of them
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::size_type
+vector<value_type, growth_type>::usableCapacity(value_type* data,
+                                                size_type count) {
+#if defined(__GLIBC__)
+  if (data != nullptr && count != 0) {
+    size_type usable = malloc_usable_size(data) / sizeof(value_type);
+    return std::max(count, std::min(usable, max_size()));
+  }
+#else
+  (void)data;
+#endif
+  return count;
+}
+
+// Moves the first size_ elements into a buffer of newCapacity elements, or
+// of as many as the allocated block holds unless exact is set
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::makeData(size_type newCapacity,
+                                               bool exact) {
+  if constexpr (kRelocatable) {
+    if (newCapacity == 0) {
+      freeData();
+      data_ = allocate(0);
+    } else {
+      void* ptr = std::realloc(static_cast<void*>(data_),
+                               newCapacity * sizeof(value_type));
+      if (ptr == nullptr) throw std::bad_alloc();
+      data_ = static_cast<value_type*>(ptr);
+    }
+  } else {
+    value_type* newData = allocate(newCapacity);
     for (size_type i = 0; i < size_; i++) {
       try {
         new (newData + i) value_type(std::move(data_[i]));
       } catch (...) {
         for (size_type j = 0; j < i; j++) {
-          (newData + i)->~value_type();
+          (newData + j)->~value_type();
         }
-        delete[] reinterpret_cast<std::byte*>(newData);
+        std::free(newData);
         throw;
       }
     }
 
     freeData();
+    data_ = newData;
   }
 
-  data_ = newData;
+  if constexpr (growth_type::usable_size) {
+    if (!exact) newCapacity = usableCapacity(data_, newCapacity);
+  }
+  capacity_ = newCapacity;
 }
 
-template <typename value_type>
-void vector<value_type>::freeData() {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::freeData() {
   if (data_ == nullptr) return;
 
-  for (size_type i = 0; i < size_; i++) {
-    freeValData(i);
+  if constexpr (!std::is_trivially_destructible_v<value_type>) {
+    for (size_type i = 0; i < size_; i++) {
+      freeValData(i);
+    }
   }
 
-  delete[] reinterpret_cast<uint8_t*>(data_);
+  std::free(data_);
+  data_ = nullptr;
+}
+
+/*
+  Moves the elements from index from to the end so that they start at
+  index to. The slots left behind hold no object and those overwritten
+  must hold none either: relocatable elements are moved with one memmove,
+  the others one by one in an order that never overwrites a live element.
+*/
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::shiftTail(size_type from, size_type to) {
+  if (from == to) return;
+
+  const size_type count = size_ - from;
+  if constexpr (kRelocatable) {
+    std::memmove(static_cast<void*>(data_ + to),
+                 static_cast<const void*>(data_ + from),
+                 count * sizeof(value_type));
+  } else if (to > from) {
+    for (size_type i = count; i > 0; i--) {
+      moveValData(to + i - 1, std::move(data_[from + i - 1]));
+      freeValData(from + i - 1);
+    }
+  } else {
+    for (size_type i = 0; i < count; i++) {
+      moveValData(to + i, std::move(data_[from + i]));
+      freeValData(from + i);
+    }
+  }
 }
 
-template <typename value_type>
-void vector<value_type>::setCapacity(size_type newCapacity) {
-  capacity_ = newCapacity;
-  if (capacity_ > max_size())
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::setCapacity(size_type newCapacity,
+                                                  bool exact) {
+  if (newCapacity > max_size())
     throw std::length_error("Cannot expand s21::vector larger than max_size()");
 
-  makeData();
+  makeData(newCapacity, exact);
 }
 
-template <typename value_type>
-void vector<value_type>::growCapacity() {
-  if (capacity_ == 0) {
-    reserve(1);
-  } else {
-    reserve(capacity_ * 2);
-  }
+// Grows the buffer to hold needed elements as the growth policy says, never
+// past max_size() while needed fits in it
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::growCapacity(size_type needed) {
+  size_type newCapacity =
+      growth_type::grow(capacity_, needed, sizeof(value_type));
+  reserve(std::max(needed, std::min(newCapacity, max_size())));
 }
 
-template <typename value_type>
-void vector<value_type>::reserve(size_type newCapacity) {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::reserve(size_type newCapacity) {
   if (newCapacity <= capacity_) return;
   setCapacity(newCapacity);
 }
 
-template <typename value_type>
-void vector<value_type>::shrink_to_fit() {
+// Like reserve(), but leaves no slack: the capacity becomes newCapacity
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::reserve_exact(size_type newCapacity) {
+  if (newCapacity <= capacity_) return;
+  setCapacity(newCapacity, true);
+}
+
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::shrink_to_fit() {
   if (size_ == capacity_) return;
-  setCapacity(size_);
+  setCapacity(size_, true);
 }
 
-template <typename value_type>
-void vector<value_type>::clear() {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::clear() {
   for (size_type i = 0; i < size_; i++) {
     (data_ + i)->~value_type();
   }
@@ -411,146 +615,279 @@ void vector<value_type>::clear() {
   size_ = 0;
 }
 
-template <typename value_type>
-void vector<value_type>::swap(vector<value_type>& other) noexcept {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::swap(vector& other) noexcept {
   std::swap(size_, other.size_);
   std::swap(capacity_, other.capacity_);
   std::swap(data_, other.data_);
 }
 
-template <typename value_type>
-bool vector<value_type>::operator==(const vector<value_type>& other) const {
+template <typename value_type, typename growth_type>
+bool vector<value_type, growth_type>::operator==(const vector& other) const {
   if (this == &other) return true;
   if (size() != other.size()) return false;
 
   return (std::equal(begin(), end(), other.begin()));
 }
 
-template <typename value_type>
-bool vector<value_type>::operator!=(const vector<value_type>& other) const {
+template <typename value_type, typename growth_type>
+bool vector<value_type, growth_type>::operator!=(const vector& other) const {
   return !(*this == other);
 }
 
-template <typename value_type>
-vector<value_type>& vector<value_type>::operator=(
-    const vector<value_type>& other) {
+template <typename value_type, typename growth_type>
+vector<value_type, growth_type>& vector<value_type, growth_type>::operator=(
+    const vector& other) {
   if (this == &other) {
     return *this;
   }
 
-  vector<value_type> tmp{other};
+  vector tmp{other};
   this->swap(tmp);
 
   return *this;
 }
 
-template <typename value_type>
-vector<value_type>& vector<value_type>::operator=(vector<value_type>&& other) {
+template <typename value_type, typename growth_type>
+vector<value_type, growth_type>&
+vector<value_type, growth_type>::operator=(vector&& other) {
   if (this == &other) {
     return *this;
   }
 
-  vector<value_type> tmp{std::move(other)};
+  vector tmp{std::move(other)};
   this->swap(tmp);
 
   return *this;
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::front() const {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::const_reference
+vector<value_type, growth_type>::front() const {
   return data_[0];
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::back() const {
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::const_reference
+vector<value_type, growth_type>::back() const {
   return data_[size_ - 1];
 }
 
-template <typename value_type>
-void vector<value_type>::push_back(const_reference value) {
-  if (size_ >= capacity_) growCapacity();
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::push_back(const_reference value) {
+  emplace_back(value);
+}
 
-  value_type tmp{value};
-  moveValData(size_, std::move(tmp));
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
 
+// The element is built from args right in its slot. Only when the buffer
+// grows and args refer into it is it built aside first and moved in.
+template <typename value_type, typename growth_type>
+template <typename... Args>
+typename vector<value_type, growth_type>::reference
+vector<value_type, growth_type>::emplace_back(Args&&... args) {
+  if (size_ >= capacity_) {
+    if ((aliases(&args) || ...)) {
+      value_type tmp(std::forward<Args>(args)...);
+      return emplace_back(std::move(tmp));
+    }
+    growCapacity(size_ + 1);
+  }
+
+  new (data_ + size_) value_type(std::forward<Args>(args)...);
   ++size_;
+
+  return data_[size_ - 1];
 }
 
-template <typename value_type>
-void vector<value_type>::pop_back() {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::pop_back() {
   if (empty()) throw std::out_of_range("Vector is empty");
   --size_;
 
   freeValData(size_);
 }
 
-template <typename value_type>
-void vector<value_type>::erase(iterator pos) {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::erase(iterator pos) {
   const auto index = (size_type)VectorIterator::distance(begin(), pos);
   if (index >= size_) return;
 
   freeValData(index);
-
-  for (size_type i = index; i < (size_ - 1); i++) {
-    moveValData(i, std::move(data_[i + 1]));
-  }
+  shiftTail(index + 1, index);
 
   --size_;
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::insertImpl(
-    iterator pos, const_reference value) {
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::checkRange(const_iterator begin,
+                                                 const_iterator pos) const {
+  const auto index = (size_type)VectorIterator::distance(begin, pos);
+  if (index > size_)
+    throw std::out_of_range("Selected position is out of range of the vector");
+}
+
+// Whether ptr points into one of the elements, which an insert would move
+template <typename value_type, typename growth_type>
+bool vector<value_type, growth_type>::aliases(const void* ptr) const noexcept {
+  const std::less_equal<const void*> lessEqual;
+  return size_ != 0 && lessEqual(data_, ptr) && !lessEqual(data_ + size_, ptr);
+}
+
+/*
+  Makes room for count elements at pos and returns its index: the buffer
+  grows at most once and the tail is shifted once. The slots of the gap
+  are counted in size_ but hold no objects until the caller builds them;
+  should that fail, closeGap() takes back the gap and the built ones.
+*/
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::size_type
+vector<value_type, growth_type>::openGap(const_iterator pos, size_type count) {
+  checkRange(begin(), pos);
   const auto index = (size_type)VectorIterator::distance(begin(), pos);
-  if (size_ >= capacity_) growCapacity();
+  if (count > max_size() - size_)
+    throw std::length_error("Cannot expand s21::vector larger than max_size()");
+
+  if (size_ + count > capacity_) growCapacity(size_ + count);
+
+  shiftTail(index, index + count);
+  size_ += count;
 
-  for (size_type i = size_; i > index; i--) {
-    moveValData(i, std::move(data_[i - 1]));
+  return index;
+}
+
+template <typename value_type, typename growth_type>
+void vector<value_type, growth_type>::closeGap(size_type index,
+                                               size_type count,
+                                               size_type built) {
+  for (size_type i = 0; i < built; i++) {
+    freeValData(index + i);
   }
 
-  // #DEFECT - how to correct move value to data without tmp?
-  value_type tmp{value};
-  moveValData(index, std::move(tmp));
-  ++size_;
+  shiftTail(index + count, index);
+  size_ -= count;
+}
+
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::iterator
+vector<value_type, growth_type>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::iterator
+vector<value_type, growth_type>::insert(iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename value_type, typename growth_type>
+template <typename... Args>
+typename vector<value_type, growth_type>::iterator
+vector<value_type, growth_type>::emplace(const_iterator pos, Args&&... args) {
+  // args may refer to elements of this vector, moved by the growth and shift
+  if ((aliases(&args) || ...)) {
+    value_type tmp(std::forward<Args>(args)...);
+    return emplace(pos, std::move(tmp));
+  }
+
+  const size_type index = openGap(pos, 1);
+  try {
+    new (data_ + index) value_type(std::forward<Args>(args)...);
+  } catch (...) {
+    closeGap(index, 1, 0);
+    throw;
+  }
 
   return begin() + index;
 }
 
-template <typename value_type>
-void vector<value_type>::checkRange(const_iterator begin,
-                                    const_iterator pos) const {
-  const auto index = (size_type)VectorIterator::distance(begin, pos);
-  if ((index >= size_) && (index != 0))
-    throw std::out_of_range("Selected position is out of range of the vector");
+template <typename value_type, typename growth_type>
+typename vector<value_type, growth_type>::iterator
+vector<value_type, growth_type>::insert(
+    const_iterator pos, size_type count, const_reference value) {
+  // value may be an element of this vector, moved by the growth and shift
+  if (aliases(&value)) {
+    value_type tmp{value};
+    return insert(pos, count, tmp);
+  }
+
+  const size_type index = openGap(pos, count);
+  size_type built = 0;
+  try {
+    for (; built < count; built++) {
+      new (data_ + index + built) value_type(value);
+    }
+  } catch (...) {
+    closeGap(index, count, built);
+    throw;
+  }
+
+  return begin() + index;
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::insert(
-    iterator pos, const_reference value) {
-  checkRange(begin(), pos);
+// The range is walked twice, once to count it, so it must be a forward one
+template <typename value_type, typename growth_type>
+template <typename ForwardIt, typename>
+typename vector<value_type, growth_type>::iterator
+vector<value_type, growth_type>::insert(
+    const_iterator pos, ForwardIt first, ForwardIt last) {
+  size_type count = 0;
+  for (ForwardIt it = first; it != last; ++it) {
+    count++;
+  }
 
-  return insertImpl(pos, value);
+  const size_type index = openGap(pos, count);
+  size_type built = 0;
+  try {
+    for (; built < count; built++, ++first) {
+      new (data_ + index + built) value_type(*first);
+    }
+  } catch (...) {
+    closeGap(index, count, built);
+    throw;
+  }
+
+  return begin() + index;
 }
 
-template <typename value_type>
+template <typename value_type, typename growth_type>
 template <typename... Args>
-void vector<value_type>::insert_many_back(Args&&... args) {
-  for (auto arg : {args...}) {
-    push_back(arg);
-  }
+void vector<value_type, growth_type>::insert_many_back(Args&&... args) {
+  insert_many(end(), std::forward<Args>(args)...);
 }
 
-template <typename value_type>
+template <typename value_type, typename growth_type>
 template <typename... Args>
-typename vector<value_type>::iterator vector<value_type>::insert_many(
+typename vector<value_type, growth_type>::iterator
+vector<value_type, growth_type>::insert_many(
     const_iterator pos, Args&&... args) {
-  checkRange(begin(), pos);
+  constexpr size_type count = sizeof...(Args);
+
+  // Arguments referring into this vector are copied out before the shift
+  if ((aliases(&args) || ...)) {
+    vector items;
+    items.reserve(count);
+    (items.emplace_back(std::forward<Args>(args)), ...);
+    return insert(pos, std::make_move_iterator(items.begin()),
+                  std::make_move_iterator(items.end())) +
+           count;
+  }
 
-  for (auto arg : {args...}) {
-    pos = insertImpl(pos, arg) + 1;
+  const size_type index = openGap(pos, count);
+  size_type built = 0;
+  try {
+    ((new (data_ + index + built) value_type(std::forward<Args>(args)),
+      built++),
+     ...);
+  } catch (...) {
+    closeGap(index, count, built);
+    throw;
   }
 
-  return pos;
+  return begin() + index + count;
 }
 
 }  // namespace s21
@@ -2,6 +2,13 @@
 #define SRC_S21_CONTAINERSPLUS_H_
 
 #include "core/s21_array.h"
+#include "core/s21_flat_map.h"
+#include "core/s21_flat_set.h"
 #include "core/s21_multiset.h"
+#include "core/s21_set_algebra.h"
+#include "core/s21_small_vector.h"
+#include "core/s21_static_map.h"
+#include "core/s21_unordered_map.h"
+#include "core/s21_unordered_set.h"
 
 #endif  // !SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
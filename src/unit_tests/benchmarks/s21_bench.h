@@ -0,0 +1,118 @@
+#ifndef SRC_UNIT_TESTS_BENCHMARKS_S21_BENCH_H_
+#define SRC_UNIT_TESTS_BENCHMARKS_S21_BENCH_H_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace s21_bench {
+
+/*
+  Minimal helpers shared by the benchmark executables.
+
+  Every *_bench.cpp is a standalone program built by `make bench`.
+  The first command line argument, when given, overrides the element count.
+*/
+
+inline std::uint64_t readCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+struct Sample {
+  double ns;
+  double cycles;
+};
+
+class Stopwatch {
+ public:
+  Stopwatch() { restart(); }
+
+  void restart() {
+    start_ = std::chrono::steady_clock::now();
+    cycles_ = readCycles();
+  }
+
+  Sample elapsed() const {
+    std::uint64_t cycles = readCycles() - cycles_;
+    auto diff = std::chrono::steady_clock::now() - start_;
+    return {std::chrono::duration<double, std::nano>(diff).count(),
+            static_cast<double>(cycles)};
+  }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+  std::uint64_t cycles_;
+};
+
+// Key wrapper counting every comparison the container performs on it
+struct CountingKey {
+  static inline std::uint64_t comparisons = 0;
+
+  int value = 0;
+
+  CountingKey() = default;
+  CountingKey(int val) : value(val) {}
+
+  bool operator<(const CountingKey& other) const {
+    ++comparisons;
+    return value < other.value;
+  }
+
+  bool operator==(const CountingKey& other) const {
+    ++comparisons;
+    return value == other.value;
+  }
+};
+
+inline std::size_t countFromArgs(int argc, char* argv[], std::size_t def) {
+  if (argc > 1) return static_cast<std::size_t>(std::strtoull(argv[1], 0, 10));
+  return def;
+}
+
+inline std::vector<int> randomKeys(std::size_t count, unsigned seed = 42) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist;
+  std::vector<int> keys(count);
+  for (auto& key : keys) key = dist(gen);
+  return keys;
+}
+
+inline std::vector<int> sortedKeys(std::size_t count) {
+  std::vector<int> keys(count);
+  for (std::size_t i = 0; i < count; i++) keys[i] = static_cast<int>(i);
+  return keys;
+}
+
+// Prevents the optimizer from discarding a computed value
+template <typename T>
+inline void doNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void printHeader(const char* title, std::size_t count) {
+  std::printf("\n%s (n = %zu)\n", title, count);
+  std::printf("%-36s %12s %12s %12s\n", "case", "ns/op", "cycles/op",
+              "extra");
+}
+
+inline void printRow(const std::string& name, std::size_t ops,
+                     const Sample& sample, double extra = 0.0) {
+  std::printf("%-36s %12.2f %12.2f %12.2f\n", name.c_str(), sample.ns / ops,
+              sample.cycles / ops, extra);
+}
+
+}  // namespace s21_bench
+
+#endif  // SRC_UNIT_TESTS_BENCHMARKS_S21_BENCH_H_
@@ -0,0 +1,57 @@
+#include "core/s21_map.h"
+#include "s21_bench.h"
+
+// s21::map<int, int> on the red-black tree and on the B-tree backend with
+// 256- and 1024-byte nodes: n inserts in random order, point lookups of
+// every key in another random order, and one in-order scan. Runs at 1K,
+// 100K and the count given on the command line (1M by default).
+// extra = checksum of the values read, the same for every backend.
+
+template <typename Map>
+void benchMap(const char* name, const std::vector<int>& keys,
+              const std::vector<int>& probes) {
+  Map table;
+  std::string label(name);
+
+  s21_bench::Stopwatch watch;
+  for (int key : keys) table.insert(key, key % 1000);
+  s21_bench::Sample sample = watch.elapsed();
+  s21_bench::printRow(label + " insert", keys.size(), sample,
+                      double(table.size()));
+
+  long long sum = 0;
+  watch.restart();
+  for (int key : probes) sum += table.at(key);
+  sample = watch.elapsed();
+  s21_bench::printRow(label + " at", probes.size(), sample, double(sum));
+
+  sum = 0;
+  watch.restart();
+  for (const auto& item : table) sum += item.second;
+  sample = watch.elapsed();
+  s21_bench::printRow(label + " scan", table.size(), sample, double(sum));
+}
+
+void benchSize(std::size_t count) {
+  std::vector<int> keys = s21_bench::randomKeys(count);
+  std::vector<int> probes = s21_bench::randomKeys(count, 7);
+  for (int& probe : probes) probe = keys[unsigned(probe) % keys.size()];
+
+  s21_bench::printHeader("Insert, lookup, scan (extra = size/checksum)",
+                         count);
+  benchMap<s21::map<int, int>>("rbtree", keys, probes);
+  benchMap<s21::map<int, int, std::less<int>, s21::btree_policy<256>>>(
+      "btree<256>", keys, probes);
+  benchMap<s21::map<int, int, std::less<int>, s21::btree_policy<1024>>>(
+      "btree<1024>", keys, probes);
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+
+  for (std::size_t size : {std::size_t(1000), std::size_t(100000), count}) {
+    if (size <= count) benchSize(size);
+  }
+
+  return 0;
+}
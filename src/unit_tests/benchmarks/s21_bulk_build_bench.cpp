@@ -0,0 +1,53 @@
+#include <utility>
+
+#include "core/s21_map.h"
+#include "s21_bench.h"
+
+using s21_bench::CountingKey;
+using KeyMap = s21::map<CountingKey, int>;
+using Pair = std::pair<CountingKey, int>;
+
+// Rehydrating a map from a pre-sorted s21::vector: n separate inserts,
+// n inserts hinted at end(), and the linear sorted_tag bulk build.
+
+enum class BuildKind { kInsert, kHintEnd, kSorted };
+
+void benchBuild(const std::string& name, const s21::vector<Pair>& items,
+                BuildKind kind) {
+  CountingKey::comparisons = 0;
+
+  s21_bench::Stopwatch watch;
+  KeyMap tree;
+  switch (kind) {
+    case BuildKind::kInsert:
+      for (const Pair& item : items) tree.insert(item);
+      break;
+    case BuildKind::kHintEnd:
+      for (const Pair& item : items) tree.insert(tree.end(), item);
+      break;
+    case BuildKind::kSorted:
+      tree.assign(items.begin(), items.end(), s21::sorted_tag);
+      break;
+  }
+  s21_bench::Sample sample = watch.elapsed();
+
+  s21_bench::doNotOptimize(tree.size());
+  s21_bench::printRow(name, items.size(), sample,
+                      double(CountingKey::comparisons) / items.size());
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+  s21::vector<Pair> items;
+  items.reserve(count);
+  for (int key : s21_bench::sortedKeys(count))
+    items.push_back(Pair(CountingKey(key), key));
+
+  s21_bench::printHeader("Building s21::map from sorted input (extra = cmp/op)",
+                         count);
+  benchBuild("insert(value)", items, BuildKind::kInsert);
+  benchBuild("insert(end(), value)", items, BuildKind::kHintEnd);
+  benchBuild("assign(first, last, sorted_tag)", items, BuildKind::kSorted);
+
+  return 0;
+}
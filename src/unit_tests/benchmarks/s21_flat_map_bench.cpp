@@ -0,0 +1,51 @@
+#include "core/s21_flat_map.h"
+#include "core/s21_map.h"
+#include "s21_bench.h"
+
+// Read-mostly tables of n int keys in s21::map and s21::flat_map: building
+// from an unsorted range (per-key insert() against one batch insert()),
+// at() of every key in random order and a full scan. extra = checksum of
+// the values read, the same for both containers.
+
+template <typename Map>
+void benchMap(const std::string& name, const std::vector<int>& keys,
+              const std::vector<int>& probes) {
+  std::vector<std::pair<int, int>> items;
+  items.reserve(keys.size());
+  for (int key : keys) items.emplace_back(key, key % 1000);
+
+  s21_bench::Stopwatch watch;
+  Map table;
+  if constexpr (std::is_same_v<Map, s21::map<int, int>>) {
+    for (const auto& item : items) table.insert(item);
+  } else {
+    table.insert(items.begin(), items.end());
+  }
+  s21_bench::Sample build = watch.elapsed();
+  s21_bench::printRow(name + ", build", keys.size(), build, 0);
+
+  long long sum = 0;
+  watch.restart();
+  for (int key : probes) sum += table.at(key);
+  s21_bench::Sample lookup = watch.elapsed();
+  s21_bench::printRow(name + ", at()", probes.size(), lookup, double(sum));
+
+  sum = 0;
+  watch.restart();
+  for (const auto& item : table) sum += item.second;
+  s21_bench::Sample scan = watch.elapsed();
+  s21_bench::printRow(name + ", scan", table.size(), scan, double(sum));
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+  std::vector<int> keys = s21_bench::randomKeys(count);
+  std::vector<int> probes = s21_bench::randomKeys(count, 7);
+  for (int& probe : probes) probe = keys[unsigned(probe) % keys.size()];
+
+  s21_bench::printHeader("Lookup tables (extra = checksum)", count);
+  benchMap<s21::map<int, int>>("s21::map", keys, probes);
+  benchMap<s21::flat_map<int, int>>("s21::flat_map", keys, probes);
+
+  return 0;
+}
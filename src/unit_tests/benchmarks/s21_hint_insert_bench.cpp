@@ -0,0 +1,61 @@
+#include <algorithm>
+
+#include "core/s21_set.h"
+#include "s21_bench.h"
+
+using s21_bench::CountingKey;
+using KeySet = s21::set<CountingKey>;
+
+// Plain insert against insert(hint, value) for sorted, reverse-sorted and
+// random key streams. The hint is end() for ascending input, begin() for
+// descending input and the previously inserted position for random input.
+
+enum class HintKind { kNone, kEnd, kBegin, kPrevious };
+
+void benchIngest(const std::string& name, const std::vector<int>& keys,
+                 HintKind kind) {
+  KeySet tree;
+  KeySet::iterator last = tree.end();
+  CountingKey::comparisons = 0;
+
+  s21_bench::Stopwatch watch;
+  for (int key : keys) {
+    switch (kind) {
+      case HintKind::kNone:
+        tree.insert(CountingKey(key));
+        break;
+      case HintKind::kEnd:
+        tree.insert(tree.end(), CountingKey(key));
+        break;
+      case HintKind::kBegin:
+        tree.insert(tree.begin(), CountingKey(key));
+        break;
+      case HintKind::kPrevious:
+        last = tree.insert(last, CountingKey(key));
+        break;
+    }
+  }
+  s21_bench::Sample sample = watch.elapsed();
+
+  s21_bench::doNotOptimize(tree.size());
+  s21_bench::printRow(name, keys.size(), sample,
+                      double(CountingKey::comparisons) / keys.size());
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+  std::vector<int> sorted = s21_bench::sortedKeys(count);
+  std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+  std::vector<int> random = s21_bench::randomKeys(count);
+
+  s21_bench::printHeader("Hinted insert into s21::set (extra = cmp/op)",
+                         count);
+  benchIngest("sorted, insert(value)", sorted, HintKind::kNone);
+  benchIngest("sorted, insert(end(), value)", sorted, HintKind::kEnd);
+  benchIngest("reversed, insert(value)", reversed, HintKind::kNone);
+  benchIngest("reversed, insert(begin(), value)", reversed, HintKind::kBegin);
+  benchIngest("random, insert(value)", random, HintKind::kNone);
+  benchIngest("random, insert(last, value)", random, HintKind::kPrevious);
+
+  return 0;
+}
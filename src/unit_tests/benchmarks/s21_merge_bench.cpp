@@ -0,0 +1,79 @@
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "core/s21_set.h"
+#include "s21_bench.h"
+
+// set::merge() of two sets of n string keys each, against the former
+// implementation that copied every key into a new node and then erased it
+// from the source with a fresh search. Half of the source keys are already
+// in the target and stay behind. Nodes are relinked only when both sets were
+// given one pool; sets with pools of their own get the keys moved into new
+// nodes. extra = allocations per moved key.
+
+using StringSet = s21::set<std::string>;
+
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size) {
+  ++allocations;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+std::string makeKey(int key) {
+  std::string text = std::to_string(key);
+  return text + std::string(32 - text.size(), '#');
+}
+
+void fill(StringSet& target, StringSet& source, const std::vector<int>& keys) {
+  for (int key : keys) {
+    target.insert(makeKey(2 * key));
+    source.insert(makeKey(key % 2 ? 2 * key + 1 : 2 * key));
+  }
+}
+
+void copyAndErase(StringSet& target, StringSet& source) {
+  std::vector<std::string> moved;
+  for (const std::string& key : source)
+    if (target.insert(key).second) moved.push_back(key);
+  for (const std::string& key : moved) source.erase(source.find(key));
+}
+
+template <typename Merge>
+void benchMerge(const std::string& name, const std::vector<int>& keys,
+                bool sharedPool, Merge merge) {
+  StringSet target;
+  StringSet source = sharedPool ? StringSet(target.get_node_pool())
+                                : StringSet();
+  fill(target, source, keys);
+  std::size_t before = source.size();
+
+  allocations = 0;
+  s21_bench::Stopwatch watch;
+  merge(target, source);
+  s21_bench::Sample sample = watch.elapsed();
+
+  std::size_t moved = before - source.size();
+  s21_bench::doNotOptimize(target.size());
+  s21_bench::printRow(name, moved, sample, double(allocations) / moved);
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+  std::vector<int> keys = s21_bench::randomKeys(count);
+
+  s21_bench::printHeader("Merge of two s21::set<std::string>", count);
+  auto merge = [](StringSet& target, StringSet& source) {
+    target.merge(source);
+  };
+  benchMerge("copy and erase (former merge)", keys, false, copyAndErase);
+  benchMerge("merge, keys moved (own pools)", keys, false, merge);
+  benchMerge("merge, nodes relinked (one pool)", keys, true, merge);
+
+  return 0;
+}
@@ -0,0 +1,37 @@
+#include <set>
+
+#include "core/s21_set.h"
+#include "s21_bench.h"
+
+using s21_bench::CountingKey;
+
+// Cost of a single insert into a unique RBTree container: time, cycles and
+// key comparisons (reported in the "extra" column) per insert. The second
+// pass re-inserts the same keys, so every insert hits a duplicate.
+
+template <typename SetT>
+void benchInsert(const std::string& name, const std::vector<int>& keys) {
+  SetT tree;
+
+  for (const char* pass : {" (new keys)", " (duplicates)"}) {
+    CountingKey::comparisons = 0;
+    s21_bench::Stopwatch watch;
+    for (int key : keys) tree.insert(CountingKey(key));
+    s21_bench::Sample sample = watch.elapsed();
+
+    s21_bench::doNotOptimize(tree.size());
+    s21_bench::printRow(name + pass, keys.size(), sample,
+                        double(CountingKey::comparisons) / keys.size());
+  }
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 10000000);
+  std::vector<int> keys = s21_bench::randomKeys(count);
+
+  s21_bench::printHeader("RBTree insert, random keys (extra = cmp/op)", count);
+  benchInsert<s21::set<CountingKey>>("s21::set insert", keys);
+  benchInsert<std::set<CountingKey>>("std::set insert", keys);
+
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <set>
+
+#include "core/s21_set.h"
+#include "s21_bench.h"
+
+// Cost of the rebalancing work of RBTree: time and cycles per insert of n
+// keys, then per erase of all of them in another order. Ascending keys
+// rotate on almost every insert, random keys on about half of them.
+// Erases look the key up first. extra = size of the set after the pass,
+// the same for both containers.
+
+template <typename SetT>
+void benchInsertErase(const std::string& name, const std::vector<int>& keys,
+                      const std::vector<int>& order) {
+  SetT tree;
+
+  s21_bench::Stopwatch watch;
+  for (int key : keys) tree.insert(key);
+  s21_bench::Sample sample = watch.elapsed();
+  s21_bench::printRow(name + " insert", keys.size(), sample,
+                      double(tree.size()));
+
+  watch.restart();
+  for (int key : order) tree.erase(tree.find(key));
+  sample = watch.elapsed();
+  s21_bench::printRow(name + " erase", order.size(), sample,
+                      double(tree.size()));
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+  std::vector<int> random = s21_bench::randomKeys(count);
+  std::vector<int> order = random;
+  std::sort(order.begin(), order.end());
+  order.erase(std::unique(order.begin(), order.end()), order.end());
+  std::shuffle(order.begin(), order.end(), std::mt19937(7));
+
+  s21_bench::printHeader("Random keys (extra = size)", count);
+  benchInsertErase<s21::set<int>>("s21::set", random, order);
+  benchInsertErase<std::set<int>>("std::set", random, order);
+
+  std::vector<int> ascending(count);
+  for (std::size_t i = 0; i < count; ++i) ascending[i] = int(i);
+  s21_bench::printHeader("Ascending keys (extra = size)", count);
+  benchInsertErase<s21::set<int>>("s21::set", ascending, ascending);
+  benchInsertErase<std::set<int>>("std::set", ascending, ascending);
+
+  return 0;
+}
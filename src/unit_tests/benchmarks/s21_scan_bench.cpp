@@ -0,0 +1,68 @@
+#include <algorithm>
+
+#include "core/s21_map.h"
+#include "s21_bench.h"
+
+// Full forward and backward scans of s21::map<int, int> with the default
+// iterators, which walk parent links, and with threaded_tree_policy, which
+// follows the in-order links kept in every node. Random inserts scatter
+// neighbouring keys over the node pool, the sorted bulk build lays them out
+// in key order. extra = sum of the mapped values, the same for every row.
+
+using PlainMap = s21::map<int, int>;
+using ThreadedMap =
+    s21::map<int, int, std::less<int>, s21::threaded_tree_policy>;
+
+template <typename Map>
+Map makeMap(std::vector<int> keys, bool sorted) {
+  if (sorted) std::sort(keys.begin(), keys.end());
+  std::vector<std::pair<const int, int>> items;
+  items.reserve(keys.size());
+  for (int key : keys) items.emplace_back(key, key % 1000);
+  if (sorted) return Map(items.begin(), items.end(), s21::sorted_tag);
+
+  Map result;
+  for (const auto& item : items) result.insert(item);
+  return result;
+}
+
+template <typename Map>
+void benchScan(const std::string& name, const std::vector<int>& keys,
+               bool sorted, int rounds) {
+  Map tree = makeMap<Map>(keys, sorted);
+
+  long long sum = 0;
+  s21_bench::Stopwatch watch;
+  for (int round = 0; round < rounds; ++round)
+    for (auto it = tree.begin(); it != tree.end(); ++it) sum += (*it).second;
+  s21_bench::Sample forward = watch.elapsed();
+  s21_bench::printRow(name + ", forward", tree.size() * rounds, forward,
+                      double(sum / rounds));
+
+  sum = 0;
+  watch.restart();
+  for (int round = 0; round < rounds; ++round)
+    for (auto it = tree.end(); it != tree.begin();) sum += (*--it).second;
+  s21_bench::Sample backward = watch.elapsed();
+  s21_bench::printRow(name + ", backward", tree.size() * rounds, backward,
+                      double(sum / rounds));
+}
+
+void benchBoth(const char* title, const std::vector<int>& keys, bool sorted,
+               int rounds) {
+  s21_bench::printHeader(title, keys.size());
+  benchScan<PlainMap>("parent links", keys, sorted, rounds);
+  benchScan<ThreadedMap>("threaded_tree_policy", keys, sorted, rounds);
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+  std::vector<int> keys = s21_bench::randomKeys(count);
+  std::vector<int> few = s21_bench::randomKeys(count / 100);
+
+  benchBoth("Scans of a randomly built s21::map", keys, false, 10);
+  benchBoth("Scans of a bulk built s21::map", keys, true, 10);
+  benchBoth("Scans of a small randomly built s21::map", few, false, 1000);
+
+  return 0;
+}
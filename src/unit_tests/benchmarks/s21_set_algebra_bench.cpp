@@ -0,0 +1,82 @@
+#include <algorithm>
+
+#include "core/s21_set_algebra.h"
+#include "s21_bench.h"
+
+using s21_bench::CountingKey;
+using KeySet = s21::set<CountingKey>;
+
+// Union and intersection of two sets of n keys overlapping by a third,
+// element by element through contains() and insert() against the linear
+// walks of set_union() and set_intersection(). The operands are built once
+// by random inserts, which scatters neighbouring keys over the node pool,
+// and once by the sorted bulk build. ns/op is per key of both operands.
+
+KeySet makeSet(const std::vector<int>& keys, int step, bool sorted) {
+  std::vector<CountingKey> items;
+  items.reserve(keys.size());
+  for (int key : keys) items.push_back(CountingKey(step * key));
+  if (!sorted) {
+    KeySet result;
+    for (const CountingKey& item : items) result.insert(item);
+    return result;
+  }
+  std::sort(items.begin(), items.end());
+  return KeySet(items.begin(), items.end(), s21::sorted_tag);
+}
+
+KeySet lookupUnion(const KeySet& lhs, const KeySet& rhs) {
+  KeySet result(lhs);
+  for (const CountingKey& key : rhs)
+    if (!result.contains(key)) result.insert(key);
+  return result;
+}
+
+KeySet lookupIntersection(const KeySet& lhs, const KeySet& rhs) {
+  KeySet result;
+  KeySet& lookup = const_cast<KeySet&>(rhs);
+  for (const CountingKey& key : lhs)
+    if (lookup.contains(key)) result.insert(key);
+  return result;
+}
+
+template <typename Operation>
+void benchOperation(const std::string& name, const KeySet& lhs,
+                    const KeySet& rhs, Operation operation) {
+  std::size_t ops = lhs.size() + rhs.size();
+  CountingKey::comparisons = 0;
+
+  s21_bench::Stopwatch watch;
+  KeySet result = operation(lhs, rhs);
+  s21_bench::Sample sample = watch.elapsed();
+
+  s21_bench::doNotOptimize(result.size());
+  s21_bench::printRow(name, ops, sample,
+                      double(CountingKey::comparisons) / ops);
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+  std::vector<int> keys = s21_bench::randomKeys(count);
+
+  s21_bench::printHeader("Set algebra on s21::set (extra = cmp/op)", count);
+  for (bool sorted : {false, true}) {
+    KeySet lhs = makeSet(keys, 2, sorted);
+    KeySet rhs = makeSet(keys, 3, sorted);
+    std::string build = sorted ? "bulk built, " : "random built, ";
+
+    benchOperation(build + "contains() union", lhs, rhs, lookupUnion);
+    benchOperation(build + "set_union()", lhs, rhs,
+                   [](const KeySet& lhs, const KeySet& rhs) {
+                     return s21::set_union(lhs, rhs);
+                   });
+    benchOperation(build + "contains() intersection", lhs, rhs,
+                   lookupIntersection);
+    benchOperation(build + "set_intersection()", lhs, rhs,
+                   [](const KeySet& lhs, const KeySet& rhs) {
+                     return s21::set_intersection(lhs, rhs);
+                   });
+  }
+
+  return 0;
+}
@@ -0,0 +1,69 @@
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "core/s21_map.h"
+#include "core/s21_set.h"
+#include "s21_bench.h"
+
+// Memory and insert cost per element of a set of 64-byte string keys.
+// The "key + copy" row rebuilds the former set node layout, which kept a
+// second copy of the key as the mapped value, through a map<key, key>.
+
+static std::size_t allocatedBytes = 0;
+
+void* operator new(std::size_t size) {
+  allocatedBytes += size;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+using StringSet = s21::set<std::string>;
+using KeyCopyMap = s21::map<std::string, std::string>;
+
+std::vector<std::string> makeKeys(std::size_t count) {
+  std::vector<std::string> keys;
+  keys.reserve(count);
+  for (int key : s21_bench::randomKeys(count)) {
+    std::string text = std::to_string(key);
+    keys.push_back(text + std::string(64 - text.size(), '#'));
+  }
+  return keys;
+}
+
+template <typename Tree, typename Value>
+void benchMemory(const std::string& name, const std::vector<Value>& items,
+                 std::size_t nodeSize) {
+  allocatedBytes = 0;
+
+  s21_bench::Stopwatch watch;
+  Tree tree;
+  for (const Value& item : items) tree.insert(item);
+  s21_bench::Sample sample = watch.elapsed();
+
+  s21_bench::doNotOptimize(tree.size());
+  std::printf("%-36s %12.2f %12.2f %12zu %12.2f\n", name.c_str(),
+              sample.ns / items.size(), sample.cycles / items.size(),
+              nodeSize, double(allocatedBytes) / tree.size());
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 200000);
+  std::vector<std::string> keys = makeKeys(count);
+  std::vector<KeyCopyMap::value_type> pairs;
+  pairs.reserve(count);
+  for (const std::string& key : keys) pairs.emplace_back(key, key);
+
+  std::printf("\nSet of 64-byte string keys (n = %zu)\n", count);
+  std::printf("%-36s %12s %12s %12s %12s\n", "case", "ns/op", "cycles/op",
+              "node bytes", "bytes/elem");
+  benchMemory<KeyCopyMap>("key + copy node (old set layout)", pairs,
+                          sizeof(KeyCopyMap::tree_type::Node));
+  benchMemory<StringSet>("key-only node", keys,
+                         sizeof(StringSet::tree_type::Node));
+
+  return 0;
+}
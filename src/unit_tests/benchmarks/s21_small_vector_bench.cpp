@@ -0,0 +1,86 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "core/s21_small_vector.h"
+#include "core/s21_vector.h"
+#include "s21_bench.h"
+
+// Per-request scratch vectors: every request collects a handful of ints
+// (1 to 8, as most of ours do, then 1 to 16), walks them and drops them.
+// s21::small_vector<int, 8> against s21::vector<int> and std::vector<int>.
+// extra = calls to malloc/realloc per request, counted by wrapping the
+// glibc allocator (always 0 elsewhere).
+
+static std::size_t allocations = 0;
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(std::size_t size) noexcept {
+  ++allocations;
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept {
+  ++allocations;
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept {
+  ++allocations;
+  return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) noexcept { __libc_free(ptr); }
+}
+#endif
+
+template <typename VectorT>
+void benchRequests(const std::string& name,
+                   const std::vector<int>& requestSizes) {
+  long long sum = 0;
+  allocations = 0;
+
+  s21_bench::Stopwatch watch;
+  for (int requestSize : requestSizes) {
+    VectorT values;
+    for (int i = 0; i < requestSize; i++) values.push_back(i * requestSize);
+    for (int value : values) sum += value;
+    s21_bench::doNotOptimize(values.data());
+  }
+  s21_bench::Sample sample = watch.elapsed();
+
+  s21_bench::doNotOptimize(sum);
+  s21_bench::printRow(name, requestSizes.size(), sample,
+                      double(allocations) / requestSizes.size());
+}
+
+void benchSizes(const char* title, std::size_t count, int maxSize) {
+  std::vector<int> requestSizes;
+  requestSizes.reserve(count);
+  for (int key : s21_bench::randomKeys(count)) {
+    requestSizes.push_back(1 + key % maxSize);
+  }
+
+  s21_bench::printHeader(title, count);
+  benchRequests<s21::small_vector<int, 8>>("s21::small_vector<int, 8>",
+                                           requestSizes);
+  benchRequests<s21::vector<int>>("s21::vector<int>", requestSizes);
+  benchRequests<std::vector<int>>("std::vector<int>", requestSizes);
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 1000000);
+
+  benchSizes("requests of 1 to 8 ints (extra = allocations/request)", count,
+             8);
+  benchSizes("requests of 1 to 16 ints (extra = allocations/request)", count,
+             16);
+
+  return 0;
+}
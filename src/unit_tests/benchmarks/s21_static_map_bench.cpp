@@ -0,0 +1,55 @@
+#include "core/s21_map.h"
+#include "core/s21_static_map.h"
+#include "s21_bench.h"
+
+// Point lookups of every key, in random order, against n int keys: the
+// public s21::map::at(), a bare RBTree::search() without the map layer on
+// top, and s21::static_map::at() frozen from the same map. Both trees are
+// built by inserting in random order. Runs at 1K, 1M and the count given
+// on the command line (10M by default). extra = checksum of the values
+// read, the same for all three.
+
+void benchSize(std::size_t count) {
+  std::vector<int> keys = s21_bench::randomKeys(count);
+  std::vector<int> probes = s21_bench::randomKeys(count, 7);
+  for (int& probe : probes) probe = keys[unsigned(probe) % keys.size()];
+
+  s21::map<int, int> table;
+  s21::RBTree<int, int, false> tree;
+  for (int key : keys) {
+    table.insert(key, key % 1000);
+    tree.insert(std::pair<const int, int>(key, key % 1000));
+  }
+  s21::static_map<int, int> frozen = s21::freeze(table);
+
+  s21_bench::printHeader("Point lookups (extra = checksum)", count);
+
+  long long sum = 0;
+  s21_bench::Stopwatch watch;
+  for (int key : probes) sum += table.at(key);
+  s21_bench::Sample sample = watch.elapsed();
+  s21_bench::printRow("s21::map::at", probes.size(), sample, double(sum));
+
+  sum = 0;
+  watch.restart();
+  for (int key : probes) sum += tree.search(key)->val_.second;
+  sample = watch.elapsed();
+  s21_bench::printRow("RBTree::search", probes.size(), sample, double(sum));
+
+  sum = 0;
+  watch.restart();
+  for (int key : probes) sum += frozen.at(key);
+  sample = watch.elapsed();
+  s21_bench::printRow("s21::static_map::at", probes.size(), sample,
+                      double(sum));
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 10000000);
+
+  for (std::size_t size : {std::size_t(1000), std::size_t(1000000), count}) {
+    if (size <= count) benchSize(size);
+  }
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include <unordered_map>
+
+#include "core/s21_map.h"
+#include "core/s21_unordered_map.h"
+#include "s21_bench.h"
+
+// Inserts of n int keys in random order, then point lookups of every key
+// in another random order: s21::map over the red-black tree,
+// s21::unordered_map over the open addressing table, and
+// std::unordered_map as the reference. Runs at 1K, 1M and the count given
+// on the command line (10M by default). extra = size after the inserts
+// and checksum of the values read after the lookups, the same for all
+// three.
+
+template <typename Table>
+void benchTable(const char* name, const std::vector<int>& keys,
+                const std::vector<int>& probes) {
+  Table table;
+
+  s21_bench::Stopwatch watch;
+  for (int key : keys) table.insert({key, key % 1000});
+  s21_bench::Sample sample = watch.elapsed();
+  s21_bench::printRow(std::string(name) + "::insert", keys.size(), sample,
+                      double(table.size()));
+
+  long long sum = 0;
+  watch.restart();
+  for (int key : probes) sum += table.at(key);
+  sample = watch.elapsed();
+  s21_bench::printRow(std::string(name) + "::at", probes.size(), sample,
+                      double(sum));
+}
+
+void benchSize(std::size_t count) {
+  std::vector<int> keys = s21_bench::randomKeys(count);
+  std::vector<int> probes = s21_bench::randomKeys(count, 7);
+  for (int& probe : probes) probe = keys[unsigned(probe) % keys.size()];
+
+  s21_bench::printHeader("Inserts and point lookups (extra = size / checksum)",
+                         count);
+  benchTable<s21::map<int, int>>("s21::map", keys, probes);
+  benchTable<s21::unordered_map<int, int>>("s21::unordered_map", keys,
+                                           probes);
+  benchTable<std::unordered_map<int, int>>("std::unordered_map", keys,
+                                           probes);
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 10000000);
+
+  for (std::size_t size : {std::size_t(1000), std::size_t(1000000), count}) {
+    if (size <= count) benchSize(size);
+  }
+
+  return 0;
+}
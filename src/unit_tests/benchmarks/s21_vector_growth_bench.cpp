@@ -0,0 +1,77 @@
+#include <vector>
+
+#include "core/s21_vector.h"
+#include "s21_bench.h"
+
+// Cost of push_back of n ints, growth included: s21::vector<int>, which
+// grows its buffer with realloc, s21::vector of an int wrapper that is not
+// trivially copyable and so grows element by element as every type used
+// to, and std::vector<int>. Runs at 1M and the count given on the command
+// line (100M by default). extra = number of times the buffer moved to
+// another address, then the share of the final capacity left unused under
+// each growth policy.
+
+struct BoxedInt {
+  BoxedInt(int value) : value_(value) {}
+  BoxedInt(const BoxedInt& other) : value_(other.value_) {}
+  BoxedInt& operator=(const BoxedInt& other) {
+    value_ = other.value_;
+    return *this;
+  }
+  int value_;
+};
+
+template <typename VectorT>
+void benchPushBack(const std::string& name, std::size_t count,
+                   bool slack = false) {
+  VectorT values;
+  const void* data = nullptr;
+  std::size_t moves = 0;
+
+  s21_bench::Stopwatch watch;
+  for (std::size_t i = 0; i < count; i++) {
+    values.push_back(int(i));
+    if (values.data() != data) {
+      data = values.data();
+      moves++;
+    }
+  }
+  s21_bench::Sample sample = watch.elapsed();
+
+  double unused = 100.0 * double(values.capacity() - values.size()) /
+                  double(values.capacity());
+  s21_bench::doNotOptimize(values.size());
+  s21_bench::printRow(name, count, sample, slack ? unused : double(moves));
+}
+
+template <typename Growth>
+void benchPolicy(const std::string& name, std::size_t count) {
+  benchPushBack<s21::vector<int, Growth>>(name, count, true);
+}
+
+void benchSize(std::size_t count) {
+  s21_bench::printHeader("push_back of ints (extra = buffer moves)", count);
+  benchPushBack<s21::vector<int>>("s21::vector<int>", count);
+  benchPushBack<s21::vector<BoxedInt>>("s21::vector<BoxedInt>", count);
+  benchPushBack<std::vector<int>>("std::vector<int>", count);
+  benchPushBack<s21::vector<int, s21::growth_policy<3, 2>>>("growth 1.5x",
+                                                            count);
+  benchPushBack<s21::vector<int, s21::page_growth_policy<>>>("page growth",
+                                                             count);
+
+  s21_bench::printHeader("growth policies (extra = unused capacity, %)",
+                         count);
+  benchPolicy<s21::growth_policy<>>("growth 2x", count);
+  benchPolicy<s21::growth_policy<3, 2>>("growth 1.5x", count);
+  benchPolicy<s21::page_growth_policy<>>("page growth", count);
+}
+
+int main(int argc, char* argv[]) {
+  std::size_t count = s21_bench::countFromArgs(argc, argv, 100000000);
+
+  for (std::size_t size : {std::size_t(1000000), count}) {
+    if (size <= count) benchSize(size);
+  }
+
+  return 0;
+}
@@ -154,4 +154,45 @@ class NoConstructClass {
   int val_ = 5;
 };
 
+// Counts copies and moves of all its instances since the last reset()
+class CopyCounter {
+ public:
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  static void reset() noexcept { copies = moves = 0; }
+
+  CopyCounter() = default;
+  CopyCounter(int val) : val_{val} {};
+
+  CopyCounter(const CopyCounter& other) : val_(other.val_) { ++copies; }
+
+  CopyCounter(CopyCounter&& other) noexcept : val_(other.val_) { ++moves; }
+
+  CopyCounter& operator=(const CopyCounter& other) {
+    val_ = other.val_;
+    ++copies;
+    return *this;
+  }
+
+  CopyCounter& operator=(CopyCounter&& other) noexcept {
+    val_ = other.val_;
+    ++moves;
+    return *this;
+  }
+
+  bool operator==(const CopyCounter& other) const noexcept {
+    return val_ == other.val_;
+  }
+
+  bool operator<(const CopyCounter& other) const noexcept {
+    return val_ < other.val_;
+  }
+
+  int value() const noexcept { return val_; }
+
+ private:
+  int val_ = 0;
+};
+
 #endif  // SRC_UNIT_S21_MATRIX_CORE_TEST_H_
\ No newline at end of file
@@ -0,0 +1,472 @@
+#include "core/s21_flat_map.h"
+
+#include <iterator>
+#include <map>
+#include <random>
+
+#include "s21_core_tests.h"
+
+#define DEF_INT_KEYS                          \
+  {                                           \
+    {1, 2}, {2, 4}, {3, 69}, {4, 4}, { 8, 6 } \
+  }
+#define DEF_DBL_KEYS                                                   \
+  {                                                                    \
+    {4.35, 321}, {2.977, 12}, {873.23, 6}, {6.875, 69}, { 9.6534, 98 } \
+  }
+#define DEF_MOCK_KEYS                              \
+  {                                                \
+    {1, 542}, {4, 5}, {44, 69}, {45, 6}, { 88, 4 } \
+  }
+#define DEF_STR_KEYS                                                 \
+  {                                                                  \
+    {"hello", 2}, {"world", 4}, {"!", 69}, {"mock", 6}, { "set", 4 } \
+  }
+
+#define DEF_INT_KEYS_DUBLICATE                \
+  {                                           \
+    {6, 2}, {2, 4}, {3, 5}, {8, 6}, { 10, 0 } \
+  }
+#define DEF_DBL_KEYS_DUBLICATE                                         \
+  {                                                                    \
+    {5.41, 321}, {2.977, 12}, {873.23, 6}, {6.875, 0}, { 123.123, 98 } \
+  }
+#define DEF_MOCK_KEYS_DUBLICATE                     \
+  {                                                 \
+    {1, 542}, {9, 5}, {10, 3}, {45, 6}, { 10, 123 } \
+  }
+#define DEF_STR_KEYS_DUBLICATE                                          \
+  {                                                                     \
+    {"hello", 2}, {"test", 4}, {"!!!", 8}, {"this", 2}, { "mock", 564 } \
+  }
+
+#define INT_KEY 69
+#define DBL_KEY 69.69
+#define MOCK_KEY 69
+#define STR_KEY "69"
+
+#define INT_KEY_DUPLICATE 3
+#define DBL_KEY_DUPLICATE 6.875
+#define MOCK_KEY_DUPLICATE 44
+#define STR_KEY_DUPLICATE "!"
+
+#define INT_OBJ 69
+#define DBL_OBJ 69
+#define MOCK_OBJ 69
+#define STR_OBJ 69
+
+template <typename key_type, typename mapped_type>
+using init_items = std::initializer_list<std::pair<key_type, mapped_type>>;
+
+template <typename key_type, typename mapped_type, typename compare_type>
+void checkFields(
+    const s21::flat_map<key_type, mapped_type, compare_type>& s21_map,
+    const std::map<key_type, mapped_type, compare_type>& std_map) {
+  auto std_it = std_map.begin();
+  for (auto s21_it : s21_map) {
+    EXPECT_EQ(s21_it.first, (*std_it).first);
+    EXPECT_EQ(s21_it.second, (*std_it).second);
+
+    ++std_it;
+  }
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_EQ(s21_map.empty(), std_map.empty());
+}
+
+// -------------------------------------------------
+// -------------------------------------------------
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void constructorDefaultAsCont() {
+  s21::IContainer* ct = new s21::flat_map<key_type, mapped_type>();
+
+  EXPECT_EQ(ct->size(), 0);
+  EXPECT_TRUE(ct->empty());
+
+  delete ct;
+}
+
+#define TESTS_CONSTRUCTOR_INIT_AS_CONT(suiteName)                          \
+  TEST(suiteName, intInitAsCont) { constructorDefaultAsCont<int, int>(); } \
+  TEST(suiteName, doubleInitAsCont) {                                      \
+    constructorDefaultAsCont<double, int>();                               \
+  }                                                                        \
+  TEST(suiteName, mockClassInitAsCont) {                                   \
+    constructorDefaultAsCont<MockClass, int>();                            \
+  }                                                                        \
+  TEST(suiteName, stringInitAsCont) {                                      \
+    constructorDefaultAsCont<std::string, int>();                          \
+  }
+
+TESTS_CONSTRUCTOR_INIT_AS_CONT(s21FlatMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void constructorInitList(const init_items<key_type, mapped_type>& items,
+                         const init_items<key_type, mapped_type>& dublicates) {
+  s21::flat_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items.begin(), items.end());
+  checkFields(s21_map, std_map);
+
+  // The first pair of a key wins, as with std::map
+  s21::flat_map<key_type, mapped_type> s21_map_dublicate(dublicates);
+  std::map<key_type, mapped_type> std_map_dublicate(dublicates.begin(),
+                                                    dublicates.end());
+  checkFields(s21_map_dublicate, std_map_dublicate);
+
+  std::vector<std::pair<key_type, mapped_type>> sorted(std_map.begin(),
+                                                       std_map.end());
+  s21::flat_map<key_type, mapped_type> s21_map_sorted(
+      sorted.begin(), sorted.end(), s21::sorted_tag);
+  checkFields(s21_map_sorted, std_map);
+}
+
+#define TESTS_CONSTRUCTOR_INIT_LIST(suiteName)                           \
+  TEST(suiteName, intInitList) {                                         \
+    constructorInitList<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE); \
+  }                                                                      \
+  TEST(suiteName, doubleInitList) {                                      \
+    constructorInitList<double, int>(DEF_DBL_KEYS,                       \
+                                     DEF_DBL_KEYS_DUBLICATE);            \
+  }                                                                      \
+  TEST(suiteName, mockClassInitList) {                                   \
+    constructorInitList<MockClass, int>(DEF_MOCK_KEYS,                   \
+                                        DEF_MOCK_KEYS_DUBLICATE);        \
+  }                                                                      \
+  TEST(suiteName, stringInitList) {                                      \
+    constructorInitList<std::string, int>(DEF_STR_KEYS,                  \
+                                          DEF_STR_KEYS_DUBLICATE);       \
+  }
+
+TESTS_CONSTRUCTOR_INIT_LIST(s21FlatMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void constructorCopyMove(const init_items<key_type, mapped_type>& items) {
+  s21::flat_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  s21::flat_map<key_type, mapped_type> s21_map_copy(s21_map);
+  checkFields(s21_map_copy, std_map);
+  EXPECT_TRUE(s21_map_copy == s21_map);
+
+  s21::flat_map<key_type, mapped_type> s21_map_moved(std::move(s21_map_copy));
+  checkFields(s21_map_moved, std_map);
+  EXPECT_TRUE(s21_map_copy.empty());
+
+  s21::flat_map<key_type, mapped_type> s21_map_assigned;
+  s21_map_assigned = s21_map;
+  checkFields(s21_map_assigned, std_map);
+  s21_map_assigned = std::move(s21_map);
+  checkFields(s21_map_assigned, std_map);
+  EXPECT_TRUE(s21_map_assigned != s21_map);
+}
+
+#define TESTS_CONSTRUCTOR_COPY_MOVE(suiteName)           \
+  TEST(suiteName, intCopyMove) {                         \
+    constructorCopyMove<int, int>(DEF_INT_KEYS);         \
+  }                                                      \
+  TEST(suiteName, doubleCopyMove) {                      \
+    constructorCopyMove<double, int>(DEF_DBL_KEYS);      \
+  }                                                      \
+  TEST(suiteName, mockClassCopyMove) {                   \
+    constructorCopyMove<MockClass, int>(DEF_MOCK_KEYS);  \
+  }                                                      \
+  TEST(suiteName, stringCopyMove) {                      \
+    constructorCopyMove<std::string, int>(DEF_STR_KEYS); \
+  }
+
+TESTS_CONSTRUCTOR_COPY_MOVE(s21FlatMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodAt(const init_items<key_type, mapped_type>& items,
+              const key_type& key, const key_type& key_duplicate,
+              const mapped_type& obj) {
+  s21::flat_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  EXPECT_EQ(s21_map.at(key_duplicate), std_map.at(key_duplicate));
+  EXPECT_THROW(s21_map.at(key), std::out_of_range);
+  EXPECT_THROW(std::as_const(s21_map).at(key), std::out_of_range);
+
+  s21_map[key] = obj;
+  std_map[key] = obj;
+  s21_map[key_duplicate] = obj;
+  std_map[key_duplicate] = obj;
+  EXPECT_EQ(std::as_const(s21_map).at(key), obj);
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_AT(suiteName)                                                \
+  TEST(suiteName, intAt) {                                                 \
+    methodAt<int, int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE, INT_OBJ); \
+  }                                                                        \
+  TEST(suiteName, doubleAt) {                                              \
+    methodAt<double, int>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE,        \
+                          DBL_OBJ);                                        \
+  }                                                                        \
+  TEST(suiteName, mockClassAt) {                                           \
+    methodAt<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY, MOCK_KEY_DUPLICATE,  \
+                             MOCK_OBJ);                                    \
+  }                                                                        \
+  TEST(suiteName, stringAt) {                                              \
+    methodAt<std::string, int>(DEF_STR_KEYS, STR_KEY, STR_KEY_DUPLICATE,   \
+                               STR_OBJ);                                   \
+  }
+
+TESTS_AT(s21FlatMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodInsert(const init_items<key_type, mapped_type>& items,
+                  const key_type& key, const key_type& key_duplicate,
+                  const mapped_type& obj) {
+  s21::flat_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  for (const key_type& k : {key, key_duplicate}) {
+    auto s21_res = s21_map.insert(std::make_pair(k, obj));
+    auto std_res = std_map.insert(std::make_pair(k, obj));
+    EXPECT_EQ(s21_res.first->second, std_res.first->second);
+    EXPECT_EQ(s21_res.second, std_res.second);
+  }
+  checkFields(s21_map, std_map);
+
+  auto s21_res = s21_map.insert_or_assign(key_duplicate, obj + 1);
+  auto std_res = std_map.insert_or_assign(key_duplicate, obj + 1);
+  EXPECT_EQ(s21_res.first->second, std_res.first->second);
+  EXPECT_EQ(s21_res.second, std_res.second);
+
+  s21_res = s21_map.try_emplace(key_duplicate, obj + 2);
+  std_res = std_map.try_emplace(key_duplicate, obj + 2);
+  EXPECT_EQ(s21_res.first->second, std_res.first->second);
+  EXPECT_EQ(s21_res.second, std_res.second);
+
+  s21_res = s21_map.emplace(key, obj + 3);
+  std_res = std_map.emplace(key, obj + 3);
+  EXPECT_EQ(s21_res.second, std_res.second);
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_INSERT(suiteName)                                         \
+  TEST(suiteName, intInsert) {                                          \
+    methodInsert<int, int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE,    \
+                           INT_OBJ);                                    \
+  }                                                                     \
+  TEST(suiteName, doubleInsert) {                                       \
+    methodInsert<double, int>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE, \
+                              DBL_OBJ);                                 \
+  }                                                                     \
+  TEST(suiteName, mockClassInsert) {                                    \
+    methodInsert<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY,               \
+                                 MOCK_KEY_DUPLICATE, MOCK_OBJ);         \
+  }                                                                     \
+  TEST(suiteName, stringInsert) {                                       \
+    methodInsert<std::string, int>(DEF_STR_KEYS, STR_KEY,               \
+                                   STR_KEY_DUPLICATE, STR_OBJ);         \
+  }
+
+TESTS_INSERT(s21FlatMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodInsertRange(const init_items<key_type, mapped_type>& items,
+                       const init_items<key_type, mapped_type>& insert_items) {
+  s21::flat_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  s21_map.insert(insert_items.begin(), insert_items.end());
+  std_map.insert(insert_items.begin(), insert_items.end());
+  checkFields(s21_map, std_map);
+
+  auto s21_res = s21_map.insert_many(*insert_items.begin(),
+                                     *(insert_items.begin() + 4),
+                                     std::make_pair(key_type(), 7));
+  auto std_last = std_map.insert(std::make_pair(key_type(), 7));
+  ASSERT_EQ(s21_res.size(), 3);
+  EXPECT_FALSE(s21_res[0].second);
+  EXPECT_FALSE(s21_res[1].second);
+  EXPECT_EQ(s21_res[2].second, std_last.second);
+  EXPECT_EQ(s21_res[2].first->second, std_last.first->second);
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_INSERT_RANGE(suiteName)                                  \
+  TEST(suiteName, intInsertRange) {                                    \
+    methodInsertRange<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE); \
+  }                                                                    \
+  TEST(suiteName, doubleInsertRange) {                                 \
+    methodInsertRange<double, int>(DEF_DBL_KEYS,                       \
+                                   DEF_DBL_KEYS_DUBLICATE);            \
+  }                                                                    \
+  TEST(suiteName, mockClassInsertRange) {                              \
+    methodInsertRange<MockClass, int>(DEF_MOCK_KEYS,                   \
+                                      DEF_MOCK_KEYS_DUBLICATE);        \
+  }                                                                    \
+  TEST(suiteName, stringInsertRange) {                                 \
+    methodInsertRange<std::string, int>(DEF_STR_KEYS,                  \
+                                        DEF_STR_KEYS_DUBLICATE);       \
+  }
+
+TESTS_INSERT_RANGE(s21FlatMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodEraseContains(const init_items<key_type, mapped_type>& items,
+                         const key_type& key, const key_type& key_duplicate) {
+  s21::flat_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  EXPECT_FALSE(s21_map.contains(key));
+  EXPECT_TRUE(s21_map.contains(key_duplicate));
+  EXPECT_EQ(s21_map.find(key), s21_map.end());
+
+  s21_map.erase(s21_map.find(key_duplicate));
+  std_map.erase(key_duplicate);
+  EXPECT_FALSE(s21_map.contains(key_duplicate));
+  checkFields(s21_map, std_map);
+
+  auto s21_it = s21_map.erase(s21_map.begin());
+  auto std_it = std_map.erase(std_map.begin());
+  EXPECT_EQ(s21_it->first, std_it->first);
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_ERASE_CONTAINS(suiteName)                          \
+  TEST(suiteName, intEraseContains) {                            \
+    methodEraseContains<int, int>(DEF_INT_KEYS, INT_KEY,         \
+                                  INT_KEY_DUPLICATE);            \
+  }                                                              \
+  TEST(suiteName, doubleEraseContains) {                         \
+    methodEraseContains<double, int>(DEF_DBL_KEYS, DBL_KEY,      \
+                                     DBL_KEY_DUPLICATE);         \
+  }                                                              \
+  TEST(suiteName, mockClassEraseContains) {                      \
+    methodEraseContains<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY, \
+                                        MOCK_KEY_DUPLICATE);     \
+  }                                                              \
+  TEST(suiteName, stringEraseContains) {                         \
+    methodEraseContains<std::string, int>(DEF_STR_KEYS, STR_KEY, \
+                                          STR_KEY_DUPLICATE);    \
+  }
+
+TESTS_ERASE_CONTAINS(s21FlatMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodMergeSwap(const init_items<key_type, mapped_type>& items,
+                     const init_items<key_type, mapped_type>& dublicates) {
+  s21::flat_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items.begin(), items.end());
+  s21::flat_map<key_type, mapped_type> s21_map_dublicate(dublicates);
+  std::map<key_type, mapped_type> std_map_dublicate(dublicates.begin(),
+                                                    dublicates.end());
+
+  s21_map.merge(s21_map_dublicate);
+  std_map.merge(std_map_dublicate);
+  checkFields(s21_map, std_map);
+  checkFields(s21_map_dublicate, std_map_dublicate);
+
+  s21_map.swap(s21_map_dublicate);
+  checkFields(s21_map, std_map_dublicate);
+  checkFields(s21_map_dublicate, std_map);
+
+  for (auto& item : std_map) {
+    auto s21_range = s21_map_dublicate.equal_range(item.first);
+    EXPECT_EQ(std::distance(s21_range.first, s21_range.second), 1);
+    EXPECT_EQ(s21_map_dublicate.lower_bound(item.first), s21_range.first);
+    EXPECT_EQ(s21_map_dublicate.upper_bound(item.first), s21_range.second);
+  }
+}
+
+#define TESTS_MERGE_SWAP(suiteName)                                          \
+  TEST(suiteName, intMergeSwap) {                                            \
+    methodMergeSwap<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                          \
+  TEST(suiteName, doubleMergeSwap) {                                         \
+    methodMergeSwap<double, int>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                          \
+  TEST(suiteName, mockClassMergeSwap) {                                      \
+    methodMergeSwap<MockClass, int>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                          \
+  TEST(suiteName, stringMergeSwap) {                                         \
+    methodMergeSwap<std::string, int>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_MERGE_SWAP(s21FlatMap)
+
+// -------------------------------------------------
+
+TEST(s21FlatMap, stringTransparentLookup) {
+  s21::flat_map<std::string, int, std::less<>> s21_map(DEF_STR_KEYS);
+
+  EXPECT_TRUE(s21_map.contains("mock"));
+  EXPECT_FALSE(s21_map.contains("69"));
+  EXPECT_EQ(s21_map.lower_bound("i")->first, "mock");
+}
+
+// Random updates of every kind against std::map
+TEST(s21FlatMap, intBigRandomUpdates) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 999);
+  s21::flat_map<int, int> s21_map;
+  std::map<int, int> std_map;
+
+  for (int round = 0; round < 200; ++round) {
+    std::vector<std::pair<int, int>> batch(round % 7 * 5);
+    for (auto& item : batch) item = std::make_pair(key(gen), round);
+    int single = key(gen);
+
+    switch (round % 4) {
+      case 0:
+        s21_map.insert(batch.begin(), batch.end());
+        std_map.insert(batch.begin(), batch.end());
+        break;
+      case 1:
+        s21_map[single] += round;
+        std_map[single] += round;
+        break;
+      case 2:
+        if (s21_map.contains(single)) {
+          s21_map.erase(s21_map.find(single));
+          std_map.erase(single);
+        }
+        break;
+      default:
+        s21::flat_map<int, int> s21_other(batch.begin(), batch.end());
+        std::map<int, int> std_other(batch.begin(), batch.end());
+        s21_map.merge(s21_other);
+        std_map.merge(std_other);
+        checkFields(s21_other, std_other);
+    }
+  }
+  checkFields(s21_map, std_map);
+}
+
+TEST(s21FlatMap, vectorPayloadMovedIn) {
+  s21::flat_map<int, s21::vector<char>> s21_map;
+  s21::vector<char> first(4096);
+  s21::vector<char> second(4096);
+  s21::vector<char> third(4096);
+  const char* firstData = first.data();
+  const char* secondData = second.data();
+  const char* thirdData = third.data();
+
+  s21_map.try_emplace(1, std::move(first));
+  s21_map.insert(std::make_pair(3, std::move(third)));
+  s21_map.emplace(2, std::move(second));
+
+  EXPECT_EQ(s21_map.at(1).data(), firstData);
+  EXPECT_EQ(s21_map.at(2).data(), secondData);
+  EXPECT_EQ(s21_map.at(3).data(), thirdData);
+  EXPECT_EQ(s21_map.at(1).size(), 4096U);
+}
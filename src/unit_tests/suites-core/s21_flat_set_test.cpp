@@ -0,0 +1,514 @@
+#include "core/s21_flat_set.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+
+#include "s21_core_tests.h"
+
+#define DEF_INT_KEYS \
+  { 1, 2, 3, 4, 8 }
+#define DEF_DBL_KEYS \
+  { 4.35, 2.977, 873.23, 6.875, 9.6534 }
+#define DEF_MOCK_KEYS \
+  { 1, 4, 44, 45, 88 }
+#define DEF_STR_KEYS \
+  { "hello", "world", "!", "mock", "set" }
+
+#define DEF_INT_KEYS_DUBLICATE \
+  { 6, 2, 3, 8, 10 }
+#define DEF_DBL_KEYS_DUBLICATE \
+  { 5.41, 2.977, 873.23, 6.875, 123.123 }
+#define DEF_MOCK_KEYS_DUBLICATE \
+  { 1, 9, 10, 45, 10 }
+#define DEF_STR_KEYS_DUBLICATE \
+  { "hello", "test", "!!!", "this", "mock" }
+
+#define INT_KEY 69
+#define DBL_KEY 69.69
+#define MOCK_KEY 69
+#define STR_KEY "69"
+
+#define INT_KEY_DUPLICATE 3
+#define DBL_KEY_DUPLICATE 6.875
+#define MOCK_KEY_DUPLICATE 44
+#define STR_KEY_DUPLICATE "!"
+
+template <typename key_type, typename compare_type>
+void checkFields(const s21::flat_set<key_type, compare_type>& s21_set,
+                 const std::set<key_type, compare_type>& std_set) {
+  auto std_it = std_set.begin();
+  for (auto s21_it : s21_set) {
+    EXPECT_EQ(s21_it, *std_it);
+
+    ++std_it;
+  }
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  EXPECT_EQ(s21_set.empty(), std_set.empty());
+}
+
+// -------------------------------------------------
+// -------------------------------------------------
+// -------------------------------------------------
+
+template <typename key_type>
+void constructorDefaultAsCont() {
+  s21::IContainer* ct = new s21::flat_set<key_type>();
+
+  EXPECT_EQ(ct->size(), 0);
+  EXPECT_TRUE(ct->empty());
+
+  delete ct;
+}
+
+#define TESTS_CONSTRUCTOR_INIT_AS_CONT(suiteName)                     \
+  TEST(suiteName, intInitAsCont) { constructorDefaultAsCont<int>(); } \
+  TEST(suiteName, doubleInitAsCont) {                                 \
+    constructorDefaultAsCont<double>();                               \
+  }                                                                   \
+  TEST(suiteName, mockClassInitAsCont) {                              \
+    constructorDefaultAsCont<MockClass>();                            \
+  }                                                                   \
+  TEST(suiteName, stringInitAsCont) {                                 \
+    constructorDefaultAsCont<std::string>();                          \
+  }
+
+TESTS_CONSTRUCTOR_INIT_AS_CONT(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void constructorInitList(const std::initializer_list<key_type>& items,
+                         const std::initializer_list<key_type>& dublicates) {
+  s21::flat_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+  checkFields(s21_set, std_set);
+
+  s21::flat_set<key_type> s21_set_dublicate(dublicates);
+  std::set<key_type> std_set_dublicate(dublicates);
+  checkFields(s21_set_dublicate, std_set_dublicate);
+}
+
+#define TESTS_CONSTRUCTOR_INIT_LIST(suiteName)                              \
+  TEST(suiteName, intInitList) {                                            \
+    constructorInitList<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                         \
+  TEST(suiteName, doubleInitList) {                                         \
+    constructorInitList<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                         \
+  TEST(suiteName, mockClassInitList) {                                      \
+    constructorInitList<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                         \
+  TEST(suiteName, stringInitList) {                                         \
+    constructorInitList<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_CONSTRUCTOR_INIT_LIST(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void constructorRange(const std::initializer_list<key_type>& items) {
+  std::set<key_type> std_set(items);
+  std::vector<key_type> sorted(std_set.begin(), std_set.end());
+
+  s21::flat_set<key_type> s21_set(items.begin(), items.end());
+  checkFields(s21_set, std_set);
+
+  s21::flat_set<key_type> s21_set_sorted(sorted.begin(), sorted.end(),
+                                         s21::sorted_tag);
+  checkFields(s21_set_sorted, std_set);
+
+  s21::flat_set<key_type> s21_set_assigned;
+  s21_set_assigned.assign(items.begin(), items.end(), s21::sorted_tag);
+  checkFields(s21_set_assigned, std_set);
+}
+
+#define TESTS_CONSTRUCTOR_RANGE(suiteName)                                 \
+  TEST(suiteName, intRange) { constructorRange<int>(DEF_INT_KEYS); }       \
+  TEST(suiteName, doubleRange) { constructorRange<double>(DEF_DBL_KEYS); } \
+  TEST(suiteName, mockClassRange) {                                        \
+    constructorRange<MockClass>(DEF_MOCK_KEYS_DUBLICATE);                  \
+  }                                                                        \
+  TEST(suiteName, stringRange) { constructorRange<std::string>(DEF_STR_KEYS); }
+
+TESTS_CONSTRUCTOR_RANGE(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void constructorCopyMove(const std::initializer_list<key_type>& items) {
+  s21::flat_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  s21::flat_set<key_type> s21_set_copy(s21_set);
+  checkFields(s21_set_copy, std_set);
+  EXPECT_TRUE(s21_set_copy == s21_set);
+
+  s21::flat_set<key_type> s21_set_moved(std::move(s21_set_copy));
+  checkFields(s21_set_moved, std_set);
+  EXPECT_TRUE(s21_set_copy.empty());
+
+  s21::flat_set<key_type> s21_set_assigned;
+  s21_set_assigned = s21_set;
+  checkFields(s21_set_assigned, std_set);
+  s21_set_assigned = std::move(s21_set);
+  checkFields(s21_set_assigned, std_set);
+  EXPECT_TRUE(s21_set_assigned != s21_set);
+}
+
+#define TESTS_CONSTRUCTOR_COPY_MOVE(suiteName)                             \
+  TEST(suiteName, intCopyMove) { constructorCopyMove<int>(DEF_INT_KEYS); } \
+  TEST(suiteName, doubleCopyMove) {                                        \
+    constructorCopyMove<double>(DEF_DBL_KEYS);                             \
+  }                                                                        \
+  TEST(suiteName, mockClassCopyMove) {                                     \
+    constructorCopyMove<MockClass>(DEF_MOCK_KEYS);                         \
+  }                                                                        \
+  TEST(suiteName, stringCopyMove) {                                        \
+    constructorCopyMove<std::string>(DEF_STR_KEYS);                        \
+  }
+
+TESTS_CONSTRUCTOR_COPY_MOVE(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodInsert(const std::initializer_list<key_type>& items,
+                  const key_type& key, const key_type& key_duplicate) {
+  s21::flat_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  auto s21_res = s21_set.insert(key);
+  auto std_res = std_set.insert(key);
+  EXPECT_EQ(*s21_res.first, *std_res.first);
+  EXPECT_EQ(s21_res.second, std_res.second);
+
+  s21_res = s21_set.insert(key_duplicate);
+  std_res = std_set.insert(key_duplicate);
+  EXPECT_EQ(*s21_res.first, *std_res.first);
+  EXPECT_EQ(s21_res.second, std_res.second);
+
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_INSERT(suiteName)                                           \
+  TEST(suiteName, intInsert) {                                            \
+    methodInsert<int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);          \
+  }                                                                       \
+  TEST(suiteName, doubleInsert) {                                         \
+    methodInsert<double>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE);       \
+  }                                                                       \
+  TEST(suiteName, mockClassInsert) {                                      \
+    methodInsert<MockClass>(DEF_MOCK_KEYS, MOCK_KEY, MOCK_KEY_DUPLICATE); \
+  }                                                                       \
+  TEST(suiteName, stringInsert) {                                         \
+    methodInsert<std::string>(DEF_STR_KEYS, STR_KEY, STR_KEY_DUPLICATE);  \
+  }
+
+TESTS_INSERT(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodInsertHint(const std::initializer_list<key_type>& items,
+                      const std::initializer_list<key_type>& insert_items) {
+  s21::flat_set<key_type> s21_set;
+  std::set<key_type> std_set;
+
+  // Right hints, at the end and in front of the next key
+  for (const key_type& key : items) s21_set.insert(s21_set.end(), key);
+  std_set.insert(items);
+  checkFields(s21_set, std_set);
+
+  // Any other hint is only a miss
+  for (const key_type& key : insert_items) {
+    auto it = s21_set.emplace_hint(s21_set.begin(), key);
+    EXPECT_EQ(*it, *std_set.insert(key).first);
+  }
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_INSERT_HINT(suiteName)                                     \
+  TEST(suiteName, intInsertHint) {                                       \
+    methodInsertHint<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                      \
+  TEST(suiteName, doubleInsertHint) {                                    \
+    methodInsertHint<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                      \
+  TEST(suiteName, mockClassInsertHint) {                                 \
+    methodInsertHint<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                      \
+  TEST(suiteName, stringInsertHint) {                                    \
+    methodInsertHint<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_INSERT_HINT(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodInsertRange(const std::initializer_list<key_type>& items,
+                       const std::initializer_list<key_type>& insert_items) {
+  s21::flat_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  s21_set.insert(insert_items.begin(), insert_items.end());
+  std_set.insert(insert_items.begin(), insert_items.end());
+  checkFields(s21_set, std_set);
+
+  s21_set.insert(insert_items.begin(), insert_items.begin());
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_INSERT_RANGE(suiteName)                                     \
+  TEST(suiteName, intInsertRange) {                                       \
+    methodInsertRange<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                       \
+  TEST(suiteName, doubleInsertRange) {                                    \
+    methodInsertRange<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                       \
+  TEST(suiteName, mockClassInsertRange) {                                 \
+    methodInsertRange<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                       \
+  TEST(suiteName, stringInsertRange) {                                    \
+    methodInsertRange<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_INSERT_RANGE(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodInsertMany(const std::initializer_list<key_type>& items,
+                      const std::initializer_list<key_type>& insert_items) {
+  s21::flat_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  auto s21_res = s21_set.insert_many(
+      *insert_items.begin(), *(insert_items.begin() + 1),
+      *(insert_items.begin() + 2), *(insert_items.begin() + 4),
+      *(insert_items.begin() + 2));
+  std::vector<std::pair<key_type, bool>> std_res;
+  for (int i : {0, 1, 2, 4, 2}) {
+    bool added = std_set.insert(*(insert_items.begin() + i)).second;
+    std_res.push_back(std::make_pair(*(insert_items.begin() + i), added));
+  }
+
+  ASSERT_EQ(s21_res.size(), std_res.size());
+  for (std::size_t i = 0; i < std_res.size(); ++i) {
+    EXPECT_EQ(*s21_res[i].first, std_res[i].first);
+    EXPECT_EQ(s21_res[i].second, std_res[i].second);
+  }
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_INSERT_MANY(suiteName)                                     \
+  TEST(suiteName, intMethodInsertMany) {                                 \
+    methodInsertMany<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                      \
+  TEST(suiteName, doubleMethodInsertMany) {                              \
+    methodInsertMany<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                      \
+  TEST(suiteName, mockClassMethodInsertMany) {                           \
+    methodInsertMany<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                      \
+  TEST(suiteName, stringMethodInsertMany) {                              \
+    methodInsertMany<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_INSERT_MANY(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodErase(const std::initializer_list<key_type>& items,
+                 const key_type& key) {
+  s21::flat_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  auto s21_it = s21_set.erase(s21_set.find(key));
+  auto std_it = std_set.erase(std_set.find(key));
+  EXPECT_EQ(*s21_it, *std_it);
+  checkFields(s21_set, std_set);
+
+  s21_it = s21_set.erase(s21_set.begin());
+  std_it = std_set.erase(std_set.begin());
+  EXPECT_EQ(*s21_it, *std_it);
+  checkFields(s21_set, std_set);
+
+  s21_it = s21_set.erase(std::prev(s21_set.end()));
+  std_set.erase(std::prev(std_set.end()));
+  EXPECT_EQ(s21_it, s21_set.end());
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_ERASE(suiteName)                                     \
+  TEST(suiteName, intErase) { methodErase<int>(DEF_INT_KEYS, 3); } \
+  TEST(suiteName, doubleErase) {                                   \
+    methodErase<double>(DEF_DBL_KEYS, DBL_KEY_DUPLICATE);          \
+  }                                                                \
+  TEST(suiteName, mockClassErase) {                                \
+    methodErase<MockClass>(DEF_MOCK_KEYS, MOCK_KEY_DUPLICATE);     \
+  }                                                                \
+  TEST(suiteName, stringErase) {                                   \
+    methodErase<std::string>(DEF_STR_KEYS, "mock");                \
+  }
+
+TESTS_ERASE(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodFindContains(const std::initializer_list<key_type>& items,
+                        const key_type& key, const key_type& key_duplicate) {
+  const s21::flat_set<key_type> s21_set(items);
+
+  EXPECT_FALSE(s21_set.contains(key));
+  EXPECT_TRUE(s21_set.contains(key_duplicate));
+  EXPECT_EQ(s21_set.find(key), s21_set.end());
+  EXPECT_EQ(*s21_set.find(key_duplicate), key_duplicate);
+}
+
+#define TESTS_FIND_CONTAINS(suiteName)                                    \
+  TEST(suiteName, intFindContains) {                                      \
+    methodFindContains<int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                       \
+  TEST(suiteName, doubleFindContains) {                                   \
+    methodFindContains<double>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                       \
+  TEST(suiteName, mockClassFindContains) {                                \
+    methodFindContains<MockClass>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                  MOCK_KEY_DUPLICATE);                    \
+  }                                                                       \
+  TEST(suiteName, stringFindContains) {                                   \
+    methodFindContains<std::string>(DEF_STR_KEYS, STR_KEY,                \
+                                    STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_FIND_CONTAINS(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodBounds(const std::initializer_list<key_type>& items,
+                  const std::initializer_list<key_type>& probes) {
+  s21::flat_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  for (const key_type& key : probes) {
+    EXPECT_EQ(std::distance(s21_set.begin(), s21_set.lower_bound(key)),
+              std::distance(std_set.begin(), std_set.lower_bound(key)));
+    EXPECT_EQ(std::distance(s21_set.begin(), s21_set.upper_bound(key)),
+              std::distance(std_set.begin(), std_set.upper_bound(key)));
+    auto s21_range = s21_set.equal_range(key);
+    auto std_range = std_set.equal_range(key);
+    EXPECT_EQ(std::distance(s21_range.first, s21_range.second),
+              std::distance(std_range.first, std_range.second));
+  }
+}
+
+#define TESTS_BOUNDS(suiteName)                                      \
+  TEST(suiteName, intBounds) {                                       \
+    methodBounds<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                  \
+  TEST(suiteName, doubleBounds) {                                    \
+    methodBounds<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                  \
+  TEST(suiteName, mockClassBounds) {                                 \
+    methodBounds<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                  \
+  TEST(suiteName, stringBounds) {                                    \
+    methodBounds<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_BOUNDS(s21FlatSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodMergeSwap(const std::initializer_list<key_type>& items,
+                     const std::initializer_list<key_type>& dublicates) {
+  s21::flat_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+  s21::flat_set<key_type> s21_set_dublicate(dublicates);
+  std::set<key_type> std_set_dublicate(dublicates);
+
+  s21_set.merge(s21_set_dublicate);
+  std_set.merge(std_set_dublicate);
+  checkFields(s21_set, std_set);
+  checkFields(s21_set_dublicate, std_set_dublicate);
+
+  s21_set.swap(s21_set_dublicate);
+  checkFields(s21_set, std_set_dublicate);
+  checkFields(s21_set_dublicate, std_set);
+
+  s21_set_dublicate.clear();
+  checkFields(s21_set_dublicate, std::set<key_type>());
+}
+
+#define TESTS_MERGE_SWAP(suiteName)                                     \
+  TEST(suiteName, intMergeSwap) {                                       \
+    methodMergeSwap<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                     \
+  TEST(suiteName, doubleMergeSwap) {                                    \
+    methodMergeSwap<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                     \
+  TEST(suiteName, mockClassMergeSwap) {                                 \
+    methodMergeSwap<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                     \
+  TEST(suiteName, stringMergeSwap) {                                    \
+    methodMergeSwap<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_MERGE_SWAP(s21FlatSet)
+
+// -------------------------------------------------
+
+TEST(s21FlatSet, stringTransparentLookup) {
+  s21::flat_set<std::string, std::less<>> s21_set(DEF_STR_KEYS);
+
+  EXPECT_TRUE(s21_set.contains("mock"));
+  EXPECT_FALSE(s21_set.contains("69"));
+  EXPECT_EQ(*s21_set.find("world"), "world");
+  EXPECT_EQ(*s21_set.lower_bound("i"), "mock");
+}
+
+// Random updates of every kind against std::set
+TEST(s21FlatSet, intBigRandomUpdates) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 999);
+  s21::flat_set<int> s21_set;
+  std::set<int> std_set;
+
+  for (int round = 0; round < 200; ++round) {
+    std::vector<int> batch(round % 7 * 5);
+    for (int& item : batch) item = key(gen);
+    int single = key(gen);
+
+    switch (round % 4) {
+      case 0:
+        s21_set.insert(batch.begin(), batch.end());
+        std_set.insert(batch.begin(), batch.end());
+        break;
+      case 1:
+        EXPECT_EQ(s21_set.insert(single).second,
+                  std_set.insert(single).second);
+        break;
+      case 2:
+        if (s21_set.contains(single)) {
+          s21_set.erase(s21_set.find(single));
+          std_set.erase(single);
+        }
+        break;
+      default:
+        s21::flat_set<int> s21_other(batch.begin(), batch.end());
+        std::set<int> std_other(batch.begin(), batch.end());
+        s21_set.merge(s21_other);
+        std_set.merge(std_other);
+        checkFields(s21_other, std_other);
+    }
+  }
+  checkFields(s21_set, std_set);
+}
@@ -0,0 +1,5 @@
+// The s21Map suites again, as s21MapBTree, against the B-tree backend
+#define S21_TREE_POLICY s21::btree_policy<>
+#define s21Map s21MapBTree
+
+#include "s21_map_test.cpp"
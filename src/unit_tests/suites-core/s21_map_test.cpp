@@ -1,9 +1,22 @@
 #include "core/s21_map.h"
 
 #include <map>
+#include <string_view>
 
 #include "s21_core_tests.h"
 
+// s21_map_btree_test.cpp builds this file again with S21_TREE_POLICY set
+// to the B-tree backend. Tests of node-based behaviour are left out there.
+#ifndef S21_TREE_POLICY
+#define S21_TREE_POLICY s21::default_tree_policy
+#define S21_NODE_BASED_TREE
+#endif
+
+namespace {
+
+template <typename K, typename V, typename C = std::less<K>>
+using test_map = s21::map<K, V, C, S21_TREE_POLICY>;
+
 #define DEF_INT_KEYS                          \
   {                                           \
     {1, 2}, {2, 4}, {3, 69}, {4, 4}, { 8, 6 } \
@@ -80,9 +93,11 @@
 #define MOCK_OBJ 69
 #define STR_OBJ 69
 
-template <typename key_type, typename mapped_type>
-void checkFields(const s21::map<key_type, mapped_type>& s21_map,
-                 const std::map<key_type, mapped_type>& std_map) {
+template <typename key_type, typename mapped_type, typename compare_type,
+          typename policy_type>
+void checkFields(
+    const s21::map<key_type, mapped_type, compare_type, policy_type>& s21_map,
+    const std::map<key_type, mapped_type, compare_type>& std_map) {
   auto std_it = std_map.begin();
   for (auto s21_it : s21_map) {
     EXPECT_EQ(s21_it.first, (*std_it).first);
@@ -94,7 +109,7 @@ void checkFields(const s21::map<key_type, mapped_type>& s21_map,
 }
 
 template <typename key_type, typename mapped_type>
-void checkFieldsEmpty(const s21::map<key_type, mapped_type>& s21_map,
+void checkFieldsEmpty(const test_map<key_type, mapped_type>& s21_map,
                       const std::map<key_type, mapped_type>& std_map) {
   auto std_it = std_map.begin();
   for (auto s21_it : s21_map) {
@@ -113,7 +128,7 @@ void checkFieldsEmpty(const s21::map<key_type, mapped_type>& s21_map,
 
 template <typename key_type, typename mapped_type>
 void constructorDefaultAsCont() {
-  s21::IContainer* ct = new s21::map<key_type, mapped_type>();
+  s21::IContainer* ct = new test_map<key_type, mapped_type>();
 
   EXPECT_EQ(ct->size(), 0);
   EXPECT_TRUE(ct->empty());
@@ -139,7 +154,7 @@ TESTS_CONSTRUCTOR_INIT_AS_CONT(s21Map)
 
 template <typename key_type, typename mapped_type>
 void constructorDefault() {
-  s21::map<key_type, mapped_type> s21_map;
+  test_map<key_type, mapped_type> s21_map;
   std::map<key_type, mapped_type> std_map;
 
   checkFieldsEmpty(s21_map, std_map);
@@ -159,7 +174,7 @@ template <typename key_type, typename mapped_type>
 void constructorInitList(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
   checkFields(s21_map, std_map);
@@ -185,10 +200,10 @@ TESTS_CONSTRUCTOR_INIT_LIST(s21Map)
 
 template <typename key_type, typename mapped_type>
 void constructorCopyEmpty() {
-  s21::map<key_type, mapped_type> s21_map;
+  test_map<key_type, mapped_type> s21_map;
   std::map<key_type, mapped_type> std_map;
 
-  s21::map<key_type, mapped_type> s21_map_copy(s21_map);
+  test_map<key_type, mapped_type> s21_map_copy(s21_map);
   std::map<key_type, mapped_type> std_map_copy(std_map);
 
   checkFields(s21_map_copy, std_map_copy);
@@ -210,10 +225,10 @@ template <typename key_type, typename mapped_type>
 void constructorCopy(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_copy(s21_map);
+  test_map<key_type, mapped_type> s21_map_copy(s21_map);
   std::map<key_type, mapped_type> std_map_copy(std_map);
 
   checkFields(s21_map_copy, std_map_copy);
@@ -235,10 +250,10 @@ TESTS_CONSTRUCTOR_COPY(s21Map)
 
 template <typename key_type, typename mapped_type>
 void constructorMoveEmpty() {
-  s21::map<key_type, mapped_type> s21_map;
+  test_map<key_type, mapped_type> s21_map;
   std::map<key_type, mapped_type> std_map;
 
-  s21::map<key_type, mapped_type> s21_map_move(std::move(s21_map));
+  test_map<key_type, mapped_type> s21_map_move(std::move(s21_map));
   std::map<key_type, mapped_type> std_map_move(std::move(std_map));
 
   checkFields(s21_map_move, std_map_move);
@@ -260,10 +275,10 @@ template <typename key_type, typename mapped_type>
 void constructorMove(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_move(std::move(s21_map));
+  test_map<key_type, mapped_type> s21_map_move(std::move(s21_map));
   std::map<key_type, mapped_type> std_map_move(std::move(std_map));
 
   checkFields(s21_map_move, std_map_move);
@@ -285,10 +300,10 @@ TESTS_CONSTRUCTOR_MOVE(s21Map)
 
 template <typename key_type, typename mapped_type>
 void operatorCopyEmpty() {
-  s21::map<key_type, mapped_type> s21_map;
+  test_map<key_type, mapped_type> s21_map;
   std::map<key_type, mapped_type> std_map;
 
-  s21::map<key_type, mapped_type> s21_map_copy = s21_map;
+  test_map<key_type, mapped_type> s21_map_copy = s21_map;
   std::map<key_type, mapped_type> std_map_copy = std_map;
 
   checkFields(s21_map_copy, std_map_copy);
@@ -314,10 +329,10 @@ template <typename key_type, typename mapped_type>
 void operatorCopy(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_copy = s21_map;
+  test_map<key_type, mapped_type> s21_map_copy = s21_map;
   std::map<key_type, mapped_type> std_map_copy = std_map;
 
   checkFields(s21_map_copy, std_map_copy);
@@ -341,10 +356,10 @@ TESTS_OPERATOR_COPY(s21Map)
 
 template <typename key_type, typename mapped_type>
 void operatorMoveEmpty() {
-  s21::map<key_type, mapped_type> s21_map;
+  test_map<key_type, mapped_type> s21_map;
   std::map<key_type, mapped_type> std_map;
 
-  s21::map<key_type, mapped_type> s21_map_move = std::move(s21_map);
+  test_map<key_type, mapped_type> s21_map_move = std::move(s21_map);
   std::map<key_type, mapped_type> std_map_move = std::move(std_map);
 
   checkFields(s21_map_move, std_map_move);
@@ -370,10 +385,10 @@ template <typename key_type, typename mapped_type>
 void operatorMove(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_move = std::move(s21_map);
+  test_map<key_type, mapped_type> s21_map_move = std::move(s21_map);
   std::map<key_type, mapped_type> std_map_move = std::move(std_map);
 
   checkFields(s21_map_move, std_map_move);
@@ -399,10 +414,10 @@ template <typename key_type, typename mapped_type>
 void methodEmpty(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_empty;
+  test_map<key_type, mapped_type> s21_map_empty;
   std::map<key_type, mapped_type> std_map_empty;
 
   EXPECT_EQ(s21_map.empty(), std_map.empty());
@@ -425,10 +440,10 @@ template <typename key_type, typename mapped_type>
 void methodSize(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_empty;
+  test_map<key_type, mapped_type> s21_map_empty;
   std::map<key_type, mapped_type> std_map_empty;
 
   EXPECT_EQ(s21_map.size(), std_map.size());
@@ -451,8 +466,8 @@ template <typename key_type, typename mapped_type>
 void methodSwap(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
-  s21::map<key_type, mapped_type> s21_map_empty;
+  test_map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map_empty;
 
   std::map<key_type, mapped_type> std_map(items);
 
@@ -478,10 +493,10 @@ void methodMergeWithDublicates(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         itemsDublicates) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_dublicate(itemsDublicates);
+  test_map<key_type, mapped_type> s21_map_dublicate(itemsDublicates);
   std::map<key_type, mapped_type> std_map_dublicate(itemsDublicates);
 
   checkFields(s21_map, std_map);
@@ -491,6 +506,7 @@ void methodMergeWithDublicates(
   std_map.merge(std_map_dublicate);
 
   checkFields(s21_map, std_map);
+  checkFields(s21_map_dublicate, std_map_dublicate);
 }
 
 #define TESTS_MERGE_WITH_DUBLICATES(suiteName)                                 \
@@ -519,10 +535,10 @@ void methodMergeWithNoDublicates(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         itemsNoDublicates) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_no_dublicate(itemsNoDublicates);
+  test_map<key_type, mapped_type> s21_map_no_dublicate(itemsNoDublicates);
   std::map<key_type, mapped_type> std_map_no_dublicate(itemsNoDublicates);
 
   checkFields(s21_map, std_map);
@@ -532,6 +548,7 @@ void methodMergeWithNoDublicates(
   std_map.merge(std_map_no_dublicate);
 
   checkFields(s21_map, std_map);
+  checkFields(s21_map_no_dublicate, std_map_no_dublicate);
 }
 
 #define TESTS_MERGE_WITH_NO_DUBLICATES(suiteName)                             \
@@ -560,10 +577,10 @@ template <typename key_type, typename mapped_type>
 void methodClear(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_empty;
+  test_map<key_type, mapped_type> s21_map_empty;
   std::map<key_type, mapped_type> std_map_empty;
 
   s21_map.clear();
@@ -592,20 +609,20 @@ template <typename key_type, typename mapped_type>
 void methodBegin(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_empty;
+  test_map<key_type, mapped_type> s21_map_empty;
   std::map<key_type, mapped_type> std_map_empty;
 
-  typename s21::map<key_type, mapped_type>::iterator it1 =
+  typename test_map<key_type, mapped_type>::iterator it1 =
       s21_map_empty.begin();
   typename std::map<key_type, mapped_type>::iterator it2 =
       std_map_empty.begin();
 
   EXPECT_EQ(it1 == s21_map_empty.end(), it2 == std_map_empty.end());
 
-  typename s21::map<key_type, mapped_type>::iterator it3 = s21_map.begin();
+  typename test_map<key_type, mapped_type>::iterator it3 = s21_map.begin();
   typename std::map<key_type, mapped_type>::iterator it4 = std_map.begin();
 
   EXPECT_EQ(it3 != s21_map.end(), it4 != std_map.end());
@@ -628,20 +645,20 @@ template <typename key_type, typename mapped_type>
 void methodBeginConst(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  s21::map<key_type, mapped_type> s21_map_empty;
+  test_map<key_type, mapped_type> s21_map_empty;
   std::map<key_type, mapped_type> std_map_empty;
 
-  typename s21::map<key_type, mapped_type>::const_iterator it1 =
+  typename test_map<key_type, mapped_type>::const_iterator it1 =
       s21_map_empty.begin();
   typename std::map<key_type, mapped_type>::const_iterator it2 =
       std_map_empty.begin();
 
   EXPECT_EQ(it1 == s21_map_empty.end(), it2 == std_map_empty.end());
 
-  typename s21::map<key_type, mapped_type>::const_iterator it3 =
+  typename test_map<key_type, mapped_type>::const_iterator it3 =
       s21_map.begin();
   typename std::map<key_type, mapped_type>::const_iterator it4 =
       std_map.begin();
@@ -670,10 +687,10 @@ template <typename key_type, typename mapped_type>
 void methodIteratorPlus(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::iterator it1 = s21_map.begin();
+  typename test_map<key_type, mapped_type>::iterator it1 = s21_map.begin();
   typename std::map<key_type, mapped_type>::iterator it2 = std_map.begin();
 
   ++it1;
@@ -709,10 +726,10 @@ template <typename key_type, typename mapped_type>
 void methodIteratorMinus(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::iterator it1 = s21_map.begin();
+  typename test_map<key_type, mapped_type>::iterator it1 = s21_map.begin();
   typename std::map<key_type, mapped_type>::iterator it2 = std_map.begin();
 
   ++it1;
@@ -748,13 +765,13 @@ template <typename key_type, typename mapped_type>
 void methodIteratorAssignment(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::iterator it1 = s21_map.begin();
+  typename test_map<key_type, mapped_type>::iterator it1 = s21_map.begin();
   typename std::map<key_type, mapped_type>::iterator it2 = std_map.begin();
 
-  typename s21::map<key_type, mapped_type>::iterator it3 = it1;
+  typename test_map<key_type, mapped_type>::iterator it3 = it1;
   typename std::map<key_type, mapped_type>::iterator it4 = it2;
 
   EXPECT_EQ((*it1).second, (*it3).second);
@@ -783,13 +800,13 @@ template <typename key_type, typename mapped_type>
 void methodIteratorEqual(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::iterator it1 = s21_map.begin();
+  typename test_map<key_type, mapped_type>::iterator it1 = s21_map.begin();
   typename std::map<key_type, mapped_type>::iterator it2 = std_map.begin();
 
-  typename s21::map<key_type, mapped_type>::iterator it3 = s21_map.begin();
+  typename test_map<key_type, mapped_type>::iterator it3 = s21_map.begin();
   typename std::map<key_type, mapped_type>::iterator it4 = std_map.begin();
 
   EXPECT_EQ(it1 == it3, it2 == it4);
@@ -817,10 +834,10 @@ template <typename key_type, typename mapped_type>
 void methodIteratorNotEqual(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::iterator it1 = s21_map.begin();
+  typename test_map<key_type, mapped_type>::iterator it1 = s21_map.begin();
   typename std::map<key_type, mapped_type>::iterator it2 = std_map.begin();
 
   EXPECT_EQ(it1 != s21_map.end(), it2 != std_map.end());
@@ -848,10 +865,10 @@ template <typename key_type, typename mapped_type>
 void methodIteratorPlusConst(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::const_iterator it1 =
+  typename test_map<key_type, mapped_type>::const_iterator it1 =
       s21_map.begin();
   typename std::map<key_type, mapped_type>::const_iterator it2 =
       std_map.begin();
@@ -889,10 +906,10 @@ template <typename key_type, typename mapped_type>
 void methodIteratorMinusConst(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::const_iterator it1 =
+  typename test_map<key_type, mapped_type>::const_iterator it1 =
       s21_map.begin();
   typename std::map<key_type, mapped_type>::const_iterator it2 =
       std_map.begin();
@@ -930,15 +947,15 @@ template <typename key_type, typename mapped_type>
 void methodIteratorAssignmentConst(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::const_iterator it1 =
+  typename test_map<key_type, mapped_type>::const_iterator it1 =
       s21_map.begin();
   typename std::map<key_type, mapped_type>::const_iterator it2 =
       std_map.begin();
 
-  typename s21::map<key_type, mapped_type>::const_iterator it3 = it1;
+  typename test_map<key_type, mapped_type>::const_iterator it3 = it1;
   typename std::map<key_type, mapped_type>::const_iterator it4 = it2;
 
   EXPECT_EQ((*it1).second, (*it3).second);
@@ -967,15 +984,15 @@ template <typename key_type, typename mapped_type>
 void methodIteratorEqualConst(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::const_iterator it1 =
+  typename test_map<key_type, mapped_type>::const_iterator it1 =
       s21_map.begin();
   typename std::map<key_type, mapped_type>::const_iterator it2 =
       std_map.begin();
 
-  typename s21::map<key_type, mapped_type>::const_iterator it3 =
+  typename test_map<key_type, mapped_type>::const_iterator it3 =
       s21_map.begin();
   typename std::map<key_type, mapped_type>::const_iterator it4 =
       std_map.begin();
@@ -1005,10 +1022,10 @@ template <typename key_type, typename mapped_type>
 void methodIteratorNotEqualConst(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  typename s21::map<key_type, mapped_type>::const_iterator it1 =
+  typename test_map<key_type, mapped_type>::const_iterator it1 =
       s21_map.begin();
   typename std::map<key_type, mapped_type>::const_iterator it2 =
       std_map.begin();
@@ -1038,10 +1055,10 @@ template <typename key_type, typename mapped_type>
 void methodInsertNoDuplicate(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const std::pair<key_type, mapped_type>& pair) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  std::pair<typename s21::map<key_type, mapped_type>::iterator, bool> it1 =
+  std::pair<typename test_map<key_type, mapped_type>::iterator, bool> it1 =
       s21_map.insert(pair);
   std::pair<typename std::map<key_type, mapped_type>::iterator, bool> it2 =
       std_map.insert(pair);
@@ -1074,10 +1091,10 @@ template <typename key_type, typename mapped_type>
 void methodInsertDuplicate(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const std::pair<key_type, mapped_type>& pair) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  std::pair<typename s21::map<key_type, mapped_type>::iterator, bool> it1 =
+  std::pair<typename test_map<key_type, mapped_type>::iterator, bool> it1 =
       s21_map.insert(pair);
   std::pair<typename std::map<key_type, mapped_type>::iterator, bool> it2 =
       std_map.insert(pair);
@@ -1111,10 +1128,10 @@ void methodInsertKeyNoDuplicate(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const key_type& key, const mapped_type& obj,
     const std::pair<key_type, mapped_type>& pair) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  std::pair<typename s21::map<key_type, mapped_type>::iterator, bool> it1 =
+  std::pair<typename test_map<key_type, mapped_type>::iterator, bool> it1 =
       s21_map.insert(key, obj);
   std::pair<typename std::map<key_type, mapped_type>::iterator, bool> it2 =
       std_map.insert(pair);
@@ -1152,10 +1169,10 @@ void methodInsertKeyDuplicate(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const key_type& key, const mapped_type& obj,
     const std::pair<key_type, mapped_type>& pair) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  std::pair<typename s21::map<key_type, mapped_type>::iterator, bool> it1 =
+  std::pair<typename test_map<key_type, mapped_type>::iterator, bool> it1 =
       s21_map.insert(key, obj);
   std::pair<typename std::map<key_type, mapped_type>::iterator, bool> it2 =
       std_map.insert(pair);
@@ -1193,10 +1210,10 @@ void methodInsertOrAssignNoDuplicate(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const key_type& key, const mapped_type& obj,
     const std::pair<key_type, mapped_type>& pair) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  std::pair<typename s21::map<key_type, mapped_type>::iterator, bool> it1 =
+  std::pair<typename test_map<key_type, mapped_type>::iterator, bool> it1 =
       s21_map.insert_or_assign(key, obj);
   std::pair<typename std::map<key_type, mapped_type>::iterator, bool> it2 =
       std_map.insert(pair);
@@ -1234,10 +1251,10 @@ void methodInsertOrAssignDuplicate(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const key_type& key, const mapped_type& obj,
     const std::pair<key_type, mapped_type>& pair) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
-  std::pair<typename s21::map<key_type, mapped_type>::iterator, bool> it1 =
+  std::pair<typename test_map<key_type, mapped_type>::iterator, bool> it1 =
       s21_map.insert_or_assign(key, obj);
   std::pair<typename std::map<key_type, mapped_type>::iterator, bool> it2 =
       std_map.insert(pair);
@@ -1274,7 +1291,7 @@ template <typename key_type, typename mapped_type>
 void methodAt(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const key_type& key) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
   EXPECT_EQ(s21_map.at(key), std_map.at(key));
@@ -1302,7 +1319,7 @@ template <typename key_type, typename mapped_type>
 void methodErase(
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
   s21_map.erase(s21_map.begin());
@@ -1336,7 +1353,7 @@ template <typename key_type, typename mapped_type>
 void methodContains(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const key_type& key, const key_type& key_duplicate) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
 
   ASSERT_FALSE(s21_map.contains(key));
   ASSERT_TRUE(s21_map.contains(key_duplicate));
@@ -1367,7 +1384,7 @@ void methodInsertMany(
     const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
     const std::initializer_list<std::pair<const key_type, mapped_type>>&
         insert_items) {
-  s21::map<key_type, mapped_type> s21_map(items);
+  test_map<key_type, mapped_type> s21_map(items);
   std::map<key_type, mapped_type> std_map(items);
 
   s21_map.insert_many(*insert_items.begin(), *(insert_items.begin() + 1),
@@ -1396,3 +1413,684 @@ void methodInsertMany(
   }
 
 TESTS_INSERT_MANY(s21Map)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodReserve(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>&
+        items) {
+  test_map<key_type, mapped_type> s21_map;
+  std::map<key_type, mapped_type> std_map(items);
+
+  s21_map.reserve(items.size());
+  auto pool = s21_map.get_node_pool();
+  const auto capacity = pool->capacity();
+#ifdef S21_NODE_BASED_TREE
+  EXPECT_GE(pool->available(), items.size());
+#endif
+
+  for (const auto& item : items) s21_map.insert(item);
+
+  EXPECT_EQ(pool->capacity(), capacity);
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_RESERVE(suiteName)                                               \
+  TEST(suiteName, intMethodReserve) { methodReserve<int, int>(DEF_INT_KEYS); } \
+  TEST(suiteName, doubleMethodReserve) {                                       \
+    methodReserve<double, int>(DEF_DBL_KEYS);                                  \
+  }                                                                            \
+  TEST(suiteName, mockClassMethodReserve) {                                    \
+    methodReserve<MockClass, int>(DEF_MOCK_KEYS);                              \
+  }                                                                            \
+  TEST(suiteName, stringMethodReserve) {                                       \
+    methodReserve<std::string, int>(DEF_STR_KEYS);                             \
+  }
+
+TESTS_RESERVE(s21Map)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodSharedNodePool(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
+    const std::initializer_list<std::pair<const key_type, mapped_type>>&
+        insert_items) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items);
+
+  {
+    test_map<key_type, mapped_type> s21_map_shared(s21_map.get_node_pool());
+    for (const auto& item : insert_items) s21_map_shared.insert(item);
+    EXPECT_EQ(s21_map_shared.get_node_pool(), s21_map.get_node_pool());
+
+    s21_map_shared.erase(s21_map_shared.begin());
+    EXPECT_EQ(s21_map_shared.size(), insert_items.size() - 1);
+  }
+
+  s21_map.erase(s21_map.begin());
+  std_map.erase(std_map.begin());
+  for (const auto& item : insert_items) {
+    s21_map.insert(item);
+    std_map.insert(item);
+  }
+
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_SHARED_NODE_POOL(suiteName)                                    \
+  TEST(suiteName, intSharedNodePool) {                                       \
+    methodSharedNodePool<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_NO_DUBLICATE); \
+  }                                                                          \
+  TEST(suiteName, doubleSharedNodePool) {                                    \
+    methodSharedNodePool<double, int>(DEF_DBL_KEYS,                          \
+                                      DEF_DBL_KEYS_NO_DUBLICATE);            \
+  }                                                                          \
+  TEST(suiteName, mockClassSharedNodePool) {                                 \
+    methodSharedNodePool<MockClass, int>(DEF_MOCK_KEYS,                      \
+                                         DEF_MOCK_KEYS_NO_DUBLICATE);        \
+  }                                                                          \
+  TEST(suiteName, stringSharedNodePool) {                                    \
+    methodSharedNodePool<std::string, int>(DEF_STR_KEYS,                     \
+                                           DEF_STR_KEYS_NO_DUBLICATE);       \
+  }
+
+TESTS_SHARED_NODE_POOL(s21Map)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodInsertHint(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
+    const std::initializer_list<std::pair<const key_type, mapped_type>>&
+        insert_items) {
+  std::map<key_type, mapped_type> std_map(items);
+  test_map<key_type, mapped_type> s21_sorted;
+  test_map<key_type, mapped_type> s21_reversed;
+
+  for (auto it = std_map.begin(); it != std_map.end(); ++it)
+    s21_sorted.insert(s21_sorted.end(), *it);
+  for (auto it = std_map.rbegin(); it != std_map.rend(); ++it)
+    s21_reversed.insert(s21_reversed.begin(), *it);
+
+  checkFields(s21_sorted, std_map);
+  checkFields(s21_reversed, std_map);
+
+  for (const auto& item : insert_items) {
+    s21_sorted.insert(s21_sorted.begin(), item);
+    s21_reversed.insert(s21_reversed.end(), item);
+    std_map.insert(item);
+  }
+
+  checkFields(s21_sorted, std_map);
+  checkFields(s21_reversed, std_map);
+
+  auto hint = ++s21_sorted.begin();
+  auto res = s21_sorted.insert(hint, *hint);
+  EXPECT_TRUE(res == hint);
+  checkFields(s21_sorted, std_map);
+}
+
+#define TESTS_INSERT_HINT(suiteName)                                          \
+  TEST(suiteName, intInsertHint) {                                            \
+    methodInsertHint<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                           \
+  TEST(suiteName, doubleInsertHint) {                                         \
+    methodInsertHint<double, int>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                           \
+  TEST(suiteName, mockClassInsertHint) {                                      \
+    methodInsertHint<MockClass, int>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                           \
+  TEST(suiteName, stringInsertHint) {                                         \
+    methodInsertHint<std::string, int>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_INSERT_HINT(s21Map)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodEmplaceHint(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>&
+        items) {
+  std::map<key_type, mapped_type> std_map(items);
+  test_map<key_type, mapped_type> s21_map;
+
+  for (const auto& item : std_map) {
+    auto it = s21_map.emplace_hint(s21_map.end(), item.first, item.second);
+    EXPECT_EQ((*it).first, item.first);
+  }
+
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_EMPLACE_HINT(suiteName)                  \
+  TEST(suiteName, intEmplaceHint) {                    \
+    methodEmplaceHint<int, int>(DEF_INT_KEYS);         \
+  }                                                    \
+  TEST(suiteName, doubleEmplaceHint) {                 \
+    methodEmplaceHint<double, int>(DEF_DBL_KEYS);      \
+  }                                                    \
+  TEST(suiteName, mockClassEmplaceHint) {              \
+    methodEmplaceHint<MockClass, int>(DEF_MOCK_KEYS);  \
+  }                                                    \
+  TEST(suiteName, stringEmplaceHint) {                 \
+    methodEmplaceHint<std::string, int>(DEF_STR_KEYS); \
+  }
+
+TESTS_EMPLACE_HINT(s21Map)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodAssignSorted(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
+    const std::initializer_list<std::pair<const key_type, mapped_type>>&
+        insert_items) {
+  std::map<key_type, mapped_type> std_map(items);
+  s21::vector<std::pair<key_type, mapped_type>> sorted;
+  for (const auto& item : std_map) sorted.push_back(item);
+  sorted.push_back(*std_map.rbegin());
+
+  test_map<key_type, mapped_type> s21_map(sorted.begin(), sorted.end(),
+                                          s21::sorted_tag);
+  checkFields(s21_map, std_map);
+
+  for (const auto& item : insert_items) {
+    s21_map.insert(item);
+    std_map.insert(item);
+  }
+  s21_map.erase(s21_map.begin());
+  std_map.erase(std_map.begin());
+  checkFields(s21_map, std_map);
+
+  s21_map.assign(items.begin(), items.end(), s21::sorted_tag);
+  checkFields(s21_map, std::map<key_type, mapped_type>(items));
+}
+
+#define TESTS_ASSIGN_SORTED(suiteName)                                     \
+  TEST(suiteName, intAssignSorted) {                                       \
+    methodAssignSorted<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);    \
+  }                                                                        \
+  TEST(suiteName, doubleAssignSorted) {                                    \
+    methodAssignSorted<double, int>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE); \
+  }                                                                        \
+  TEST(suiteName, mockClassAssignSorted) {                                 \
+    methodAssignSorted<MockClass, int>(DEF_MOCK_KEYS,                      \
+                                       DEF_MOCK_KEYS_DUBLICATE);           \
+  }                                                                        \
+  TEST(suiteName, stringAssignSorted) {                                    \
+    methodAssignSorted<std::string, int>(DEF_STR_KEYS,                     \
+                                         DEF_STR_KEYS_DUBLICATE);          \
+  }
+
+TESTS_ASSIGN_SORTED(s21Map)
+
+// -------------------------------------------------
+
+void mapBigAssignSorted(int maxSize) {
+  for (int size = 0; size <= maxSize; size++) {
+    s21::vector<std::pair<int, int>> sorted;
+    std::map<int, int> std_map;
+    for (int i = 0; i < size; i++) {
+      sorted.push_back(std::make_pair(i, i * 2));
+      std_map.insert(std::make_pair(i, i * 2));
+    }
+
+    test_map<int, int> s21_map;
+    s21_map.assign(sorted.begin(), sorted.end(), s21::sorted_tag);
+    checkFields(s21_map, std_map);
+
+    for (int i = 0; i < size / 3; i++) {
+      s21_map.erase(s21_map.begin());
+      std_map.erase(std_map.begin());
+      s21_map.erase(--s21_map.end());
+      std_map.erase(--std_map.end());
+    }
+    for (int i = size; i < 2 * size; i += 2) {
+      s21_map.insert(std::make_pair(i, i));
+      std_map.insert(std::make_pair(i, i));
+    }
+    checkFields(s21_map, std_map);
+  }
+}
+
+TEST(s21Map, intBigAssignSorted) { mapBigAssignSorted(200); }
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodLowerBound(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
+    const key_type& key, const key_type& key_duplicate) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items);
+
+  EXPECT_EQ(s21_map.lower_bound(key) == s21_map.end(),
+            std_map.lower_bound(key) == std_map.end());
+  EXPECT_EQ(*s21_map.lower_bound(key_duplicate),
+            *std_map.lower_bound(key_duplicate));
+
+  for (const auto& item : std_map) {
+    EXPECT_EQ(std::distance(s21_map.begin(), s21_map.lower_bound(item.first)),
+              std::distance(std_map.begin(), std_map.lower_bound(item.first)));
+  }
+}
+
+#define TESTS_LOWER_BOUND(suiteName)                                         \
+  TEST(suiteName, intMethodLowerBound) {                                     \
+    methodLowerBound<int, int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                          \
+  TEST(suiteName, doubleMethodLowerBound) {                                  \
+    methodLowerBound<double, int>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                          \
+  TEST(suiteName, mockClassMethodLowerBound) {                               \
+    methodLowerBound<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                     MOCK_KEY_DUPLICATE);                    \
+  }                                                                          \
+  TEST(suiteName, stringMethodLowerBound) {                                  \
+    methodLowerBound<std::string, int>(DEF_STR_KEYS, STR_KEY,                \
+                                       STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_LOWER_BOUND(s21Map)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodUpperBound(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
+    const key_type& key, const key_type& key_duplicate) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items);
+
+  EXPECT_EQ(s21_map.upper_bound(key) == s21_map.end(),
+            std_map.upper_bound(key) == std_map.end());
+  EXPECT_EQ(*(--s21_map.upper_bound(key_duplicate)),
+            *(--std_map.upper_bound(key_duplicate)));
+
+  for (const auto& item : std_map) {
+    EXPECT_EQ(std::distance(s21_map.begin(), s21_map.upper_bound(item.first)),
+              std::distance(std_map.begin(), std_map.upper_bound(item.first)));
+  }
+}
+
+#define TESTS_UPPER_BOUND(suiteName)                                         \
+  TEST(suiteName, intMethodUpperBound) {                                     \
+    methodUpperBound<int, int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                          \
+  TEST(suiteName, doubleMethodUpperBound) {                                  \
+    methodUpperBound<double, int>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                          \
+  TEST(suiteName, mockClassMethodUpperBound) {                               \
+    methodUpperBound<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                     MOCK_KEY_DUPLICATE);                    \
+  }                                                                          \
+  TEST(suiteName, stringMethodUpperBound) {                                  \
+    methodUpperBound<std::string, int>(DEF_STR_KEYS, STR_KEY,                \
+                                       STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_UPPER_BOUND(s21Map)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodEqualRange(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
+    const key_type& key, const key_type& key_duplicate) {
+  test_map<key_type, mapped_type> s21_map(items);
+
+  EXPECT_TRUE(s21_map.equal_range(key).first == s21_map.lower_bound(key));
+  EXPECT_TRUE(s21_map.equal_range(key).second == s21_map.upper_bound(key));
+  EXPECT_TRUE(s21_map.equal_range(key).first ==
+              s21_map.equal_range(key).second);
+
+  auto range = s21_map.equal_range(key_duplicate);
+  EXPECT_EQ((*range.first).first, key_duplicate);
+  EXPECT_TRUE(++range.first == range.second);
+}
+
+#define TESTS_EQUAL_RANGE(suiteName)                                         \
+  TEST(suiteName, intMethodEqualRange) {                                     \
+    methodEqualRange<int, int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                          \
+  TEST(suiteName, doubleMethodEqualRange) {                                  \
+    methodEqualRange<double, int>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                          \
+  TEST(suiteName, mockClassMethodEqualRange) {                               \
+    methodEqualRange<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                     MOCK_KEY_DUPLICATE);                    \
+  }                                                                          \
+  TEST(suiteName, stringMethodEqualRange) {                                  \
+    methodEqualRange<std::string, int>(DEF_STR_KEYS, STR_KEY,                \
+                                       STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_EQUAL_RANGE(s21Map)
+
+// -------------------------------------------------
+
+void mapBigBounds(int maxSize) {
+  test_map<int, int> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < maxSize; i += 2) {
+    s21_map.insert(i, i);
+    std_map.insert(std::make_pair(i, i));
+  }
+
+  for (int key = -1; key <= maxSize; key++) {
+    EXPECT_EQ(std::distance(s21_map.begin(), s21_map.lower_bound(key)),
+              std::distance(std_map.begin(), std_map.lower_bound(key)));
+    EXPECT_EQ(std::distance(s21_map.begin(), s21_map.upper_bound(key)),
+              std::distance(std_map.begin(), std_map.upper_bound(key)));
+    auto range = s21_map.equal_range(key);
+    EXPECT_EQ(std::distance(range.first, range.second),
+              static_cast<std::ptrdiff_t>(std_map.count(key)));
+  }
+}
+
+TEST(s21Map, intBigBounds) { mapBigBounds(500); }
+
+// -------------------------------------------------
+
+void mapBigOrderStatistic(int maxSize) {
+  s21::map<int, int, std::less<int>, s21::order_statistic_policy> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < maxSize; i++) {
+    s21_map.insert(i * 37 % maxSize, i);
+    std_map.insert(std::make_pair(i * 37 % maxSize, i));
+  }
+  for (int i = 0; i < maxSize; i += 3) {
+    s21_map.erase(s21_map.lower_bound(i * 11 % maxSize));
+    std_map.erase(i * 11 % maxSize);
+  }
+  checkFields(s21_map, std_map);
+
+  std::size_t index = 0;
+  for (auto item : std_map) {
+    EXPECT_EQ((*s21_map.nth(index)).first, item.first);
+    EXPECT_EQ((*s21_map.nth(index)).second, item.second);
+    EXPECT_EQ(s21_map.rank(item.first), index);
+    EXPECT_EQ(s21_map.distance(s21_map.lower_bound(item.first), s21_map.end()),
+              static_cast<std::ptrdiff_t>(std_map.size() - index));
+    index++;
+  }
+  EXPECT_TRUE(s21_map.nth(index) == s21_map.end());
+  EXPECT_EQ(s21_map.rank(-1), 0U);
+}
+
+TEST(s21Map, intBigOrderStatistic) { mapBigOrderStatistic(500); }
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodCustomCompare(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
+    const std::initializer_list<std::pair<const key_type, mapped_type>>&
+        insert_items) {
+  test_map<key_type, mapped_type, std::greater<key_type>> s21_map(items);
+  std::map<key_type, mapped_type, std::greater<key_type>> std_map(items);
+  for (const auto& item : insert_items) {
+    s21_map.insert(item);
+    std_map.insert(item);
+  }
+  checkFields(s21_map, std_map);
+
+  for (const auto& item : std_map) {
+    EXPECT_TRUE(s21_map.contains(item.first));
+    EXPECT_EQ(s21_map.at(item.first), item.second);
+    EXPECT_EQ(std::distance(s21_map.begin(), s21_map.lower_bound(item.first)),
+              std::distance(std_map.begin(), std_map.lower_bound(item.first)));
+  }
+  s21_map.erase(s21_map.begin());
+  std_map.erase(std_map.begin());
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_CUSTOM_COMPARE(suiteName)                                  \
+  TEST(suiteName, intCustomCompare) {                                    \
+    methodCustomCompare<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE); \
+  }                                                                      \
+  TEST(suiteName, doubleCustomCompare) {                                 \
+    methodCustomCompare<double, int>(DEF_DBL_KEYS,                       \
+                                     DEF_DBL_KEYS_DUBLICATE);            \
+  }                                                                      \
+  TEST(suiteName, mockClassCustomCompare) {                              \
+    methodCustomCompare<MockClass, int>(DEF_MOCK_KEYS,                   \
+                                        DEF_MOCK_KEYS_DUBLICATE);        \
+  }                                                                      \
+  TEST(suiteName, stringCustomCompare) {                                 \
+    methodCustomCompare<std::string, int>(DEF_STR_KEYS,                  \
+                                          DEF_STR_KEYS_DUBLICATE);       \
+  }
+
+TESTS_CUSTOM_COMPARE(s21Map)
+
+// -------------------------------------------------
+
+TEST(s21Map, stringTransparentLookup) {
+  test_map<std::string, int, std::less<>> s21_map(DEF_STR_KEYS);
+  std::map<std::string, int, std::less<>> std_map(DEF_STR_KEYS);
+
+  for (const auto& item : std_map) {
+    std::string_view key(item.first);
+    EXPECT_TRUE(s21_map.contains(key));
+    EXPECT_EQ(*s21_map.lower_bound(key), *std_map.lower_bound(key));
+  }
+  EXPECT_FALSE(s21_map.contains(std::string_view("absent")));
+  EXPECT_TRUE(s21_map.contains("mock"));
+  EXPECT_EQ((*s21_map.lower_bound("i")).first, "mock");
+}
+
+// -------------------------------------------------
+
+#ifdef S21_NODE_BASED_TREE
+TEST(s21Map, copyCounterEmplaceWithoutCopies) {
+  using value_type = test_map<int, CopyCounter>::value_type;
+  test_map<int, CopyCounter> s21_map;
+  CopyCounter::reset();
+
+  EXPECT_TRUE(s21_map.emplace(1, 10).second);
+  EXPECT_FALSE(s21_map.emplace(1, 11).second);
+  EXPECT_TRUE(s21_map.try_emplace(2, 20).second);
+  EXPECT_EQ(CopyCounter::moves, 0);
+
+  CopyCounter unused(21);
+  EXPECT_FALSE(s21_map.try_emplace(2, std::move(unused)).second);
+  EXPECT_EQ(CopyCounter::moves, 0);
+
+  EXPECT_EQ(s21_map[3].value(), 0);
+  s21_map[3] = CopyCounter(30);
+  EXPECT_TRUE(s21_map.insert(value_type(4, 40)).second);
+  s21_map.insert(s21_map.end(), value_type(5, 50));
+  s21_map.emplace_hint(s21_map.end(), 6, 60);
+  s21_map.insert_many(value_type(7, 70), value_type(8, 80));
+  s21_map.insert_or_assign(8, 81);
+
+  EXPECT_EQ(CopyCounter::copies, 1);
+  EXPECT_EQ(s21_map.size(), 8U);
+  EXPECT_EQ(s21_map.at(2).value(), 20);
+  EXPECT_EQ(s21_map.at(3).value(), 30);
+  EXPECT_EQ(s21_map.at(8).value(), 81);
+}
+#endif
+
+TEST(s21Map, copyCounterKeyMovedIn) {
+  test_map<CopyCounter, int> s21_map;
+  CopyCounter::reset();
+
+  s21_map.try_emplace(CopyCounter(1), 10);
+  s21_map[CopyCounter(2)] = 20;
+  EXPECT_EQ(CopyCounter::moves, 2);
+
+  s21_map[CopyCounter(2)] = 21;
+  s21_map.try_emplace(CopyCounter(1), 11);
+  EXPECT_EQ(CopyCounter::moves, 2);
+  EXPECT_EQ(CopyCounter::copies, 0);
+
+  test_map<CopyCounter, int> copy(s21_map);
+  EXPECT_EQ(CopyCounter::copies, 2);
+  EXPECT_EQ(copy.at(CopyCounter(1)), 10);
+  EXPECT_EQ(copy.at(CopyCounter(2)), 21);
+}
+
+TEST(s21Map, vectorPayloadMovedIn) {
+  test_map<int, s21::vector<char>> s21_map;
+  s21::vector<char> first(4096);
+  s21::vector<char> second(4096);
+  s21::vector<char> third(4096);
+  const char* firstData = first.data();
+  const char* secondData = second.data();
+  const char* thirdData = third.data();
+
+  s21_map.try_emplace(1, std::move(first));
+  s21_map.insert(std::make_pair(2, std::move(second)));
+  s21_map.emplace(3, std::move(third));
+
+  EXPECT_EQ(s21_map.at(1).data(), firstData);
+  EXPECT_EQ(s21_map.at(2).data(), secondData);
+  EXPECT_EQ(s21_map.at(3).data(), thirdData);
+  EXPECT_EQ(s21_map.at(1).size(), 4096U);
+}
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodExtract(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>&
+        items) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std::map<key_type, mapped_type> std_map(items);
+  test_map<key_type, mapped_type> s21_copy(s21_map);
+
+  auto s21_first = s21_map.extract(s21_map.begin());
+  auto std_first = std_map.extract(std_map.begin());
+  EXPECT_EQ(s21_first.key(), std_first.key());
+  EXPECT_EQ(s21_first.mapped(), std_first.mapped());
+  checkFields(s21_map, std_map);
+
+  key_type last = std_map.rbegin()->first;
+  auto s21_last = s21_map.extract(last);
+  auto std_last = std_map.extract(last);
+  EXPECT_EQ(s21_last.key(), std_last.key());
+  EXPECT_EQ(s21_last.mapped(), std_last.mapped());
+  EXPECT_TRUE(s21_map.extract(last).empty());
+  checkFields(s21_map, std_map);
+
+  // The key is already there, so the node stays in the handle
+  EXPECT_FALSE(s21_copy.insert(std::move(s21_last)).second);
+  EXPECT_FALSE(s21_last.empty());
+
+  s21_first.mapped() = std_first.mapped() = mapped_type();
+  EXPECT_TRUE(s21_map.insert(std::move(s21_first)).second);
+  EXPECT_TRUE(s21_first.empty());
+  EXPECT_TRUE(s21_map.insert(std::move(s21_last)).second);
+  std_map.insert(std::move(std_first));
+  std_map.insert(std::move(std_last));
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_EXTRACT(suiteName)                                         \
+  TEST(suiteName, intExtract) { methodExtract<int, int>(DEF_INT_KEYS); } \
+  TEST(suiteName, doubleExtract) {                                       \
+    methodExtract<double, int>(DEF_DBL_KEYS);                            \
+  }                                                                      \
+  TEST(suiteName, mockClassExtract) {                                    \
+    methodExtract<MockClass, int>(DEF_MOCK_KEYS);                        \
+  }                                                                      \
+  TEST(suiteName, stringExtract) {                                       \
+    methodExtract<std::string, int>(DEF_STR_KEYS);                       \
+  }
+
+TESTS_EXTRACT(s21Map)
+
+// -------------------------------------------------
+
+#ifdef S21_NODE_BASED_TREE
+// The maps were given one pool, so the nodes are relinked as they are
+TEST(s21Map, copyCounterMergeSplicesNodes) {
+  test_map<int, CopyCounter> s21_map;
+  test_map<int, CopyCounter> s21_other(s21_map.get_node_pool());
+  for (int key : {1, 3, 5}) s21_map.emplace(key, key * 10);
+  for (int key : {2, 3, 4}) s21_other.emplace(key, key * 100);
+  const CopyCounter* two = &s21_other.at(2);
+  CopyCounter::reset();
+
+  s21_map.merge(s21_other);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(CopyCounter::moves, 0);
+  EXPECT_EQ(s21_map.size(), 5U);
+  EXPECT_EQ(s21_other.size(), 1U);
+  EXPECT_EQ(s21_map.at(3).value(), 30);
+  EXPECT_EQ(s21_other.at(3).value(), 300);
+  EXPECT_EQ(&s21_map.at(2), two);
+}
+
+// Each map keeps its own pool, the pairs are moved into new nodes
+TEST(s21Map, copyCounterMergeKeepsPoolsApart) {
+  test_map<int, CopyCounter> s21_map;
+  test_map<int, CopyCounter> s21_other;
+  for (int key : {1, 3, 5}) s21_map.emplace(key, key * 10);
+  for (int key : {2, 3, 4}) s21_other.emplace(key, key * 100);
+  CopyCounter::reset();
+
+  s21_map.merge(s21_other);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(CopyCounter::moves, 2);
+  EXPECT_EQ(s21_map.size(), 5U);
+  EXPECT_EQ(s21_other.size(), 1U);
+  EXPECT_EQ(s21_map.at(2).value(), 200);
+  EXPECT_NE(s21_map.get_node_pool(), s21_other.get_node_pool());
+
+  auto extracted = s21_map.extract(2);
+  EXPECT_TRUE(s21_other.insert(std::move(extracted)).second);
+  EXPECT_NE(s21_map.get_node_pool(), s21_other.get_node_pool());
+  EXPECT_EQ(s21_other.at(2).value(), 200);
+}
+#endif
+
+// Both pools are used by further maps, so the pairs are moved into new nodes
+TEST(s21Map, stringMergeSharedPools) {
+  test_map<std::string, int> s21_map(DEF_STR_KEYS);
+  test_map<std::string, int> s21_other(DEF_STR_KEYS_DUBLICATE);
+  test_map<std::string, int> s21_map_neighbour(s21_map.get_node_pool());
+  test_map<std::string, int> s21_other_neighbour(s21_other.get_node_pool());
+  std::map<std::string, int> std_map(DEF_STR_KEYS);
+  std::map<std::string, int> std_other(DEF_STR_KEYS_DUBLICATE);
+
+  s21_map.merge(s21_other);
+  std_map.merge(std_other);
+  checkFields(s21_map, std_map);
+  checkFields(s21_other, std_other);
+  EXPECT_NE(s21_map.get_node_pool(), s21_other.get_node_pool());
+  EXPECT_EQ(s21_map_neighbour.size(), 0U);
+}
+
+// -------------------------------------------------
+
+TEST(s21Map, intBigThreaded) {
+  const int maxSize = 500;
+  s21::map<int, int, std::less<int>, s21::threaded_tree_policy> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < maxSize; i++) {
+    s21_map[i * 37 % maxSize] = i;
+    std_map[i * 37 % maxSize] = i;
+  }
+  for (int i = 0; i < maxSize; i += 3) {
+    s21_map.erase(s21_map.lower_bound(i * 11 % maxSize));
+    std_map.erase(i * 11 % maxSize);
+  }
+  checkFields(s21_map, std_map);
+
+  auto std_it = std_map.rbegin();
+  for (auto it = s21_map.end(); it != s21_map.begin(); ++std_it) {
+    --it;
+    EXPECT_EQ((*it).first, std_it->first);
+    EXPECT_EQ((*it).second, std_it->second);
+  }
+  EXPECT_TRUE(std_it == std_map.rend());
+}
+
+}  // namespace
@@ -0,0 +1,35 @@
+// The s21Multiset suites again, as s21MultisetBTree, against the B-tree backend
+#include <array>
+#include <random>
+
+#define S21_TREE_POLICY s21::btree_policy<>
+#define s21Multiset s21MultisetBTree
+
+#include "s21_multiset_test.cpp"
+
+// 80-byte keys leave 3 of them to a 256-byte node, so runs of equal keys
+// span many nodes
+using WideKey = std::array<int, 20>;
+
+TEST(s21MultisetBTree, wideKeyRandomInsertEraseKey) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 100);
+  s21::multiset<WideKey, std::less<WideKey>, s21::btree_policy<>>
+      s21_multiset;
+  std::multiset<WideKey> std_multiset;
+
+  for (int i = 0; i < 4000; ++i) {
+    WideKey item{key(gen)};
+    if (i % 3 == 2) {
+      EXPECT_EQ(s21_multiset.count(item), std_multiset.count(item));
+      EXPECT_EQ(s21_multiset.erase(item), std_multiset.erase(item));
+    } else if (i % 3 == 1) {
+      s21_multiset.insert(s21_multiset.upper_bound(item), item);
+      std_multiset.insert(item);
+    } else {
+      s21_multiset.insert(item);
+      std_multiset.insert(item);
+    }
+  }
+  multiCheckFields(s21_multiset, std_multiset);
+}
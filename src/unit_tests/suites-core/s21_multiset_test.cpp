@@ -1,9 +1,24 @@
 #include "core/s21_multiset.h"
 
+#include <algorithm>
+#include <iterator>
 #include <set>
+#include <string_view>
 
 #include "s21_core_tests.h"
 
+// s21_multiset_btree_test.cpp builds this file again with S21_TREE_POLICY set
+// to the B-tree backend. Tests of node-based behaviour are left out there.
+#ifndef S21_TREE_POLICY
+#define S21_TREE_POLICY s21::default_tree_policy
+#define S21_NODE_BASED_TREE
+#endif
+
+namespace {
+
+template <typename K, typename C = std::less<K>>
+using test_multiset = s21::multiset<K, C, S21_TREE_POLICY>;
+
 #define DEF_INT_KEYS \
   { 1, 2, 3, 4, 8, 3, 4, 4 }
 #define DEF_DBL_KEYS \
@@ -41,9 +56,10 @@
 #define MOCK_KEY_DUPLICATE 1
 #define STR_KEY_DUPLICATE "!"
 
-template <typename key_type>
-void multiCheckFields(const s21::multiset<key_type>& s21_multiset,
-                      const std::multiset<key_type>& std_multiset) {
+template <typename key_type, typename compare_type, typename policy_type>
+void multiCheckFields(
+    const s21::multiset<key_type, compare_type, policy_type>& s21_multiset,
+    const std::multiset<key_type, compare_type>& std_multiset) {
   auto std_it = std_multiset.begin();
   for (auto s21_it : s21_multiset) {
     EXPECT_EQ(s21_it, *std_it);
@@ -54,7 +70,7 @@ void multiCheckFields(const s21::multiset<key_type>& s21_multiset,
 }
 
 template <typename key_type>
-void multiCheckFieldsEmpty(const s21::multiset<key_type>& s21_multiset,
+void multiCheckFieldsEmpty(const test_multiset<key_type>& s21_multiset,
                            const std::multiset<key_type>& std_multiset) {
   auto std_it = std_multiset.begin();
   for (auto s21_it : s21_multiset) {
@@ -72,7 +88,7 @@ void multiCheckFieldsEmpty(const s21::multiset<key_type>& s21_multiset,
 
 template <typename key_type>
 void multiConstructorDefaultAsCont() {
-  s21::IContainer* ct = new s21::multiset<key_type>();
+  s21::IContainer* ct = new test_multiset<key_type>();
 
   EXPECT_EQ(ct->size(), 0);
   EXPECT_TRUE(ct->empty());
@@ -98,7 +114,7 @@ TESTS_CONSTRUCTOR_INIT_AS_CONT(s21Multiset)
 
 template <typename key_type>
 void multiConstructorDefault() {
-  s21::multiset<key_type> s21_multiset;
+  test_multiset<key_type> s21_multiset;
   std::multiset<key_type> std_multiset;
 
   multiCheckFieldsEmpty(s21_multiset, std_multiset);
@@ -116,7 +132,7 @@ TESTS_DEFAULT_CONSTRUCTOR_INIT(s21Multiset)
 
 template <typename key_type>
 void multiConstructorInitList(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
   multiCheckFields(s21_multiset, std_multiset);
@@ -142,10 +158,10 @@ TESTS_CONSTRUCTOR_INIT_LIST(s21Multiset)
 
 template <typename key_type>
 void multiConstructorCopyEmpty() {
-  s21::multiset<key_type> s21_multiset;
+  test_multiset<key_type> s21_multiset;
   std::multiset<key_type> std_multiset;
 
-  s21::multiset<key_type> s21_map_copy(s21_multiset);
+  test_multiset<key_type> s21_map_copy(s21_multiset);
   std::multiset<key_type> std_map_copy(std_multiset);
 
   multiCheckFields(s21_map_copy, std_map_copy);
@@ -165,10 +181,10 @@ TESTS_CONSTRUCTOR_COPY_EMPTY(s21Multiset)
 
 template <typename key_type>
 void multiConstructorCopy(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_copy(s21_multiset);
+  test_multiset<key_type> s21_map_copy(s21_multiset);
   std::multiset<key_type> std_map_copy(std_multiset);
 
   multiCheckFields(s21_map_copy, std_map_copy);
@@ -190,10 +206,10 @@ TESTS_CONSTRUCTOR_COPY(s21Multiset)
 
 template <typename key_type>
 void multiConstructorMoveEmpty() {
-  s21::multiset<key_type> s21_multiset;
+  test_multiset<key_type> s21_multiset;
   std::multiset<key_type> std_multiset;
 
-  s21::multiset<key_type> s21_map_move(std::move(s21_multiset));
+  test_multiset<key_type> s21_map_move(std::move(s21_multiset));
   std::multiset<key_type> std_map_move(std::move(std_multiset));
 
   multiCheckFields(s21_map_move, std_map_move);
@@ -213,10 +229,10 @@ TESTS_CONSTRUCTOR_MOVE_EMPTY(s21Multiset)
 
 template <typename key_type>
 void multiConstructorMove(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_move(std::move(s21_multiset));
+  test_multiset<key_type> s21_map_move(std::move(s21_multiset));
   std::multiset<key_type> std_map_move(std::move(std_multiset));
 
   multiCheckFields(s21_map_move, std_map_move);
@@ -238,10 +254,10 @@ TESTS_CONSTRUCTOR_MOVE(s21Multiset)
 
 template <typename key_type>
 void multiOperatorCopyEmpty() {
-  s21::multiset<key_type> s21_multiset;
+  test_multiset<key_type> s21_multiset;
   std::multiset<key_type> std_multiset;
 
-  s21::multiset<key_type> s21_map_copy = s21_multiset;
+  test_multiset<key_type> s21_map_copy = s21_multiset;
   std::multiset<key_type> std_map_copy = std_multiset;
 
   multiCheckFields(s21_map_copy, std_map_copy);
@@ -265,10 +281,10 @@ TESTS_OPERATOR_COPY_EMPTY(s21Multiset)
 
 template <typename key_type>
 void multiOperatorCopy(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_copy = s21_multiset;
+  test_multiset<key_type> s21_map_copy = s21_multiset;
   std::multiset<key_type> std_map_copy = std_multiset;
 
   multiCheckFields(s21_map_copy, std_map_copy);
@@ -292,10 +308,10 @@ TESTS_OPERATOR_COPY(s21Multiset)
 
 template <typename key_type>
 void multiOperatorMoveEmpty() {
-  s21::multiset<key_type> s21_multiset;
+  test_multiset<key_type> s21_multiset;
   std::multiset<key_type> std_multiset;
 
-  s21::multiset<key_type> s21_map_move = std::move(s21_multiset);
+  test_multiset<key_type> s21_map_move = std::move(s21_multiset);
   std::multiset<key_type> std_map_move = std::move(std_multiset);
 
   multiCheckFields(s21_map_move, std_map_move);
@@ -319,10 +335,10 @@ TESTS_OPERATOR_MOVE_EMPTY(s21Multiset)
 
 template <typename key_type>
 void multiOperatorMove(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_move = std::move(s21_multiset);
+  test_multiset<key_type> s21_map_move = std::move(s21_multiset);
   std::multiset<key_type> std_map_move = std::move(std_multiset);
 
   multiCheckFields(s21_map_move, std_map_move);
@@ -346,10 +362,10 @@ TESTS_OPERATOR_MOVE(s21Multiset)
 
 template <typename key_type>
 void multiMethodEmpty(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_empty;
+  test_multiset<key_type> s21_map_empty;
   std::multiset<key_type> std_map_empty;
 
   EXPECT_EQ(s21_multiset.empty(), std_multiset.empty());
@@ -370,10 +386,10 @@ TESTS_EMPTY(s21Multiset)
 
 template <typename key_type>
 void multiMethodSize(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_empty;
+  test_multiset<key_type> s21_map_empty;
   std::multiset<key_type> std_map_empty;
 
   EXPECT_EQ(s21_multiset.size(), std_multiset.size());
@@ -394,8 +410,8 @@ TESTS_SIZE(s21Multiset)
 
 template <typename key_type>
 void multiMethodSwap(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
-  s21::multiset<key_type> s21_map_empty;
+  test_multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_map_empty;
 
   std::multiset<key_type> std_multiset(items);
 
@@ -420,10 +436,10 @@ template <typename key_type>
 void multiMethodMergeWithDublicates(
     const std::initializer_list<key_type>& items,
     const std::initializer_list<key_type>& itemsDublicates) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_dublicate(itemsDublicates);
+  test_multiset<key_type> s21_map_dublicate(itemsDublicates);
   std::multiset<key_type> std_map_dublicate(itemsDublicates);
 
   multiCheckFields(s21_multiset, std_multiset);
@@ -433,6 +449,7 @@ void multiMethodMergeWithDublicates(
   std_multiset.merge(std_map_dublicate);
 
   multiCheckFields(s21_multiset, std_multiset);
+  multiCheckFields(s21_map_dublicate, std_map_dublicate);
 }
 
 #define TESTS_MERGE_WITH_DUBLICATES(suiteName)                                 \
@@ -460,10 +477,10 @@ template <typename key_type>
 void multiMethodMergeWithNoDublicates(
     const std::initializer_list<key_type>& items,
     const std::initializer_list<key_type>& itemsNoDublicates) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_no_dublicate(itemsNoDublicates);
+  test_multiset<key_type> s21_map_no_dublicate(itemsNoDublicates);
   std::multiset<key_type> std_map_no_dublicate(itemsNoDublicates);
 
   multiCheckFields(s21_multiset, std_multiset);
@@ -473,6 +490,7 @@ void multiMethodMergeWithNoDublicates(
   std_multiset.merge(std_map_no_dublicate);
 
   multiCheckFields(s21_multiset, std_multiset);
+  multiCheckFields(s21_map_no_dublicate, std_map_no_dublicate);
 }
 
 #define TESTS_MERGE_WITH_NO_DUBLICATES(suiteName)                             \
@@ -499,10 +517,10 @@ TESTS_MERGE_WITH_NO_DUBLICATES(s21Multiset)
 
 template <typename key_type>
 void multiMethodClear(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_empty;
+  test_multiset<key_type> s21_map_empty;
   std::multiset<key_type> std_map_empty;
 
   s21_multiset.clear();
@@ -529,18 +547,18 @@ TESTS_CLEAR(s21Multiset)
 
 template <typename key_type>
 void multiMethodBegin(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_empty;
+  test_multiset<key_type> s21_map_empty;
   std::multiset<key_type> std_map_empty;
 
-  typename s21::multiset<key_type>::iterator it1 = s21_map_empty.begin();
+  typename test_multiset<key_type>::iterator it1 = s21_map_empty.begin();
   typename std::multiset<key_type>::iterator it2 = std_map_empty.begin();
 
   EXPECT_EQ(it1 == s21_map_empty.end(), it2 == std_map_empty.end());
 
-  typename s21::multiset<key_type>::iterator it3 = s21_multiset.begin();
+  typename test_multiset<key_type>::iterator it3 = s21_multiset.begin();
   typename std::multiset<key_type>::iterator it4 = std_multiset.begin();
 
   EXPECT_EQ(it3 != s21_multiset.end(), it4 != std_multiset.end());
@@ -561,18 +579,18 @@ TESTS_BEGIN(s21Multiset)
 
 template <typename key_type>
 void multiMethodBeginConst(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  s21::multiset<key_type> s21_map_empty;
+  test_multiset<key_type> s21_map_empty;
   std::multiset<key_type> std_map_empty;
 
-  typename s21::multiset<key_type>::const_iterator it1 = s21_map_empty.begin();
+  typename test_multiset<key_type>::const_iterator it1 = s21_map_empty.begin();
   typename std::multiset<key_type>::const_iterator it2 = std_map_empty.begin();
 
   EXPECT_EQ(it1 == s21_map_empty.end(), it2 == std_map_empty.end());
 
-  typename s21::multiset<key_type>::const_iterator it3 = s21_multiset.begin();
+  typename test_multiset<key_type>::const_iterator it3 = s21_multiset.begin();
   typename std::multiset<key_type>::const_iterator it4 = std_multiset.begin();
 
   EXPECT_EQ(it3 != s21_multiset.end(), it4 != std_multiset.end());
@@ -597,10 +615,10 @@ TESTS_BEGIN_CONST(s21Multiset)
 
 template <typename key_type>
 void multiMethodIteratorPlus(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::iterator it2 = std_multiset.begin();
 
   ++it1;
@@ -634,10 +652,10 @@ TESTS_ITERATOR_PLUS(s21Multiset)
 
 template <typename key_type>
 void multiMethodIteratorMinus(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::iterator it2 = std_multiset.begin();
 
   ++it1;
@@ -672,13 +690,13 @@ TESTS_ITERATOR_MINUS(s21Multiset)
 template <typename key_type>
 void multiMethodIteratorAssignment(
     const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::iterator it2 = std_multiset.begin();
 
-  typename s21::multiset<key_type>::iterator it3 = it1;
+  typename test_multiset<key_type>::iterator it3 = it1;
   typename std::multiset<key_type>::iterator it4 = it2;
 
   EXPECT_EQ(*it1, *it3);
@@ -705,13 +723,13 @@ TESTS_ITERATOR_ASSIGNMENT(s21Multiset)
 
 template <typename key_type>
 void multiMethodIteratorEqual(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::iterator it2 = std_multiset.begin();
 
-  typename s21::multiset<key_type>::iterator it3 = s21_multiset.begin();
+  typename test_multiset<key_type>::iterator it3 = s21_multiset.begin();
   typename std::multiset<key_type>::iterator it4 = std_multiset.begin();
 
   EXPECT_EQ(it1 == it3, it2 == it4);
@@ -737,10 +755,10 @@ TESTS_ITERATOR_EQUAL(s21Multiset)
 
 template <typename key_type>
 void multiMethodIteratorNotEqual(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::iterator it2 = std_multiset.begin();
 
   EXPECT_EQ(it1 != s21_multiset.end(), it2 != std_multiset.end());
@@ -767,10 +785,10 @@ TESTS_ITERATOR_NOT_EQUAL(s21Multiset)
 template <typename key_type>
 void multiMethodIteratorPlusConst(
     const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::const_iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::const_iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::const_iterator it2 = std_multiset.begin();
 
   ++it1;
@@ -805,10 +823,10 @@ TESTS_ITERATOR_PLUS_CONST(s21Multiset)
 template <typename key_type>
 void multiMethodIteratorMinusConst(
     const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::const_iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::const_iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::const_iterator it2 = std_multiset.begin();
 
   ++it1;
@@ -843,13 +861,13 @@ TESTS_ITERATOR_MINUS_CONST(s21Multiset)
 template <typename key_type>
 void multiMethodIteratorAssignmentConst(
     const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::const_iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::const_iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::const_iterator it2 = std_multiset.begin();
 
-  typename s21::multiset<key_type>::const_iterator it3 = it1;
+  typename test_multiset<key_type>::const_iterator it3 = it1;
   typename std::multiset<key_type>::const_iterator it4 = it2;
 
   EXPECT_EQ(*it1, *it3);
@@ -877,13 +895,13 @@ TESTS_ITERATOR_ASSIGNMENT_CONST(s21Multiset)
 template <typename key_type>
 void multiMethodIteratorEqualConst(
     const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::const_iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::const_iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::const_iterator it2 = std_multiset.begin();
 
-  typename s21::multiset<key_type>::const_iterator it3 = s21_multiset.begin();
+  typename test_multiset<key_type>::const_iterator it3 = s21_multiset.begin();
   typename std::multiset<key_type>::const_iterator it4 = std_multiset.begin();
 
   EXPECT_EQ(it1 == it3, it2 == it4);
@@ -910,10 +928,10 @@ TESTS_ITERATOR_EQUAL_CONST(s21Multiset)
 template <typename key_type>
 void multiMethodIteratorNotEqualConst(
     const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::const_iterator it1 = s21_multiset.begin();
+  typename test_multiset<key_type>::const_iterator it1 = s21_multiset.begin();
   typename std::multiset<key_type>::const_iterator it2 = std_multiset.begin();
 
   EXPECT_EQ(it1 != s21_multiset.end(), it2 != std_multiset.end());
@@ -940,10 +958,10 @@ TESTS_ITERATOR_NOT_EQUAL_CONST(s21Multiset)
 template <typename key_type>
 void multiMethodInsertNoDuplicate(const std::initializer_list<key_type>& items,
                                   const key_type& key) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::iterator it1 = s21_multiset.insert(key);
+  typename test_multiset<key_type>::iterator it1 = s21_multiset.insert(key);
   typename std::multiset<key_type>::iterator it2 = std_multiset.insert(key);
 
   multiCheckFields(s21_multiset, std_multiset);
@@ -972,10 +990,10 @@ TESTS_INSERT_NO_DUPLICATE(s21Multiset)
 template <typename key_type>
 void multiMethodInsertDuplicate(const std::initializer_list<key_type>& items,
                                 const key_type& key) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
-  typename s21::multiset<key_type>::iterator it1 = s21_multiset.insert(key);
+  typename test_multiset<key_type>::iterator it1 = s21_multiset.insert(key);
   typename std::multiset<key_type>::iterator it2 = std_multiset.insert(key);
 
   multiCheckFields(s21_multiset, std_multiset);
@@ -1003,7 +1021,7 @@ TESTS_INSERT_DUPLICATE(s21Multiset)
 
 template <typename key_type>
 void multiMethodErase(const std::initializer_list<key_type>& items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
   s21_multiset.erase(s21_multiset.begin());
@@ -1036,7 +1054,7 @@ TESTS_ERASE(s21Multiset)
 template <typename key_type>
 void multiMethodContains(const std::initializer_list<key_type>& items,
                          const key_type& key, const key_type& key_duplicate) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
 
   ASSERT_FALSE(s21_multiset.contains(key));
   ASSERT_TRUE(s21_multiset.contains(key_duplicate));
@@ -1066,7 +1084,7 @@ template <typename key_type>
 void multiMethodInsertMany(
     const std::initializer_list<key_type>& items,
     const std::initializer_list<key_type>& insert_items) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
   s21_multiset.insert_many(*insert_items.begin(), *(insert_items.begin() + 1),
@@ -1101,7 +1119,7 @@ TESTS_INSERT_MANY(s21Multiset)
 template <typename key_type>
 void multiMethodFind(const std::initializer_list<key_type>& items,
                      const key_type& key, const key_type& key_duplicate) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
   EXPECT_EQ(s21_multiset.find(key) == s21_multiset.end(),
@@ -1132,7 +1150,7 @@ TESTS_FIND(s21Multiset)
 template <typename key_type>
 void multiMethodCount(const std::initializer_list<key_type>& items,
                       const key_type& key, const key_type& key_duplicate) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
   EXPECT_EQ(s21_multiset.count(key) == 0, std_multiset.count(key) == 0);
@@ -1162,7 +1180,7 @@ TESTS_COUNT(s21Multiset)
 template <typename key_type>
 void multiMethodLowerBound(const std::initializer_list<key_type>& items,
                            const key_type& key, const key_type& key_duplicate) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
   EXPECT_EQ(s21_multiset.lower_bound(key) == s21_multiset.end(),
@@ -1195,7 +1213,7 @@ TESTS_LOWER_BOUND(s21Multiset)
 template <typename key_type>
 void multiMethodUpperBound(const std::initializer_list<key_type>& items,
                            const key_type& key, const key_type& key_duplicate) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
   std::multiset<key_type> std_multiset(items);
 
   EXPECT_EQ(s21_multiset.upper_bound(key) == s21_multiset.end(),
@@ -1228,7 +1246,7 @@ TESTS_UPPER_BOUND(s21Multiset)
 template <typename key_type>
 void multiMethodEqualRange(const std::initializer_list<key_type>& items,
                            const key_type& key, const key_type& key_duplicate) {
-  s21::multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_multiset(items);
 
   EXPECT_TRUE(s21_multiset.equal_range(key).first ==
               s21_multiset.lower_bound(key));
@@ -1265,7 +1283,7 @@ TESTS_EQUAL_RANGE(s21Multiset)
 
 template <typename key_type>
 void multiBigLineTree(int rounds) {
-  s21::multiset<key_type> actual;
+  test_multiset<key_type> actual;
   std::multiset<key_type> expected;
 
   srand(static_cast<int>((std::size_t)&actual));
@@ -1292,7 +1310,7 @@ double multiGetRandMultiset(double min, double max) {
 
 template <typename key_type>
 void multiBigRandomTree(int rMin, int rMax, int rounds) {
-  s21::multiset<key_type> actual;
+  test_multiset<key_type> actual;
   std::multiset<key_type> expected;
 
   srand(static_cast<int>((std::size_t)&actual));
@@ -1319,4 +1337,736 @@ void multiBigRandomTree(int rMin, int rMax, int rounds) {
                                TEST_RAND_ROUNDS);                            \
   }
 
-TESTS_BIG_RANDOM_TREE(s21Multiset)
\ No newline at end of file
+TESTS_BIG_RANDOM_TREE(s21Multiset)
+// -------------------------------------------------
+
+template <typename key_type>
+void multiMethodReserve(const std::initializer_list<key_type>& items) {
+  test_multiset<key_type> s21_multiset;
+  std::multiset<key_type> std_multiset(items);
+
+  s21_multiset.reserve(items.size());
+  auto pool = s21_multiset.get_node_pool();
+  const auto capacity = pool->capacity();
+#ifdef S21_NODE_BASED_TREE
+  EXPECT_GE(pool->available(), items.size());
+#endif
+
+  for (const auto& item : items) s21_multiset.insert(item);
+
+  EXPECT_EQ(pool->capacity(), capacity);
+  multiCheckFields(s21_multiset, std_multiset);
+}
+
+#define TESTS_RESERVE(suiteName)                                               \
+  TEST(suiteName, intMethodReserve) { multiMethodReserve<int>(DEF_INT_KEYS); } \
+  TEST(suiteName, doubleMethodReserve) {                                       \
+    multiMethodReserve<double>(DEF_DBL_KEYS);                                  \
+  }                                                                            \
+  TEST(suiteName, mockClassMethodReserve) {                                    \
+    multiMethodReserve<MockClass>(DEF_MOCK_KEYS);                              \
+  }                                                                            \
+  TEST(suiteName, stringMethodReserve) {                                       \
+    multiMethodReserve<std::string>(DEF_STR_KEYS);                             \
+  }
+
+TESTS_RESERVE(s21Multiset)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiMethodSharedNodePool(
+    const std::initializer_list<key_type>& items,
+    const std::initializer_list<key_type>& insert_items) {
+  test_multiset<key_type> s21_multiset(items);
+  std::multiset<key_type> std_multiset(items);
+
+  {
+    test_multiset<key_type> s21_multiset_shared(s21_multiset.get_node_pool());
+    for (const auto& item : insert_items) s21_multiset_shared.insert(item);
+    EXPECT_EQ(s21_multiset_shared.get_node_pool(),
+              s21_multiset.get_node_pool());
+
+    s21_multiset_shared.erase(s21_multiset_shared.begin());
+    EXPECT_EQ(s21_multiset_shared.size(), insert_items.size() - 1);
+  }
+
+  s21_multiset.erase(s21_multiset.begin());
+  std_multiset.erase(std_multiset.begin());
+  for (const auto& item : insert_items) {
+    s21_multiset.insert(item);
+    std_multiset.insert(item);
+  }
+
+  multiCheckFields(s21_multiset, std_multiset);
+}
+
+#define TESTS_SHARED_NODE_POOL(suiteName)                                    \
+  TEST(suiteName, intSharedNodePool) {                                       \
+    multiMethodSharedNodePool<int>(DEF_INT_KEYS, DEF_INT_KEYS_NO_DUBLICATE); \
+  }                                                                          \
+  TEST(suiteName, doubleSharedNodePool) {                                    \
+    multiMethodSharedNodePool<double>(DEF_DBL_KEYS,                          \
+                                      DEF_DBL_KEYS_NO_DUBLICATE);            \
+  }                                                                          \
+  TEST(suiteName, mockClassSharedNodePool) {                                 \
+    multiMethodSharedNodePool<MockClass>(DEF_MOCK_KEYS,                      \
+                                         DEF_MOCK_KEYS_NO_DUBLICATE);        \
+  }                                                                          \
+  TEST(suiteName, stringSharedNodePool) {                                    \
+    multiMethodSharedNodePool<std::string>(DEF_STR_KEYS,                     \
+                                           DEF_STR_KEYS_NO_DUBLICATE);       \
+  }
+
+TESTS_SHARED_NODE_POOL(s21Multiset)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiMethodClearRecyclesNodes(
+    const std::initializer_list<key_type>& items) {
+  test_multiset<key_type> s21_multiset(items);
+  std::multiset<key_type> std_multiset(items);
+  const auto capacity = s21_multiset.get_node_pool()->capacity();
+
+  s21_multiset.clear();
+  EXPECT_TRUE(s21_multiset.begin() == s21_multiset.end());
+#ifdef S21_NODE_BASED_TREE
+  EXPECT_EQ(s21_multiset.get_node_pool()->available(), capacity);
+#endif
+
+  for (const auto& item : items) s21_multiset.insert(item);
+  EXPECT_EQ(s21_multiset.get_node_pool()->capacity(), capacity);
+  multiCheckFields(s21_multiset, std_multiset);
+}
+
+#define TESTS_CLEAR_RECYCLES_NODES(suiteName)                 \
+  TEST(suiteName, intClearRecyclesNodes) {                    \
+    multiMethodClearRecyclesNodes<int>(DEF_INT_KEYS);         \
+  }                                                           \
+  TEST(suiteName, doubleClearRecyclesNodes) {                 \
+    multiMethodClearRecyclesNodes<double>(DEF_DBL_KEYS);      \
+  }                                                           \
+  TEST(suiteName, mockClassClearRecyclesNodes) {              \
+    multiMethodClearRecyclesNodes<MockClass>(DEF_MOCK_KEYS);  \
+  }                                                           \
+  TEST(suiteName, stringClearRecyclesNodes) {                 \
+    multiMethodClearRecyclesNodes<std::string>(DEF_STR_KEYS); \
+  }
+
+TESTS_CLEAR_RECYCLES_NODES(s21Multiset)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiMethodInsertHint(
+    const std::initializer_list<key_type>& items,
+    const std::initializer_list<key_type>& insert_items) {
+  std::multiset<key_type> std_set(items);
+  test_multiset<key_type> s21_sorted;
+  test_multiset<key_type> s21_reversed;
+
+  for (auto it = std_set.begin(); it != std_set.end(); ++it)
+    s21_sorted.insert(s21_sorted.end(), *it);
+  for (auto it = std_set.rbegin(); it != std_set.rend(); ++it)
+    s21_reversed.insert(s21_reversed.begin(), *it);
+
+  multiCheckFields(s21_sorted, std_set);
+  multiCheckFields(s21_reversed, std_set);
+
+  for (const auto& item : insert_items) {
+    s21_sorted.insert(s21_sorted.begin(), item);
+    s21_reversed.insert(s21_reversed.end(), item);
+    std_set.insert(item);
+  }
+
+  multiCheckFields(s21_sorted, std_set);
+  multiCheckFields(s21_reversed, std_set);
+
+  auto hint = ++s21_sorted.begin();
+  std_set.insert(*hint);
+  auto res = s21_sorted.insert(hint, *hint);
+#ifdef S21_NODE_BASED_TREE
+  EXPECT_TRUE(++res == hint);
+#else
+  EXPECT_TRUE(++res == ++(++s21_sorted.begin()));
+#endif
+  multiCheckFields(s21_sorted, std_set);
+}
+
+#define TESTS_INSERT_HINT(suiteName)                                          \
+  TEST(suiteName, intInsertHint) {                                            \
+    multiMethodInsertHint<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                           \
+  TEST(suiteName, doubleInsertHint) {                                         \
+    multiMethodInsertHint<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                           \
+  TEST(suiteName, mockClassInsertHint) {                                      \
+    multiMethodInsertHint<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                           \
+  TEST(suiteName, stringInsertHint) {                                         \
+    multiMethodInsertHint<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_INSERT_HINT(s21Multiset)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiMethodEmplaceHint(const std::initializer_list<key_type>& items) {
+  std::multiset<key_type> std_set(items);
+  test_multiset<key_type> s21_multiset;
+
+  for (const auto& item : std_set) {
+    auto it = s21_multiset.emplace_hint(s21_multiset.end(), item);
+    EXPECT_EQ(*it, item);
+  }
+
+  multiCheckFields(s21_multiset, std_set);
+}
+
+#define TESTS_EMPLACE_HINT(suiteName)                  \
+  TEST(suiteName, intEmplaceHint) {                    \
+    multiMethodEmplaceHint<int>(DEF_INT_KEYS);         \
+  }                                                    \
+  TEST(suiteName, doubleEmplaceHint) {                 \
+    multiMethodEmplaceHint<double>(DEF_DBL_KEYS);      \
+  }                                                    \
+  TEST(suiteName, mockClassEmplaceHint) {              \
+    multiMethodEmplaceHint<MockClass>(DEF_MOCK_KEYS);  \
+  }                                                    \
+  TEST(suiteName, stringEmplaceHint) {                 \
+    multiMethodEmplaceHint<std::string>(DEF_STR_KEYS); \
+  }
+
+TESTS_EMPLACE_HINT(s21Multiset)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiMethodAssignSorted(
+    const std::initializer_list<key_type>& items,
+    const std::initializer_list<key_type>& insert_items) {
+  std::multiset<key_type> std_set(items);
+  s21::vector<key_type> sorted;
+  for (const auto& item : std_set) sorted.push_back(item);
+  sorted.push_back(*std_set.rbegin());
+  std_set.insert(*std_set.rbegin());
+
+  test_multiset<key_type> s21_multiset(sorted.begin(), sorted.end(),
+                                       s21::sorted_tag);
+  multiCheckFields(s21_multiset, std_set);
+
+  for (const auto& item : insert_items) {
+    s21_multiset.insert(item);
+    std_set.insert(item);
+  }
+  s21_multiset.erase(s21_multiset.begin());
+  std_set.erase(std_set.begin());
+  multiCheckFields(s21_multiset, std_set);
+
+  s21_multiset.assign(items.begin(), items.end(), s21::sorted_tag);
+  multiCheckFields(s21_multiset, std::multiset<key_type>(items));
+}
+
+#define TESTS_ASSIGN_SORTED(suiteName)                                     \
+  TEST(suiteName, intAssignSorted) {                                       \
+    multiMethodAssignSorted<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);    \
+  }                                                                        \
+  TEST(suiteName, doubleAssignSorted) {                                    \
+    multiMethodAssignSorted<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE); \
+  }                                                                        \
+  TEST(suiteName, mockClassAssignSorted) {                                 \
+    multiMethodAssignSorted<MockClass>(DEF_MOCK_KEYS,                      \
+                                       DEF_MOCK_KEYS_DUBLICATE);           \
+  }                                                                        \
+  TEST(suiteName, stringAssignSorted) {                                    \
+    multiMethodAssignSorted<std::string>(DEF_STR_KEYS,                     \
+                                         DEF_STR_KEYS_DUBLICATE);          \
+  }
+
+TESTS_ASSIGN_SORTED(s21Multiset)
+
+// -------------------------------------------------
+
+void multiBigAssignSorted(int maxSize) {
+  for (int size = 0; size <= maxSize; size++) {
+    s21::vector<int> sorted;
+    std::multiset<int> std_set;
+    for (int i = 0; i < size; i++) {
+      sorted.push_back(i / 2);
+      std_set.insert(i / 2);
+    }
+
+    test_multiset<int> s21_multiset;
+    s21_multiset.assign(sorted.begin(), sorted.end(), s21::sorted_tag);
+    multiCheckFields(s21_multiset, std_set);
+
+    for (int i = 0; i < size; i += 3) {
+      if (!s21_multiset.contains(i)) continue;
+      s21_multiset.erase(s21_multiset.find(i));
+      std_set.erase(std_set.find(i));
+    }
+    for (int i = size; i < 2 * size; i += 2) {
+      s21_multiset.insert(i);
+      std_set.insert(i);
+    }
+    multiCheckFields(s21_multiset, std_set);
+  }
+}
+
+TEST(s21Multiset, intBigAssignSorted) { multiBigAssignSorted(200); }
+
+// -------------------------------------------------
+
+void multiBigBounds(int maxSize) {
+  test_multiset<int> s21_multiset;
+  std::multiset<int> std_multiset;
+  for (int i = 0; i < maxSize; i++) {
+    s21_multiset.insert(i / 3 * 2);
+    std_multiset.insert(i / 3 * 2);
+  }
+
+  for (int key = -1; key <= maxSize; key++) {
+    EXPECT_EQ(
+        std::distance(s21_multiset.begin(), s21_multiset.lower_bound(key)),
+        std::distance(std_multiset.begin(), std_multiset.lower_bound(key)));
+    EXPECT_EQ(
+        std::distance(s21_multiset.begin(), s21_multiset.upper_bound(key)),
+        std::distance(std_multiset.begin(), std_multiset.upper_bound(key)));
+    auto range = s21_multiset.equal_range(key);
+    EXPECT_EQ(std::distance(range.first, range.second),
+              static_cast<std::ptrdiff_t>(std_multiset.count(key)));
+  }
+}
+
+TEST(s21Multiset, intBigBounds) { multiBigBounds(500); }
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiMethodEraseKey(const std::initializer_list<key_type>& items,
+                         const key_type& key, const key_type& key_duplicate) {
+  test_multiset<key_type> s21_multiset(items);
+  std::multiset<key_type> std_multiset(items);
+
+  EXPECT_EQ(s21_multiset.erase(key), std_multiset.erase(key));
+  multiCheckFields(s21_multiset, std_multiset);
+
+  EXPECT_EQ(s21_multiset.erase(key_duplicate),
+            std_multiset.erase(key_duplicate));
+  EXPECT_FALSE(s21_multiset.contains(key_duplicate));
+  multiCheckFields(s21_multiset, std_multiset);
+
+  for (const auto& item : items) {
+    EXPECT_EQ(s21_multiset.erase(item), std_multiset.erase(item));
+    multiCheckFields(s21_multiset, std_multiset);
+  }
+  EXPECT_TRUE(s21_multiset.empty());
+  EXPECT_TRUE(s21_multiset.begin() == s21_multiset.end());
+}
+
+#define TESTS_ERASE_KEY(suiteName)                                         \
+  TEST(suiteName, intMethodEraseKey) {                                     \
+    multiMethodEraseKey<int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                        \
+  TEST(suiteName, doubleMethodEraseKey) {                                  \
+    multiMethodEraseKey<double>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                        \
+  TEST(suiteName, mockClassMethodEraseKey) {                               \
+    multiMethodEraseKey<MockClass>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                   MOCK_KEY_DUPLICATE);                    \
+  }                                                                        \
+  TEST(suiteName, stringMethodEraseKey) {                                  \
+    multiMethodEraseKey<std::string>(DEF_STR_KEYS, STR_KEY,                \
+                                     STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_ERASE_KEY(s21Multiset)
+
+// -------------------------------------------------
+
+void multiBigEraseKey(int maxSize, int duplicates) {
+  test_multiset<int> s21_multiset;
+  std::multiset<int> std_multiset;
+  for (int i = 0; i < maxSize; i++) {
+    s21_multiset.insert(i / duplicates);
+    std_multiset.insert(i / duplicates);
+  }
+
+  for (int key = 0; key * duplicates < maxSize; key += 3) {
+    EXPECT_EQ(s21_multiset.count(key), std_multiset.count(key));
+    EXPECT_EQ(s21_multiset.erase(key), std_multiset.erase(key));
+    EXPECT_EQ(s21_multiset.count(key), 0U);
+  }
+  multiCheckFields(s21_multiset, std_multiset);
+
+  for (int i = 0; i < maxSize; i += 5) {
+    s21_multiset.insert(i % 7);
+    std_multiset.insert(i % 7);
+  }
+  for (int key = maxSize / duplicates; key >= 0; key -= 2) {
+    EXPECT_EQ(s21_multiset.erase(key), std_multiset.erase(key));
+  }
+  multiCheckFields(s21_multiset, std_multiset);
+}
+
+TEST(s21Multiset, intBigEraseKeyFewDuplicates) { multiBigEraseKey(1000, 2); }
+
+TEST(s21Multiset, intBigEraseKeyManyDuplicates) { multiBigEraseKey(1000, 200); }
+
+// -------------------------------------------------
+
+#ifdef S21_NODE_BASED_TREE
+void multiEraseKeepsIterators(int maxSize) {
+  test_multiset<int> s21_multiset;
+  s21::vector<test_multiset<int>::iterator> kept;
+  for (int i = 0; i < maxSize; i++) kept.push_back(s21_multiset.insert(i % 10));
+
+  for (int i = 0; i < maxSize; i += 2) s21_multiset.erase(kept[i]);
+  EXPECT_EQ(s21_multiset.size(), static_cast<std::size_t>(maxSize / 2));
+  for (int i = 1; i < maxSize; i += 2) EXPECT_EQ(*kept[i], i % 10);
+
+  int count = 0;
+  for (auto it = s21_multiset.begin(); it != s21_multiset.end(); ++it) count++;
+  EXPECT_EQ(count, maxSize / 2);
+}
+
+TEST(s21Multiset, intEraseKeepsIterators) { multiEraseKeepsIterators(300); }
+#endif
+
+// -------------------------------------------------
+
+void multiBigOrderStatistic(int maxSize, int duplicates) {
+  s21::multiset<int, std::less<int>, s21::order_statistic_policy> s21_multiset;
+  std::multiset<int> std_multiset;
+  for (int i = 0; i < maxSize; i++) {
+    s21_multiset.insert(i * 37 % maxSize / duplicates);
+    std_multiset.insert(i * 37 % maxSize / duplicates);
+  }
+  for (int key = 0; key * duplicates < maxSize; key += 3)
+    EXPECT_EQ(s21_multiset.erase(key), std_multiset.erase(key));
+  for (int i = 0; i < maxSize; i += 7) {
+    if (!std_multiset.count(i / duplicates)) continue;
+    s21_multiset.erase(s21_multiset.find(i / duplicates));
+    std_multiset.erase(std_multiset.find(i / duplicates));
+  }
+  multiCheckFields(s21_multiset, std_multiset);
+
+  std::size_t index = 0;
+  for (auto it = std_multiset.begin(); it != std_multiset.end(); ++it) {
+    EXPECT_EQ(*s21_multiset.nth(index), *it);
+    index++;
+  }
+  EXPECT_TRUE(s21_multiset.nth(index) == s21_multiset.end());
+
+  for (int key = -1; key <= maxSize / duplicates; key++) {
+    std::size_t less = static_cast<std::size_t>(
+        std::distance(std_multiset.begin(), std_multiset.lower_bound(key)));
+    EXPECT_EQ(s21_multiset.rank(key), less);
+    EXPECT_EQ(s21_multiset.distance(s21_multiset.begin(),
+                                    s21_multiset.lower_bound(key)),
+              static_cast<std::ptrdiff_t>(less));
+    EXPECT_EQ(s21_multiset.count(key), std_multiset.count(key));
+  }
+}
+
+TEST(s21Multiset, intBigOrderStatisticFewDuplicates) {
+  multiBigOrderStatistic(1000, 2);
+}
+
+TEST(s21Multiset, intBigOrderStatisticManyDuplicates) {
+  multiBigOrderStatistic(1000, 200);
+}
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiCustomCompare(const std::initializer_list<key_type>& items,
+                        const std::initializer_list<key_type>& insert_items) {
+  test_multiset<key_type, std::greater<key_type>> s21_multiset(items);
+  std::multiset<key_type, std::greater<key_type>> std_multiset(items);
+  for (const auto& item : insert_items) {
+    s21_multiset.insert(item);
+    std_multiset.insert(item);
+  }
+  multiCheckFields(s21_multiset, std_multiset);
+
+  for (const auto& item : std_multiset) {
+    EXPECT_TRUE(s21_multiset.contains(item));
+    EXPECT_EQ(s21_multiset.count(item), std_multiset.count(item));
+    EXPECT_EQ(
+        std::distance(s21_multiset.begin(), s21_multiset.lower_bound(item)),
+        std::distance(std_multiset.begin(), std_multiset.lower_bound(item)));
+  }
+  key_type greatest = *std_multiset.begin();
+  EXPECT_EQ(s21_multiset.erase(greatest), std_multiset.erase(greatest));
+  multiCheckFields(s21_multiset, std_multiset);
+}
+
+#define TESTS_CUSTOM_COMPARE(suiteName)                                    \
+  TEST(suiteName, intCustomCompare) {                                      \
+    multiCustomCompare<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                        \
+  TEST(suiteName, doubleCustomCompare) {                                   \
+    multiCustomCompare<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                        \
+  TEST(suiteName, mockClassCustomCompare) {                                \
+    multiCustomCompare<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                        \
+  TEST(suiteName, stringCustomCompare) {                                   \
+    multiCustomCompare<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_CUSTOM_COMPARE(s21Multiset)
+
+// -------------------------------------------------
+
+TEST(s21Multiset, stringTransparentLookup) {
+  test_multiset<std::string, std::less<>> s21_multiset(DEF_STR_KEYS);
+  std::multiset<std::string, std::less<>> std_multiset(DEF_STR_KEYS);
+  for (const auto& item : DEF_STR_KEYS_DUBLICATE) {
+    s21_multiset.insert(item);
+    std_multiset.insert(item);
+  }
+
+  for (const auto& item : std_multiset) {
+    std::string_view key(item);
+    EXPECT_TRUE(s21_multiset.contains(key));
+    EXPECT_EQ(*s21_multiset.find(key), item);
+    EXPECT_EQ(s21_multiset.count(key), std_multiset.count(key));
+    EXPECT_EQ(*s21_multiset.lower_bound(key), *std_multiset.lower_bound(key));
+  }
+  EXPECT_FALSE(s21_multiset.contains(std::string_view("absent")));
+  EXPECT_EQ(s21_multiset.count("absent"), 0U);
+  EXPECT_EQ(s21_multiset.count("hello"), std_multiset.count("hello"));
+}
+
+// -------------------------------------------------
+
+#ifdef S21_NODE_BASED_TREE
+TEST(s21Multiset, copyCounterEmplaceWithoutCopies) {
+  test_multiset<CopyCounter> s21_multiset;
+  CopyCounter::reset();
+
+  s21_multiset.emplace(1);
+  s21_multiset.emplace(2);
+  s21_multiset.emplace_hint(s21_multiset.end(), 3);
+  EXPECT_EQ(CopyCounter::moves, 0);
+
+  s21_multiset.insert(CopyCounter(4));
+  s21_multiset.insert(s21_multiset.end(), CopyCounter(5));
+  s21_multiset.insert_many(CopyCounter(6), CopyCounter(7));
+  EXPECT_EQ(CopyCounter::moves, 4);
+  EXPECT_EQ(CopyCounter::copies, 0);
+
+  test_multiset<CopyCounter> copy(s21_multiset);
+  EXPECT_EQ(CopyCounter::copies, 7);
+  EXPECT_EQ(copy.size(), 7U);
+  EXPECT_EQ((*copy.begin()).value(), 1);
+}
+#endif
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiMethodExtract(const std::initializer_list<key_type>& items) {
+  test_multiset<key_type> s21_multiset(items);
+  std::multiset<key_type> std_multiset(items);
+
+  auto s21_first = s21_multiset.extract(s21_multiset.begin());
+  auto std_first = std_multiset.extract(std_multiset.begin());
+  EXPECT_EQ(s21_first.value(), std_first.value());
+  multiCheckFields(s21_multiset, std_multiset);
+
+  key_type last = *std_multiset.rbegin();
+  auto s21_last = s21_multiset.extract(last);
+  auto std_last = std_multiset.extract(last);
+  EXPECT_EQ(s21_last.value(), std_last.value());
+  multiCheckFields(s21_multiset, std_multiset);
+
+  s21_multiset.insert(std::move(s21_first));
+  s21_multiset.insert(std::move(s21_last));
+  EXPECT_TRUE(s21_first.empty());
+  EXPECT_TRUE(s21_last.empty());
+  std_multiset.insert(std::move(std_first));
+  std_multiset.insert(std::move(std_last));
+  multiCheckFields(s21_multiset, std_multiset);
+
+  // Equal keys stay in the tree one by one
+  while (!std_multiset.empty()) {
+    key_type key = *std_multiset.begin();
+    EXPECT_EQ(s21_multiset.extract(key).value(),
+              std_multiset.extract(key).value());
+  }
+  EXPECT_TRUE(s21_multiset.empty());
+}
+
+#define TESTS_EXTRACT(suiteName)                                         \
+  TEST(suiteName, intExtract) { multiMethodExtract<int>(DEF_INT_KEYS); } \
+  TEST(suiteName, doubleExtract) {                                       \
+    multiMethodExtract<double>(DEF_DBL_KEYS);                            \
+  }                                                                      \
+  TEST(suiteName, mockClassExtract) {                                    \
+    multiMethodExtract<MockClass>(DEF_MOCK_KEYS);                        \
+  }                                                                      \
+  TEST(suiteName, stringExtract) {                                       \
+    multiMethodExtract<std::string>(DEF_STR_KEYS);                       \
+  }
+
+TESTS_EXTRACT(s21Multiset)
+
+// -------------------------------------------------
+
+#ifdef S21_NODE_BASED_TREE
+// The multisets were given one pool, so the nodes are relinked as they are
+TEST(s21Multiset, copyCounterMergeSplicesNodes) {
+  test_multiset<CopyCounter> s21_multiset{1, 3, 3, 5};
+  test_multiset<CopyCounter> s21_other(s21_multiset.get_node_pool());
+  for (int key : {2, 3, 4}) s21_other.emplace(key);
+  const CopyCounter* two = &*s21_other.begin();
+  CopyCounter::reset();
+
+  s21_multiset.merge(s21_other);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(CopyCounter::moves, 0);
+  EXPECT_EQ(s21_multiset.size(), 7U);
+  EXPECT_TRUE(s21_other.empty());
+  EXPECT_EQ(s21_multiset.count(CopyCounter(3)), 3U);
+  EXPECT_EQ(&*s21_multiset.find(CopyCounter(2)), two);
+}
+
+// Each multiset keeps its own pool, the keys are moved into new nodes
+TEST(s21Multiset, copyCounterMergeKeepsPoolsApart) {
+  test_multiset<CopyCounter> s21_multiset{1, 3, 3, 5};
+  test_multiset<CopyCounter> s21_other{2, 3, 4};
+  CopyCounter::reset();
+
+  s21_multiset.merge(s21_other);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(CopyCounter::moves, 3);
+  EXPECT_EQ(s21_multiset.size(), 7U);
+  EXPECT_TRUE(s21_other.empty());
+  EXPECT_NE(s21_multiset.get_node_pool(), s21_other.get_node_pool());
+}
+#endif
+
+// -------------------------------------------------
+
+template <typename key_type>
+void multiCheckSetAlgebra(const test_multiset<key_type>& lhs,
+                          const test_multiset<key_type>& rhs) {
+  std::multiset<key_type> std_lhs(lhs.begin(), lhs.end());
+  std::multiset<key_type> std_rhs(rhs.begin(), rhs.end());
+  std::multiset<key_type> expected;
+
+  std::set_union(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                 std_rhs.end(), std::inserter(expected, expected.end()));
+  multiCheckFields(s21::set_union(lhs, rhs), expected);
+
+  expected.clear();
+  std::set_intersection(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                        std_rhs.end(), std::inserter(expected, expected.end()));
+  multiCheckFields(s21::set_intersection(lhs, rhs), expected);
+
+  expected.clear();
+  std::set_difference(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                      std_rhs.end(), std::inserter(expected, expected.end()));
+  multiCheckFields(s21::set_difference(lhs, rhs), expected);
+
+  expected.clear();
+  std::set_symmetric_difference(std_lhs.begin(), std_lhs.end(),
+                                std_rhs.begin(), std_rhs.end(),
+                                std::inserter(expected, expected.end()));
+  multiCheckFields(s21::set_symmetric_difference(lhs, rhs), expected);
+}
+
+template <typename key_type>
+void multiMethodSetAlgebra(
+    const std::initializer_list<key_type>& items,
+    const std::initializer_list<key_type>& other_items) {
+  test_multiset<key_type> s21_multiset(items);
+  test_multiset<key_type> s21_other(other_items);
+  test_multiset<key_type> s21_empty;
+
+  multiCheckSetAlgebra(s21_multiset, s21_other);
+  multiCheckSetAlgebra(s21_other, s21_multiset);
+  multiCheckSetAlgebra(s21_multiset, s21_multiset);
+  multiCheckSetAlgebra(s21_multiset, s21_empty);
+  multiCheckSetAlgebra(s21_empty, s21_multiset);
+}
+
+#define TESTS_SET_ALGEBRA(suiteName)                                          \
+  TEST(suiteName, intSetAlgebra) {                                            \
+    multiMethodSetAlgebra<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                           \
+  TEST(suiteName, doubleSetAlgebra) {                                         \
+    multiMethodSetAlgebra<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                           \
+  TEST(suiteName, mockClassSetAlgebra) {                                      \
+    multiMethodSetAlgebra<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                           \
+  TEST(suiteName, stringSetAlgebra) {                                         \
+    multiMethodSetAlgebra<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_SET_ALGEBRA(s21Multiset)
+
+TEST(s21Multiset, intBigSetAlgebra) {
+  test_multiset<int> s21_multiset;
+  test_multiset<int> s21_other;
+  for (int i = 0; i < 3000; i++) s21_multiset.insert(i * 37 % 3000 / 7);
+  for (int i = 0; i < 2000; i++) s21_other.insert(i * 11 % 2000 / 3);
+  multiCheckSetAlgebra(s21_multiset, s21_other);
+}
+
+// -------------------------------------------------
+
+using threaded_multiset =
+    s21::multiset<int, std::less<int>, s21::threaded_tree_policy>;
+
+void multiCheckThreadedLinks(threaded_multiset& s21_multiset,
+                             const std::multiset<int>& std_multiset) {
+  multiCheckFields(s21_multiset, std_multiset);
+  auto std_it = std_multiset.rbegin();
+  for (auto it = s21_multiset.end(); it != s21_multiset.begin(); ++std_it)
+    EXPECT_EQ(*--it, *std_it);
+  EXPECT_TRUE(std_it == std_multiset.rend());
+}
+
+void multiBigThreaded(int maxSize, int duplicates) {
+  threaded_multiset s21_multiset;
+  std::multiset<int> std_multiset;
+  for (int i = 0; i < maxSize; i++) {
+    s21_multiset.insert(i * 37 % maxSize / duplicates);
+    std_multiset.insert(i * 37 % maxSize / duplicates);
+  }
+  for (int i = 0; i < maxSize; i++) {
+    s21_multiset.insert(s21_multiset.find(i % 4), i % 4);
+    std_multiset.insert(std_multiset.find(i % 4), i % 4);
+  }
+  multiCheckThreadedLinks(s21_multiset, std_multiset);
+
+  // Erasing the many copies of 3 relinks the survivors in one pass
+  for (int key = 3; key * duplicates < maxSize; key += 5)
+    EXPECT_EQ(s21_multiset.erase(key), std_multiset.erase(key));
+  multiCheckThreadedLinks(s21_multiset, std_multiset);
+
+  threaded_multiset s21_other;
+  std::multiset<int> std_other;
+  for (int i = 0; i < maxSize; i++) {
+    s21_other.insert(i * 7 % maxSize);
+    std_other.insert(i * 7 % maxSize);
+  }
+  s21_multiset.merge(s21_other);
+  std_multiset.merge(std_other);
+  multiCheckThreadedLinks(s21_multiset, std_multiset);
+  EXPECT_TRUE(s21_other.begin() == s21_other.end());
+}
+
+TEST(s21Multiset, intBigThreaded) {
+  multiBigThreaded(500, 1);
+  multiBigThreaded(500, 20);
+}
+
+}  // namespace
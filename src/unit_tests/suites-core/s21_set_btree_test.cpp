@@ -0,0 +1,45 @@
+// The s21Set suites again, as s21SetBTree, against the B-tree backend
+#include <array>
+#include <random>
+
+#define S21_TREE_POLICY s21::btree_policy<>
+#define s21Set s21SetBTree
+
+#include "s21_set_test.cpp"
+
+// 80-byte keys leave 3 of them to a 256-byte node, so a few thousand keys
+// make a deep tree that inserts and erases keep splitting and merging
+using WideKey = std::array<int, 20>;
+
+TEST(s21SetBTree, wideKeyRandomInsertErase) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 3000);
+  s21::set<WideKey, std::less<WideKey>, s21::btree_policy<>> s21_set;
+  std::set<WideKey> std_set;
+
+  for (int i = 0; i < 6000; ++i) {
+    WideKey item{key(gen)};
+    if (i % 3 == 2) {
+      auto s21_it = s21_set.lower_bound(item);
+      auto std_it = std_set.lower_bound(item);
+      ASSERT_EQ(s21_it == s21_set.end(), std_it == std_set.end());
+      if (std_it == std_set.end()) continue;
+      EXPECT_EQ(*s21_it, *std_it);
+      s21_set.erase(s21_it);
+      std_set.erase(std_it);
+    } else {
+      EXPECT_EQ(s21_set.insert(item).second, std_set.insert(item).second);
+    }
+  }
+  checkFields(s21_set, std_set);
+
+  auto std_it = std_set.rbegin();
+  for (auto s21_it = s21_set.end(); s21_it != s21_set.begin(); ++std_it)
+    EXPECT_EQ(*--s21_it, *std_it);
+
+  while (!std_set.empty()) {
+    s21_set.erase(s21_set.begin());
+    std_set.erase(std_set.begin());
+  }
+  checkFields(s21_set, std_set);
+}
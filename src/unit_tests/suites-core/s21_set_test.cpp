@@ -1,9 +1,24 @@
 #include "core/s21_set.h"
 
+#include <algorithm>
+#include <iterator>
 #include <set>
+#include <string_view>
 
 #include "s21_core_tests.h"
 
+// s21_set_btree_test.cpp builds this file again with S21_TREE_POLICY set
+// to the B-tree backend. Tests of node-based behaviour are left out there.
+#ifndef S21_TREE_POLICY
+#define S21_TREE_POLICY s21::default_tree_policy
+#define S21_NODE_BASED_TREE
+#endif
+
+namespace {
+
+template <typename K, typename C = std::less<K>>
+using test_set = s21::set<K, C, S21_TREE_POLICY>;
+
 #define DEF_INT_KEYS \
   { 1, 2, 3, 4, 8 }
 #define DEF_DBL_KEYS \
@@ -41,9 +56,9 @@
 #define MOCK_KEY_DUPLICATE 44
 #define STR_KEY_DUPLICATE "!"
 
-template <typename key_type>
-void checkFields(const s21::set<key_type>& s21_set,
-                 const std::set<key_type>& std_set) {
+template <typename key_type, typename compare_type, typename policy_type>
+void checkFields(const s21::set<key_type, compare_type, policy_type>& s21_set,
+                 const std::set<key_type, compare_type>& std_set) {
   auto std_it = std_set.begin();
   for (auto s21_it : s21_set) {
     EXPECT_EQ(s21_it, *std_it);
@@ -54,7 +69,7 @@ void checkFields(const s21::set<key_type>& s21_set,
 }
 
 template <typename key_type>
-void checkFieldsEmpty(const s21::set<key_type>& s21_set,
+void checkFieldsEmpty(const test_set<key_type>& s21_set,
                       const std::set<key_type>& std_set) {
   auto std_it = std_set.begin();
   for (auto s21_it : s21_set) {
@@ -72,7 +87,7 @@ void checkFieldsEmpty(const s21::set<key_type>& s21_set,
 
 template <typename key_type>
 void constructorDefaultAsCont() {
-  s21::IContainer* ct = new s21::set<key_type>();
+  s21::IContainer* ct = new test_set<key_type>();
 
   EXPECT_EQ(ct->size(), 0);
   EXPECT_TRUE(ct->empty());
@@ -94,7 +109,7 @@ TESTS_CONSTRUCTOR_INIT_AS_CONT(s21Set)
 
 template <typename key_type>
 void constructorDefault() {
-  s21::set<key_type> s21_set;
+  test_set<key_type> s21_set;
   std::set<key_type> std_set;
 
   checkFieldsEmpty(s21_set, std_set);
@@ -112,7 +127,7 @@ TESTS_DEFAULT_CONSTRUCTOR_INIT(s21Set)
 
 template <typename key_type>
 void constructorInitList(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
   checkFields(s21_set, std_set);
@@ -136,10 +151,10 @@ TESTS_CONSTRUCTOR_INIT_LIST(s21Set)
 
 template <typename key_type>
 void constructorCopyEmpty() {
-  s21::set<key_type> s21_set;
+  test_set<key_type> s21_set;
   std::set<key_type> std_set;
 
-  s21::set<key_type> s21_map_copy(s21_set);
+  test_set<key_type> s21_map_copy(s21_set);
   std::set<key_type> std_map_copy(std_set);
 
   checkFields(s21_map_copy, std_map_copy);
@@ -157,10 +172,10 @@ TESTS_CONSTRUCTOR_COPY_EMPTY(s21Set)
 
 template <typename key_type>
 void constructorCopy(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_copy(s21_set);
+  test_set<key_type> s21_map_copy(s21_set);
   std::set<key_type> std_map_copy(std_set);
 
   checkFields(s21_map_copy, std_map_copy);
@@ -180,10 +195,10 @@ TESTS_CONSTRUCTOR_COPY(s21Set)
 
 template <typename key_type>
 void constructorMoveEmpty() {
-  s21::set<key_type> s21_set;
+  test_set<key_type> s21_set;
   std::set<key_type> std_set;
 
-  s21::set<key_type> s21_map_move(std::move(s21_set));
+  test_set<key_type> s21_map_move(std::move(s21_set));
   std::set<key_type> std_map_move(std::move(std_set));
 
   checkFields(s21_map_move, std_map_move);
@@ -201,10 +216,10 @@ TESTS_CONSTRUCTOR_MOVE_EMPTY(s21Set)
 
 template <typename key_type>
 void constructorMove(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_move(std::move(s21_set));
+  test_set<key_type> s21_map_move(std::move(s21_set));
   std::set<key_type> std_map_move(std::move(std_set));
 
   checkFields(s21_map_move, std_map_move);
@@ -224,10 +239,10 @@ TESTS_CONSTRUCTOR_MOVE(s21Set)
 
 template <typename key_type>
 void operatorCopyEmpty() {
-  s21::set<key_type> s21_set;
+  test_set<key_type> s21_set;
   std::set<key_type> std_set;
 
-  s21::set<key_type> s21_map_copy = s21_set;
+  test_set<key_type> s21_map_copy = s21_set;
   std::set<key_type> std_map_copy = std_set;
 
   checkFields(s21_map_copy, std_map_copy);
@@ -247,10 +262,10 @@ TESTS_OPERATOR_COPY_EMPTY(s21Set)
 
 template <typename key_type>
 void operatorCopy(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_copy = s21_set;
+  test_set<key_type> s21_map_copy = s21_set;
   std::set<key_type> std_map_copy = std_set;
 
   checkFields(s21_map_copy, std_map_copy);
@@ -272,10 +287,10 @@ TESTS_OPERATOR_COPY(s21Set)
 
 template <typename key_type>
 void operatorMoveEmpty() {
-  s21::set<key_type> s21_set;
+  test_set<key_type> s21_set;
   std::set<key_type> std_set;
 
-  s21::set<key_type> s21_map_move = std::move(s21_set);
+  test_set<key_type> s21_map_move = std::move(s21_set);
   std::set<key_type> std_map_move = std::move(std_set);
 
   checkFields(s21_map_move, std_map_move);
@@ -297,10 +312,10 @@ TESTS_OPERATOR_MOVE_EMPTY(s21Set)
 
 template <typename key_type>
 void operatorMove(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_move = std::move(s21_set);
+  test_set<key_type> s21_map_move = std::move(s21_set);
   std::set<key_type> std_map_move = std::move(std_set);
 
   checkFields(s21_map_move, std_map_move);
@@ -322,10 +337,10 @@ TESTS_OPERATOR_MOVE(s21Set)
 
 template <typename key_type>
 void methodEmpty(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_empty;
+  test_set<key_type> s21_map_empty;
   std::set<key_type> std_map_empty;
 
   EXPECT_EQ(s21_set.empty(), std_set.empty());
@@ -344,10 +359,10 @@ TESTS_EMPTY(s21Set)
 
 template <typename key_type>
 void methodSize(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_empty;
+  test_set<key_type> s21_map_empty;
   std::set<key_type> std_map_empty;
 
   EXPECT_EQ(s21_set.size(), std_set.size());
@@ -366,8 +381,8 @@ TESTS_SIZE(s21Set)
 
 template <typename key_type>
 void methodSwap(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
-  s21::set<key_type> s21_map_empty;
+  test_set<key_type> s21_set(items);
+  test_set<key_type> s21_map_empty;
 
   std::set<key_type> std_set(items);
 
@@ -390,10 +405,10 @@ template <typename key_type>
 void methodMergeWithDublicates(
     const std::initializer_list<key_type>& items,
     const std::initializer_list<key_type>& itemsDublicates) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_dublicate(itemsDublicates);
+  test_set<key_type> s21_map_dublicate(itemsDublicates);
   std::set<key_type> std_map_dublicate(itemsDublicates);
 
   checkFields(s21_set, std_set);
@@ -403,6 +418,7 @@ void methodMergeWithDublicates(
   std_set.merge(std_map_dublicate);
 
   checkFields(s21_set, std_set);
+  checkFields(s21_map_dublicate, std_map_dublicate);
 }
 
 #define TESTS_MERGE_WITH_DUBLICATES(suiteName)                               \
@@ -429,10 +445,10 @@ template <typename key_type>
 void methodMergeWithNoDublicates(
     const std::initializer_list<key_type>& items,
     const std::initializer_list<key_type>& itemsNoDublicates) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_no_dublicate(itemsNoDublicates);
+  test_set<key_type> s21_map_no_dublicate(itemsNoDublicates);
   std::set<key_type> std_map_no_dublicate(itemsNoDublicates);
 
   checkFields(s21_set, std_set);
@@ -442,6 +458,7 @@ void methodMergeWithNoDublicates(
   std_set.merge(std_map_no_dublicate);
 
   checkFields(s21_set, std_set);
+  checkFields(s21_map_no_dublicate, std_map_no_dublicate);
 }
 
 #define TESTS_MERGE_WITH_NO_DUBLICATES(suiteName)                              \
@@ -467,10 +484,10 @@ TESTS_MERGE_WITH_NO_DUBLICATES(s21Set)
 
 template <typename key_type>
 void methodClear(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_empty;
+  test_set<key_type> s21_map_empty;
   std::set<key_type> std_map_empty;
 
   s21_set.clear();
@@ -495,18 +512,18 @@ TESTS_CLEAR(s21Set)
 
 template <typename key_type>
 void methodBegin(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_empty;
+  test_set<key_type> s21_map_empty;
   std::set<key_type> std_map_empty;
 
-  typename s21::set<key_type>::iterator it1 = s21_map_empty.begin();
+  typename test_set<key_type>::iterator it1 = s21_map_empty.begin();
   typename std::set<key_type>::iterator it2 = std_map_empty.begin();
 
   EXPECT_EQ(it1 == s21_map_empty.end(), it2 == std_map_empty.end());
 
-  typename s21::set<key_type>::iterator it3 = s21_set.begin();
+  typename test_set<key_type>::iterator it3 = s21_set.begin();
   typename std::set<key_type>::iterator it4 = std_set.begin();
 
   EXPECT_EQ(it3 != s21_set.end(), it4 != std_set.end());
@@ -525,18 +542,18 @@ TESTS_BEGIN(s21Set)
 
 template <typename key_type>
 void methodBeginConst(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  s21::set<key_type> s21_map_empty;
+  test_set<key_type> s21_map_empty;
   std::set<key_type> std_map_empty;
 
-  typename s21::set<key_type>::const_iterator it1 = s21_map_empty.begin();
+  typename test_set<key_type>::const_iterator it1 = s21_map_empty.begin();
   typename std::set<key_type>::const_iterator it2 = std_map_empty.begin();
 
   EXPECT_EQ(it1 == s21_map_empty.end(), it2 == std_map_empty.end());
 
-  typename s21::set<key_type>::const_iterator it3 = s21_set.begin();
+  typename test_set<key_type>::const_iterator it3 = s21_set.begin();
   typename std::set<key_type>::const_iterator it4 = std_set.begin();
 
   EXPECT_EQ(it3 != s21_set.end(), it4 != std_set.end());
@@ -561,10 +578,10 @@ TESTS_BEGIN_CONST(s21Set)
 
 template <typename key_type>
 void methodIteratorPlus(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::iterator it1 = s21_set.begin();
+  typename test_set<key_type>::iterator it1 = s21_set.begin();
   typename std::set<key_type>::iterator it2 = std_set.begin();
 
   ++it1;
@@ -596,10 +613,10 @@ TESTS_ITERATOR_PLUS(s21Set)
 
 template <typename key_type>
 void methodIteratorMinus(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::iterator it1 = s21_set.begin();
+  typename test_set<key_type>::iterator it1 = s21_set.begin();
   typename std::set<key_type>::iterator it2 = std_set.begin();
 
   ++it1;
@@ -633,13 +650,13 @@ TESTS_ITERATOR_MINUS(s21Set)
 
 template <typename key_type>
 void methodIteratorAssignment(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::iterator it1 = s21_set.begin();
+  typename test_set<key_type>::iterator it1 = s21_set.begin();
   typename std::set<key_type>::iterator it2 = std_set.begin();
 
-  typename s21::set<key_type>::iterator it3 = it1;
+  typename test_set<key_type>::iterator it3 = it1;
   typename std::set<key_type>::iterator it4 = it2;
 
   EXPECT_EQ(*it1, *it3);
@@ -666,13 +683,13 @@ TESTS_ITERATOR_ASSIGNMENT(s21Set)
 
 template <typename key_type>
 void methodIteratorEqual(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::iterator it1 = s21_set.begin();
+  typename test_set<key_type>::iterator it1 = s21_set.begin();
   typename std::set<key_type>::iterator it2 = std_set.begin();
 
-  typename s21::set<key_type>::iterator it3 = s21_set.begin();
+  typename test_set<key_type>::iterator it3 = s21_set.begin();
   typename std::set<key_type>::iterator it4 = std_set.begin();
 
   EXPECT_EQ(it1 == it3, it2 == it4);
@@ -698,10 +715,10 @@ TESTS_ITERATOR_EQUAL(s21Set)
 
 template <typename key_type>
 void methodIteratorNotEqual(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::iterator it1 = s21_set.begin();
+  typename test_set<key_type>::iterator it1 = s21_set.begin();
   typename std::set<key_type>::iterator it2 = std_set.begin();
 
   EXPECT_EQ(it1 != s21_set.end(), it2 != std_set.end());
@@ -727,10 +744,10 @@ TESTS_ITERATOR_NOT_EQUAL(s21Set)
 
 template <typename key_type>
 void methodIteratorPlusConst(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::const_iterator it1 = s21_set.begin();
+  typename test_set<key_type>::const_iterator it1 = s21_set.begin();
   typename std::set<key_type>::const_iterator it2 = std_set.begin();
 
   ++it1;
@@ -764,10 +781,10 @@ TESTS_ITERATOR_PLUS_CONST(s21Set)
 
 template <typename key_type>
 void methodIteratorMinusConst(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::const_iterator it1 = s21_set.begin();
+  typename test_set<key_type>::const_iterator it1 = s21_set.begin();
   typename std::set<key_type>::const_iterator it2 = std_set.begin();
 
   ++it1;
@@ -802,13 +819,13 @@ TESTS_ITERATOR_MINUS_CONST(s21Set)
 template <typename key_type>
 void methodIteratorAssignmentConst(
     const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::const_iterator it1 = s21_set.begin();
+  typename test_set<key_type>::const_iterator it1 = s21_set.begin();
   typename std::set<key_type>::const_iterator it2 = std_set.begin();
 
-  typename s21::set<key_type>::const_iterator it3 = it1;
+  typename test_set<key_type>::const_iterator it3 = it1;
   typename std::set<key_type>::const_iterator it4 = it2;
 
   EXPECT_EQ(*it1, *it3);
@@ -835,13 +852,13 @@ TESTS_ITERATOR_ASSIGNMENT_CONST(s21Set)
 
 template <typename key_type>
 void methodIteratorEqualConst(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::const_iterator it1 = s21_set.begin();
+  typename test_set<key_type>::const_iterator it1 = s21_set.begin();
   typename std::set<key_type>::const_iterator it2 = std_set.begin();
 
-  typename s21::set<key_type>::const_iterator it3 = s21_set.begin();
+  typename test_set<key_type>::const_iterator it3 = s21_set.begin();
   typename std::set<key_type>::const_iterator it4 = std_set.begin();
 
   EXPECT_EQ(it1 == it3, it2 == it4);
@@ -867,10 +884,10 @@ TESTS_ITERATOR_EQUAL_CONST(s21Set)
 
 template <typename key_type>
 void methodIteratorNotEqualConst(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  typename s21::set<key_type>::const_iterator it1 = s21_set.begin();
+  typename test_set<key_type>::const_iterator it1 = s21_set.begin();
   typename std::set<key_type>::const_iterator it2 = std_set.begin();
 
   EXPECT_EQ(it1 != s21_set.end(), it2 != std_set.end());
@@ -897,10 +914,10 @@ TESTS_ITERATOR_NOT_EQUAL_CONST(s21Set)
 template <typename key_type>
 void methodInsertNoDuplicate(const std::initializer_list<key_type>& items,
                              const key_type& key) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  std::pair<typename s21::set<key_type>::iterator, bool> it1 =
+  std::pair<typename test_set<key_type>::iterator, bool> it1 =
       s21_set.insert(key);
   std::pair<typename std::set<key_type>::iterator, bool> it2 =
       std_set.insert(key);
@@ -932,10 +949,10 @@ TESTS_INSERT_NO_DUPLICATE(s21Set)
 template <typename key_type>
 void methodInsertDuplicate(const std::initializer_list<key_type>& items,
                            const key_type& key) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
-  std::pair<typename s21::set<key_type>::iterator, bool> it1 =
+  std::pair<typename test_set<key_type>::iterator, bool> it1 =
       s21_set.insert(key);
   std::pair<typename std::set<key_type>::iterator, bool> it2 =
       std_set.insert(key);
@@ -966,7 +983,7 @@ TESTS_INSERT_DUPLICATE(s21Set)
 
 template <typename key_type>
 void methodErase(const std::initializer_list<key_type>& items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
   s21_set.erase(s21_set.begin());
@@ -995,7 +1012,7 @@ TESTS_ERASE(s21Set)
 template <typename key_type>
 void methodContains(const std::initializer_list<key_type>& items,
                     const key_type& key, const key_type& key_duplicate) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
 
   ASSERT_FALSE(s21_set.contains(key));
   ASSERT_TRUE(s21_set.contains(key_duplicate));
@@ -1022,7 +1039,7 @@ TESTS_CONTAINS(s21Set)
 template <typename key_type>
 void methodInsertMany(const std::initializer_list<key_type>& items,
                       const std::initializer_list<key_type>& insert_items) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
   s21_set.insert_many(*insert_items.begin(), *(insert_items.begin() + 1),
@@ -1055,7 +1072,7 @@ TESTS_INSERT_MANY(s21Set)
 template <typename key_type>
 void methodFind(const std::initializer_list<key_type>& items,
                 const key_type& key, const key_type& key_duplicate) {
-  s21::set<key_type> s21_set(items);
+  test_set<key_type> s21_set(items);
   std::set<key_type> std_set(items);
 
   EXPECT_EQ(s21_set.find(key) == s21_set.end(),
@@ -1084,7 +1101,7 @@ TESTS_FIND(s21Set)
 
 template <typename key_type>
 void bigLineTree(int rounds) {
-  s21::set<key_type> actual;
+  test_set<key_type> actual;
   std::set<key_type> expected;
 
   srand(static_cast<int>((std::size_t)&actual));
@@ -1109,7 +1126,7 @@ double GetRandSet(double min, double max) {
 
 template <typename key_type>
 void bigRandomTree(int rMin, int rMax, int rounds) {
-  s21::set<key_type> actual;
+  test_set<key_type> actual;
   std::set<key_type> expected;
 
   srand(static_cast<int>((std::size_t)&actual));
@@ -1135,4 +1152,807 @@ void bigRandomTree(int rMin, int rMax, int rounds) {
     bigRandomTree<double>(TEST_RAND_MIN, TEST_RAND_MAX, TEST_RAND_ROUNDS); \
   }
 
-TESTS_BIG_RANDOM_TREE(s21Set)
\ No newline at end of file
+TESTS_BIG_RANDOM_TREE(s21Set)
+// -------------------------------------------------
+
+template <typename key_type>
+void methodReserve(const std::initializer_list<key_type>& items) {
+  test_set<key_type> s21_set;
+  std::set<key_type> std_set(items);
+
+  s21_set.reserve(items.size());
+  auto pool = s21_set.get_node_pool();
+  const auto capacity = pool->capacity();
+#ifdef S21_NODE_BASED_TREE
+  EXPECT_GE(pool->available(), items.size());
+#endif
+
+  for (const auto& item : items) s21_set.insert(item);
+
+  EXPECT_EQ(pool->capacity(), capacity);
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_RESERVE(suiteName)                                          \
+  TEST(suiteName, intMethodReserve) { methodReserve<int>(DEF_INT_KEYS); } \
+  TEST(suiteName, doubleMethodReserve) {                                  \
+    methodReserve<double>(DEF_DBL_KEYS);                                  \
+  }                                                                       \
+  TEST(suiteName, mockClassMethodReserve) {                               \
+    methodReserve<MockClass>(DEF_MOCK_KEYS);                              \
+  }                                                                       \
+  TEST(suiteName, stringMethodReserve) {                                  \
+    methodReserve<std::string>(DEF_STR_KEYS);                             \
+  }
+
+TESTS_RESERVE(s21Set)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodSharedNodePool(const std::initializer_list<key_type>& items,
+                          const std::initializer_list<key_type>& insert_items) {
+  test_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  {
+    test_set<key_type> s21_set_shared(s21_set.get_node_pool());
+    for (const auto& item : insert_items) s21_set_shared.insert(item);
+    EXPECT_EQ(s21_set_shared.get_node_pool(), s21_set.get_node_pool());
+
+    s21_set_shared.erase(s21_set_shared.begin());
+    EXPECT_EQ(s21_set_shared.size(), insert_items.size() - 1);
+  }
+
+  s21_set.erase(s21_set.begin());
+  std_set.erase(std_set.begin());
+  for (const auto& item : insert_items) {
+    s21_set.insert(item);
+    std_set.insert(item);
+  }
+
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_SHARED_NODE_POOL(suiteName)                                  \
+  TEST(suiteName, intSharedNodePool) {                                     \
+    methodSharedNodePool<int>(DEF_INT_KEYS, DEF_INT_KEYS_NO_DUBLICATE);    \
+  }                                                                        \
+  TEST(suiteName, doubleSharedNodePool) {                                  \
+    methodSharedNodePool<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_NO_DUBLICATE); \
+  }                                                                        \
+  TEST(suiteName, mockClassSharedNodePool) {                               \
+    methodSharedNodePool<MockClass>(DEF_MOCK_KEYS,                         \
+                                    DEF_MOCK_KEYS_NO_DUBLICATE);           \
+  }                                                                        \
+  TEST(suiteName, stringSharedNodePool) {                                  \
+    methodSharedNodePool<std::string>(DEF_STR_KEYS,                        \
+                                      DEF_STR_KEYS_NO_DUBLICATE);          \
+  }
+
+TESTS_SHARED_NODE_POOL(s21Set)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodInsertHint(const std::initializer_list<key_type>& items,
+                      const std::initializer_list<key_type>& insert_items) {
+  std::set<key_type> std_set(items);
+  test_set<key_type> s21_sorted;
+  test_set<key_type> s21_reversed;
+
+  for (auto it = std_set.begin(); it != std_set.end(); ++it)
+    s21_sorted.insert(s21_sorted.end(), *it);
+  for (auto it = std_set.rbegin(); it != std_set.rend(); ++it)
+    s21_reversed.insert(s21_reversed.begin(), *it);
+
+  checkFields(s21_sorted, std_set);
+  checkFields(s21_reversed, std_set);
+
+  for (const auto& item : insert_items) {
+    s21_sorted.insert(s21_sorted.begin(), item);
+    s21_reversed.insert(s21_reversed.end(), item);
+    std_set.insert(item);
+  }
+
+  checkFields(s21_sorted, std_set);
+  checkFields(s21_reversed, std_set);
+
+  auto hint = ++s21_sorted.begin();
+  auto res = s21_sorted.insert(hint, *hint);
+  EXPECT_TRUE(res == hint);
+  checkFields(s21_sorted, std_set);
+}
+
+#define TESTS_INSERT_HINT(suiteName)                                     \
+  TEST(suiteName, intInsertHint) {                                       \
+    methodInsertHint<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                      \
+  TEST(suiteName, doubleInsertHint) {                                    \
+    methodInsertHint<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                      \
+  TEST(suiteName, mockClassInsertHint) {                                 \
+    methodInsertHint<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                      \
+  TEST(suiteName, stringInsertHint) {                                    \
+    methodInsertHint<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_INSERT_HINT(s21Set)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodEmplaceHint(const std::initializer_list<key_type>& items) {
+  std::set<key_type> std_set(items);
+  test_set<key_type> s21_set;
+
+  for (const auto& item : std_set) {
+    auto it = s21_set.emplace_hint(s21_set.end(), item);
+    EXPECT_EQ(*it, item);
+  }
+
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_EMPLACE_HINT(suiteName)                                       \
+  TEST(suiteName, intEmplaceHint) { methodEmplaceHint<int>(DEF_INT_KEYS); } \
+  TEST(suiteName, doubleEmplaceHint) {                                      \
+    methodEmplaceHint<double>(DEF_DBL_KEYS);                                \
+  }                                                                         \
+  TEST(suiteName, mockClassEmplaceHint) {                                   \
+    methodEmplaceHint<MockClass>(DEF_MOCK_KEYS);                            \
+  }                                                                         \
+  TEST(suiteName, stringEmplaceHint) {                                      \
+    methodEmplaceHint<std::string>(DEF_STR_KEYS);                           \
+  }
+
+TESTS_EMPLACE_HINT(s21Set)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodAssignSorted(const std::initializer_list<key_type>& items,
+                        const std::initializer_list<key_type>& insert_items) {
+  std::set<key_type> std_set(items);
+  s21::vector<key_type> sorted;
+  for (const auto& item : std_set) sorted.push_back(item);
+  sorted.push_back(*std_set.rbegin());
+  std_set.insert(*std_set.rbegin());
+
+  test_set<key_type> s21_set(sorted.begin(), sorted.end(), s21::sorted_tag);
+  checkFields(s21_set, std_set);
+
+  for (const auto& item : insert_items) {
+    s21_set.insert(item);
+    std_set.insert(item);
+  }
+  s21_set.erase(s21_set.begin());
+  std_set.erase(std_set.begin());
+  checkFields(s21_set, std_set);
+
+  s21_set.assign(items.begin(), items.end(), s21::sorted_tag);
+  checkFields(s21_set, std::set<key_type>(items));
+}
+
+#define TESTS_ASSIGN_SORTED(suiteName)                                     \
+  TEST(suiteName, intAssignSorted) {                                       \
+    methodAssignSorted<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                        \
+  TEST(suiteName, doubleAssignSorted) {                                    \
+    methodAssignSorted<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                        \
+  TEST(suiteName, mockClassAssignSorted) {                                 \
+    methodAssignSorted<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                        \
+  TEST(suiteName, stringAssignSorted) {                                    \
+    methodAssignSorted<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_ASSIGN_SORTED(s21Set)
+
+// -------------------------------------------------
+
+void bigAssignSorted(int maxSize) {
+  for (int size = 0; size <= maxSize; size++) {
+    s21::vector<int> sorted;
+    std::set<int> std_set;
+    for (int i = 0; i < size; i++) {
+      sorted.push_back(i);
+      std_set.insert(i);
+    }
+
+    test_set<int> s21_set;
+    s21_set.assign(sorted.begin(), sorted.end(), s21::sorted_tag);
+    checkFields(s21_set, std_set);
+
+    for (int i = 0; i < size; i += 3) {
+      if (!s21_set.contains(i)) continue;
+      s21_set.erase(s21_set.find(i));
+      std_set.erase(std_set.find(i));
+    }
+    for (int i = size; i < 2 * size; i += 2) {
+      s21_set.insert(i);
+      std_set.insert(i);
+    }
+    checkFields(s21_set, std_set);
+  }
+}
+
+TEST(s21Set, intBigAssignSorted) { bigAssignSorted(200); }
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodLowerBound(const std::initializer_list<key_type>& items,
+                      const key_type& key, const key_type& key_duplicate) {
+  test_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  EXPECT_EQ(s21_set.lower_bound(key) == s21_set.end(),
+            std_set.lower_bound(key) == std_set.end());
+  EXPECT_EQ(*s21_set.lower_bound(key_duplicate),
+            *std_set.lower_bound(key_duplicate));
+
+  for (const auto& item : std_set) {
+    EXPECT_EQ(std::distance(s21_set.begin(), s21_set.lower_bound(item)),
+              std::distance(std_set.begin(), std_set.lower_bound(item)));
+  }
+}
+
+#define TESTS_LOWER_BOUND(suiteName)                                    \
+  TEST(suiteName, intMethodLowerBound) {                                \
+    methodLowerBound<int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                     \
+  TEST(suiteName, doubleMethodLowerBound) {                             \
+    methodLowerBound<double>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                     \
+  TEST(suiteName, mockClassMethodLowerBound) {                          \
+    methodLowerBound<MockClass>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                MOCK_KEY_DUPLICATE);                    \
+  }                                                                     \
+  TEST(suiteName, stringMethodLowerBound) {                             \
+    methodLowerBound<std::string>(DEF_STR_KEYS, STR_KEY,                \
+                                  STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_LOWER_BOUND(s21Set)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodUpperBound(const std::initializer_list<key_type>& items,
+                      const key_type& key, const key_type& key_duplicate) {
+  test_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+
+  EXPECT_EQ(s21_set.upper_bound(key) == s21_set.end(),
+            std_set.upper_bound(key) == std_set.end());
+  EXPECT_EQ(*(--s21_set.upper_bound(key_duplicate)),
+            *(--std_set.upper_bound(key_duplicate)));
+
+  for (const auto& item : std_set) {
+    EXPECT_EQ(std::distance(s21_set.begin(), s21_set.upper_bound(item)),
+              std::distance(std_set.begin(), std_set.upper_bound(item)));
+  }
+}
+
+#define TESTS_UPPER_BOUND(suiteName)                                    \
+  TEST(suiteName, intMethodUpperBound) {                                \
+    methodUpperBound<int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                     \
+  TEST(suiteName, doubleMethodUpperBound) {                             \
+    methodUpperBound<double>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                     \
+  TEST(suiteName, mockClassMethodUpperBound) {                          \
+    methodUpperBound<MockClass>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                MOCK_KEY_DUPLICATE);                    \
+  }                                                                     \
+  TEST(suiteName, stringMethodUpperBound) {                             \
+    methodUpperBound<std::string>(DEF_STR_KEYS, STR_KEY,                \
+                                  STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_UPPER_BOUND(s21Set)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodEqualRange(const std::initializer_list<key_type>& items,
+                      const key_type& key, const key_type& key_duplicate) {
+  test_set<key_type> s21_set(items);
+
+  EXPECT_TRUE(s21_set.equal_range(key).first == s21_set.lower_bound(key));
+  EXPECT_TRUE(s21_set.equal_range(key).second == s21_set.upper_bound(key));
+  EXPECT_TRUE(s21_set.equal_range(key).first ==
+              s21_set.equal_range(key).second);
+
+  auto range = s21_set.equal_range(key_duplicate);
+  EXPECT_TRUE(range.first == s21_set.find(key_duplicate));
+  EXPECT_TRUE(++range.first == range.second);
+}
+
+#define TESTS_EQUAL_RANGE(suiteName)                                    \
+  TEST(suiteName, intMethodEqualRange) {                                \
+    methodEqualRange<int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                     \
+  TEST(suiteName, doubleMethodEqualRange) {                             \
+    methodEqualRange<double>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                     \
+  TEST(suiteName, mockClassMethodEqualRange) {                          \
+    methodEqualRange<MockClass>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                MOCK_KEY_DUPLICATE);                    \
+  }                                                                     \
+  TEST(suiteName, stringMethodEqualRange) {                             \
+    methodEqualRange<std::string>(DEF_STR_KEYS, STR_KEY,                \
+                                  STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_EQUAL_RANGE(s21Set)
+
+// -------------------------------------------------
+
+void bigBounds(int maxSize) {
+  test_set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < maxSize; i += 2) {
+    s21_set.insert(i);
+    std_set.insert(i);
+  }
+
+  for (int key = -1; key <= maxSize; key++) {
+    EXPECT_EQ(std::distance(s21_set.begin(), s21_set.lower_bound(key)),
+              std::distance(std_set.begin(), std_set.lower_bound(key)));
+    EXPECT_EQ(std::distance(s21_set.begin(), s21_set.upper_bound(key)),
+              std::distance(std_set.begin(), std_set.upper_bound(key)));
+    auto range = s21_set.equal_range(key);
+    EXPECT_EQ(std::distance(range.first, range.second),
+              static_cast<std::ptrdiff_t>(std_set.count(key)));
+  }
+}
+
+TEST(s21Set, intBigBounds) { bigBounds(500); }
+
+// -------------------------------------------------
+
+// The zig-zag case of the insert fixup rotates the new subtree root up to
+// the root of the whole tree on the last key
+TEST(s21Set, intInsertRotationAtRoot) {
+  std::initializer_list<int> items = {14, 0, 68, 99, 57, 62, 80, 37, 33};
+  test_set<int> s21_set;
+  std::set<int> std_set;
+  for (int item : items) {
+    s21_set.insert(item);
+    std_set.insert(item);
+  }
+  checkFields(s21_set, std_set);
+  EXPECT_EQ(*s21_set.begin(), 0);
+  EXPECT_EQ(*(--s21_set.end()), 99);
+}
+
+// -------------------------------------------------
+
+void bigOrderStatistic(int maxSize) {
+  s21::set<int, std::less<int>, s21::order_statistic_policy> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < maxSize; i++) {
+    s21_set.insert(i * 37 % maxSize);
+    std_set.insert(i * 37 % maxSize);
+  }
+  for (int i = 0; i < maxSize; i += 3) {
+    s21_set.erase(s21_set.find(i * 11 % maxSize));
+    std_set.erase(i * 11 % maxSize);
+  }
+  checkFields(s21_set, std_set);
+
+  std::size_t index = 0;
+  for (int key : std_set) {
+    EXPECT_EQ(*s21_set.nth(index), key);
+    EXPECT_EQ(s21_set.rank(key), index);
+    EXPECT_EQ(s21_set.distance(s21_set.begin(), s21_set.find(key)),
+              static_cast<std::ptrdiff_t>(index));
+    index++;
+  }
+  EXPECT_TRUE(s21_set.nth(index) == s21_set.end());
+  EXPECT_EQ(s21_set.rank(maxSize), std_set.size());
+  EXPECT_EQ(s21_set.distance(s21_set.begin(), s21_set.end()),
+            static_cast<std::ptrdiff_t>(std_set.size()));
+}
+
+TEST(s21Set, intBigOrderStatistic) { bigOrderStatistic(500); }
+
+TEST(s21Set, intOrderStatisticAssignSorted) {
+  s21::vector<int> keys;
+  for (int i = 0; i < 100; i++) keys.push_back(i * 2);
+  s21::set<int, std::less<int>, s21::order_statistic_policy> s21_set;
+  s21_set.assign(keys.begin(), keys.end(), s21::sorted_tag);
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    EXPECT_EQ(*s21_set.nth(i), keys[i]);
+    EXPECT_EQ(s21_set.rank(keys[i] + 1), i + 1);
+  }
+}
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodCustomCompare(const std::initializer_list<key_type>& items,
+                         const std::initializer_list<key_type>& insert_items) {
+  test_set<key_type, std::greater<key_type>> s21_set(items);
+  std::set<key_type, std::greater<key_type>> std_set(items);
+  checkFields(s21_set, std_set);
+
+  for (const auto& item : insert_items) {
+    s21_set.insert(item);
+    std_set.insert(item);
+  }
+  checkFields(s21_set, std_set);
+
+  for (const auto& item : std_set) {
+    EXPECT_TRUE(s21_set.contains(item));
+    EXPECT_EQ(*s21_set.find(item), item);
+    EXPECT_EQ(std::distance(s21_set.begin(), s21_set.lower_bound(item)),
+              std::distance(std_set.begin(), std_set.lower_bound(item)));
+  }
+  s21_set.erase(s21_set.begin());
+  std_set.erase(std_set.begin());
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_CUSTOM_COMPARE(suiteName)                                     \
+  TEST(suiteName, intCustomCompare) {                                       \
+    methodCustomCompare<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                         \
+  TEST(suiteName, doubleCustomCompare) {                                    \
+    methodCustomCompare<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                         \
+  TEST(suiteName, mockClassCustomCompare) {                                 \
+    methodCustomCompare<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                         \
+  TEST(suiteName, stringCustomCompare) {                                    \
+    methodCustomCompare<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_CUSTOM_COMPARE(s21Set)
+
+// -------------------------------------------------
+
+// std::string has no implicit constructor from std::string_view, so these
+// lookups compile only through the transparent overloads
+TEST(s21Set, stringTransparentLookup) {
+  test_set<std::string, std::less<>> s21_set(DEF_STR_KEYS);
+  std::set<std::string, std::less<>> std_set(DEF_STR_KEYS);
+
+  for (const auto& item : std_set) {
+    std::string_view key(item);
+    EXPECT_TRUE(s21_set.contains(key));
+    EXPECT_EQ(*s21_set.find(key), item);
+    EXPECT_EQ(*s21_set.lower_bound(key), *std_set.lower_bound(key));
+  }
+  EXPECT_FALSE(s21_set.contains(std::string_view("absent")));
+  EXPECT_TRUE(s21_set.find(std::string_view("absent")) == s21_set.end());
+  EXPECT_TRUE(s21_set.contains("mock"));
+  EXPECT_EQ(*s21_set.lower_bound("i"), "mock");
+}
+
+// -------------------------------------------------
+
+#ifdef S21_NODE_BASED_TREE
+TEST(s21Set, stringNodeStoresKeyOnce) {
+  using set_node = test_set<std::string>::tree_type::Node;
+  using map_node = s21::map<std::string, std::string>::tree_type::Node;
+  EXPECT_EQ(sizeof(map_node) - sizeof(set_node), sizeof(std::string));
+
+  test_set<std::string> s21_set(DEF_STR_KEYS);
+  std::set<std::string> std_set(DEF_STR_KEYS);
+  checkFields(s21_set, std_set);
+}
+#endif
+
+#ifdef S21_NODE_BASED_TREE
+TEST(s21Set, doubleNodePacksColor) {
+  using set_node = test_set<double>::tree_type::Node;
+  EXPECT_EQ(sizeof(set_node), 3 * sizeof(set_node*) + sizeof(double));
+}
+#endif
+
+// -------------------------------------------------
+
+TEST(s21Set, intMovedFromTakesKeys) {
+  test_set<int> s21_set(DEF_INT_KEYS);
+  test_set<int> s21_set_move(std::move(s21_set));
+  std::set<int> std_set;
+  checkFields(s21_set, std_set);
+
+  for (int key : DEF_INT_KEYS_DUBLICATE) {
+    s21_set.insert(key);
+    std_set.insert(key);
+  }
+  checkFields(s21_set, std_set);
+  checkFields(s21_set_move, std::set<int>(DEF_INT_KEYS));
+}
+
+// -------------------------------------------------
+
+#ifdef S21_NODE_BASED_TREE
+TEST(s21Set, copyCounterEmplaceWithoutCopies) {
+  test_set<CopyCounter> s21_set;
+  CopyCounter::reset();
+
+  s21_set.emplace(1);
+  s21_set.emplace(2);
+  s21_set.emplace_hint(s21_set.end(), 3);
+  EXPECT_EQ(CopyCounter::moves, 0);
+
+  s21_set.insert(CopyCounter(4));
+  s21_set.insert(s21_set.end(), CopyCounter(5));
+  s21_set.insert_many(CopyCounter(6), CopyCounter(7));
+  EXPECT_EQ(CopyCounter::moves, 4);
+  EXPECT_EQ(CopyCounter::copies, 0);
+
+  test_set<CopyCounter> copy(s21_set);
+  EXPECT_EQ(CopyCounter::copies, 7);
+  EXPECT_EQ(copy.size(), 7U);
+  EXPECT_EQ((*copy.begin()).value(), 1);
+}
+#endif
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodExtract(const std::initializer_list<key_type>& items) {
+  test_set<key_type> s21_set(items);
+  std::set<key_type> std_set(items);
+  test_set<key_type> s21_copy(s21_set);
+
+  auto s21_first = s21_set.extract(s21_set.begin());
+  auto std_first = std_set.extract(std_set.begin());
+  EXPECT_EQ(s21_first.value(), std_first.value());
+  checkFields(s21_set, std_set);
+
+  key_type last = *std_set.rbegin();
+  auto s21_last = s21_set.extract(last);
+  auto std_last = std_set.extract(last);
+  EXPECT_EQ(s21_last.value(), std_last.value());
+  EXPECT_TRUE(s21_set.extract(last).empty());
+  checkFields(s21_set, std_set);
+
+  // The key is already there, so the node stays in the handle
+  EXPECT_FALSE(s21_copy.insert(std::move(s21_last)).second);
+  EXPECT_FALSE(s21_last.empty());
+  EXPECT_EQ(s21_copy.size(), std_set.size() + 2);
+
+  EXPECT_TRUE(s21_set.insert(std::move(s21_first)).second);
+  EXPECT_TRUE(s21_first.empty());
+  EXPECT_TRUE(s21_set.insert(std::move(s21_last)).second);
+  std_set.insert(std::move(std_first));
+  std_set.insert(std::move(std_last));
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_EXTRACT(suiteName)                                          \
+  TEST(suiteName, intExtract) { methodExtract<int>(DEF_INT_KEYS); }       \
+  TEST(suiteName, doubleExtract) { methodExtract<double>(DEF_DBL_KEYS); } \
+  TEST(suiteName, mockClassExtract) {                                     \
+    methodExtract<MockClass>(DEF_MOCK_KEYS);                              \
+  }                                                                       \
+  TEST(suiteName, stringExtract) {                                        \
+    methodExtract<std::string>(DEF_STR_KEYS);                             \
+  }
+
+TESTS_EXTRACT(s21Set)
+
+// -------------------------------------------------
+
+#ifdef S21_NODE_BASED_TREE
+// The sets were given one pool, so the nodes are relinked as they are
+TEST(s21Set, copyCounterMergeSplicesNodes) {
+  test_set<CopyCounter> s21_set{1, 3, 5};
+  test_set<CopyCounter> s21_other(s21_set.get_node_pool());
+  for (int key : {2, 3, 4, 6}) s21_other.emplace(key);
+  const CopyCounter* two = &*s21_other.begin();
+  CopyCounter::reset();
+
+  s21_set.merge(s21_other);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(CopyCounter::moves, 0);
+  EXPECT_EQ(s21_set.size(), 6U);
+  EXPECT_EQ(s21_other.size(), 1U);
+  EXPECT_EQ((*s21_other.begin()).value(), 3);
+  EXPECT_EQ(&*s21_set.find(CopyCounter(2)), two);
+}
+
+// Each set keeps its own pool, the keys are moved into new nodes
+TEST(s21Set, copyCounterMergeKeepsPoolsApart) {
+  test_set<CopyCounter> s21_set{1, 3, 5};
+  test_set<CopyCounter> s21_other{2, 3, 4, 6};
+  auto pool = s21_set.get_node_pool();
+  auto otherPool = s21_other.get_node_pool();
+  CopyCounter::reset();
+
+  s21_set.merge(s21_other);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(CopyCounter::moves, 3);
+  EXPECT_EQ(s21_set.size(), 6U);
+  EXPECT_EQ(s21_other.size(), 1U);
+  EXPECT_EQ(s21_set.get_node_pool(), pool);
+  EXPECT_EQ(s21_other.get_node_pool(), otherPool);
+  EXPECT_NE(s21_set.get_node_pool(), s21_other.get_node_pool());
+
+  // Neither pool gained slots from the other one
+  EXPECT_EQ(otherPool->capacity() - otherPool->available(), 1U);
+  EXPECT_EQ(pool->capacity() - pool->available(), 6U);
+}
+
+TEST(s21Set, copyCounterNodeOutlivesSet) {
+  test_set<CopyCounter>::node_type node;
+  {
+    test_set<CopyCounter> s21_source{1, 2, 3};
+    node = s21_source.extract(CopyCounter(2));
+  }
+  test_set<CopyCounter> s21_set{4};
+  auto pool = s21_set.get_node_pool();
+  CopyCounter::reset();
+
+  EXPECT_TRUE(s21_set.insert(std::move(node)).second);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(CopyCounter::moves, 1);
+  EXPECT_EQ((*s21_set.begin()).value(), 2);
+  EXPECT_EQ(s21_set.size(), 2U);
+  EXPECT_EQ(s21_set.get_node_pool(), pool);
+}
+#endif
+
+// Both pools are used by further sets, so the keys are moved into new nodes
+TEST(s21Set, stringMergeSharedPools) {
+  test_set<std::string> s21_set(DEF_STR_KEYS);
+  test_set<std::string> s21_other(DEF_STR_KEYS_DUBLICATE);
+  test_set<std::string> s21_set_neighbour(s21_set.get_node_pool());
+  test_set<std::string> s21_other_neighbour(s21_other.get_node_pool());
+  std::set<std::string> std_set(DEF_STR_KEYS);
+  std::set<std::string> std_other(DEF_STR_KEYS_DUBLICATE);
+
+  s21_set.merge(s21_other);
+  std_set.merge(std_other);
+  checkFields(s21_set, std_set);
+  checkFields(s21_other, std_other);
+  EXPECT_NE(s21_set.get_node_pool(), s21_other.get_node_pool());
+
+  s21_set_neighbour.insert("neighbour");
+  s21_other_neighbour.insert("neighbour");
+  EXPECT_EQ(s21_set_neighbour.size(), 1U);
+}
+
+// -------------------------------------------------
+
+template <typename key_type>
+void checkSetAlgebra(const test_set<key_type>& lhs,
+                     const test_set<key_type>& rhs) {
+  std::set<key_type> std_lhs(lhs.begin(), lhs.end());
+  std::set<key_type> std_rhs(rhs.begin(), rhs.end());
+  std::set<key_type> expected;
+
+  std::set_union(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                 std_rhs.end(), std::inserter(expected, expected.end()));
+  checkFields(s21::set_union(lhs, rhs), expected);
+
+  expected.clear();
+  std::set_intersection(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                        std_rhs.end(), std::inserter(expected, expected.end()));
+  checkFields(s21::set_intersection(lhs, rhs), expected);
+
+  expected.clear();
+  std::set_difference(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                      std_rhs.end(), std::inserter(expected, expected.end()));
+  checkFields(s21::set_difference(lhs, rhs), expected);
+
+  expected.clear();
+  std::set_symmetric_difference(std_lhs.begin(), std_lhs.end(),
+                                std_rhs.begin(), std_rhs.end(),
+                                std::inserter(expected, expected.end()));
+  checkFields(s21::set_symmetric_difference(lhs, rhs), expected);
+}
+
+template <typename key_type>
+void methodSetAlgebra(const std::initializer_list<key_type>& items,
+                      const std::initializer_list<key_type>& other_items) {
+  test_set<key_type> s21_set(items);
+  test_set<key_type> s21_other(other_items);
+  test_set<key_type> s21_empty;
+
+  checkSetAlgebra(s21_set, s21_other);
+  checkSetAlgebra(s21_other, s21_set);
+  checkSetAlgebra(s21_set, s21_set);
+  checkSetAlgebra(s21_set, s21_empty);
+  checkSetAlgebra(s21_empty, s21_set);
+}
+
+#define TESTS_SET_ALGEBRA(suiteName)                                     \
+  TEST(suiteName, intSetAlgebra) {                                       \
+    methodSetAlgebra<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                      \
+  TEST(suiteName, doubleSetAlgebra) {                                    \
+    methodSetAlgebra<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                      \
+  TEST(suiteName, mockClassSetAlgebra) {                                 \
+    methodSetAlgebra<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                      \
+  TEST(suiteName, stringSetAlgebra) {                                    \
+    methodSetAlgebra<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_SET_ALGEBRA(s21Set)
+
+TEST(s21Set, intBigSetAlgebra) {
+  test_set<int> s21_set;
+  test_set<int> s21_other;
+  for (int i = 0; i < 3000; i++) s21_set.insert(i * 37 % 3000 * 2);
+  for (int i = 0; i < 2000; i++) s21_other.insert(i * 11 % 2000 * 3);
+  checkSetAlgebra(s21_set, s21_other);
+}
+
+// -------------------------------------------------
+
+using threaded_set = s21::set<int, std::less<int>, s21::threaded_tree_policy>;
+
+void checkThreadedLinks(threaded_set& s21_set, const std::set<int>& std_set) {
+  checkFields(s21_set, std_set);
+  auto std_it = std_set.rbegin();
+  for (auto it = s21_set.end(); it != s21_set.begin(); ++std_it)
+    EXPECT_EQ(*--it, *std_it);
+  EXPECT_TRUE(std_it == std_set.rend());
+}
+
+void bigThreaded(int maxSize) {
+  threaded_set s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < maxSize; i++) {
+    s21_set.insert(i * 37 % maxSize);
+    std_set.insert(i * 37 % maxSize);
+  }
+  for (int i = maxSize; i < 2 * maxSize; i += 2) {
+    s21_set.insert(s21_set.end(), i);
+    std_set.insert(std_set.end(), i);
+  }
+  checkThreadedLinks(s21_set, std_set);
+
+  for (int i = 0; i < maxSize; i += 3) {
+    s21_set.erase(s21_set.find(i * 11 % maxSize));
+    std_set.erase(i * 11 % maxSize);
+  }
+  checkThreadedLinks(s21_set, std_set);
+
+  threaded_set s21_other;
+  std::set<int> std_other;
+  for (int i = 0; i < maxSize; i++) {
+    s21_other.insert(i * 7 % (3 * maxSize));
+    std_other.insert(i * 7 % (3 * maxSize));
+  }
+  s21_set.merge(s21_other);
+  std_set.merge(std_other);
+  checkThreadedLinks(s21_set, std_set);
+  checkThreadedLinks(s21_other, std_other);
+
+  auto node = s21_set.extract(std::prev(s21_set.end()));
+  int greatest = *std_set.rbegin();
+  std_set.erase(greatest);
+  checkThreadedLinks(s21_set, std_set);
+  s21_set.insert(std::move(node));
+  std_set.insert(greatest);
+  checkThreadedLinks(s21_set, std_set);
+
+  std::vector<int> sorted(std_set.begin(), std_set.end());
+  threaded_set s21_built(sorted.begin(), sorted.end(), s21::sorted_tag);
+  checkThreadedLinks(s21_built, std_set);
+
+  // end() closes the list between the greatest and the least key
+  EXPECT_TRUE(++s21_built.end() == s21_built.begin());
+
+  s21_built.clear();
+  checkThreadedLinks(s21_built, std::set<int>());
+  s21_built.insert(1);
+  checkThreadedLinks(s21_built, std::set<int>{1});
+}
+
+TEST(s21Set, intBigThreaded) { bigThreaded(500); }
+
+}  // namespace
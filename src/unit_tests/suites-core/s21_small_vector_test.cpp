@@ -0,0 +1,313 @@
+#include "core/s21_small_vector.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "s21_core_tests.h"
+
+#define DEF_INT_VALS \
+  { 1, 2, 3, 4, 8 }
+#define DEF_DBL_VALS \
+  { 4.35, 2.977, 873.23, 6.875, 9.6534 }
+#define DEF_MOCK_VALS \
+  { 1, 4, 44, 45, 88 }
+#define DEF_STR_VALS \
+  { "hello", "world", "!", "mock", "vector" }
+
+template <typename T>
+using test_vector = s21::small_vector<T, 4>;
+
+// Whether the elements sit in the inline buffer of the vector itself
+template <typename T, std::size_t N, typename Growth>
+bool isInline(const s21::small_vector<T, N, Growth>& actual) {
+  const void* data = actual.data();
+  return data >= static_cast<const void*>(&actual) &&
+         data < static_cast<const void*>(&actual + 1);
+}
+
+template <typename T, std::size_t N, typename Growth>
+void checkFields(const s21::small_vector<T, N, Growth>& actual,
+                 const std::vector<T>& expected) {
+  EXPECT_EQ(actual.size(), expected.size());
+  EXPECT_EQ(actual.empty(), expected.empty());
+  EXPECT_GE(actual.capacity(), actual.size());
+  EXPECT_GE(actual.capacity(), N);
+  EXPECT_EQ(isInline(actual), actual.capacity() == N);
+  if (actual.size() == expected.size()) {
+    EXPECT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin()));
+  }
+}
+
+template <typename T>
+test_vector<T> makeVector(const std::vector<T>& items) {
+  test_vector<T> res;
+  res.insert(res.end(), items.begin(), items.end());
+  return res;
+}
+
+// -------------------------------------------------
+// -------------------------------------------------
+// -------------------------------------------------
+
+template <typename T>
+void constructorsTest(const std::initializer_list<T>& items) {
+  test_vector<T> empty;
+  checkFields(empty, std::vector<T>());
+
+  test_vector<T> sized(3);
+  checkFields(sized, std::vector<T>(3));
+  test_vector<T> sizedBig(9);
+  checkFields(sizedBig, std::vector<T>(9));
+
+  test_vector<T> actual(items);
+  std::vector<T> expected(items);
+  checkFields(actual, expected);
+
+  test_vector<T> copy(actual);
+  checkFields(copy, expected);
+  checkFields(actual, expected);
+
+  test_vector<T> moved(std::move(copy));
+  checkFields(moved, expected);
+  checkFields(copy, std::vector<T>());
+}
+
+#define TESTS_CONSTRUCTORS(suiteName)                                       \
+  TEST(suiteName, intConstructors) { constructorsTest<int>(DEF_INT_VALS); } \
+  TEST(suiteName, doubleConstructors) {                                     \
+    constructorsTest<double>(DEF_DBL_VALS);                                 \
+  }                                                                         \
+  TEST(suiteName, MockClassConstructors) {                                  \
+    constructorsTest<MockClass>(DEF_MOCK_VALS);                             \
+  }                                                                         \
+  TEST(suiteName, stringConstructors) {                                     \
+    constructorsTest<std::string>(DEF_STR_VALS);                            \
+  }
+
+TESTS_CONSTRUCTORS(s21SmallVector)
+
+// -------------------------------------------------
+
+template <typename T>
+void pushBackSpillTest(const std::initializer_list<T>& items) {
+  test_vector<T> actual;
+  std::vector<T> expected;
+
+  for (std::size_t i = 0; i < 4; i++) {
+    actual.push_back(*(items.begin() + i));
+    expected.push_back(*(items.begin() + i));
+  }
+  checkFields(actual, expected);
+  EXPECT_TRUE(isInline(actual));
+
+  for (std::size_t i = 0; i < 20; i++) {
+    actual.push_back(*(items.begin() + i % items.size()));
+    expected.push_back(*(items.begin() + i % items.size()));
+  }
+  checkFields(actual, expected);
+  EXPECT_FALSE(isInline(actual));
+
+  while (expected.size() > 3) {
+    actual.pop_back();
+    expected.pop_back();
+  }
+  actual.shrink_to_fit();
+  checkFields(actual, expected);
+  EXPECT_TRUE(isInline(actual));
+}
+
+#define TESTS_PUSH_BACK_SPILL(suiteName)          \
+  TEST(suiteName, intPushBackSpill) {             \
+    pushBackSpillTest<int>(DEF_INT_VALS);         \
+  }                                               \
+  TEST(suiteName, doublePushBackSpill) {          \
+    pushBackSpillTest<double>(DEF_DBL_VALS);      \
+  }                                               \
+  TEST(suiteName, MockClassPushBackSpill) {       \
+    pushBackSpillTest<MockClass>(DEF_MOCK_VALS);  \
+  }                                               \
+  TEST(suiteName, stringPushBackSpill) {          \
+    pushBackSpillTest<std::string>(DEF_STR_VALS); \
+  }
+
+TESTS_PUSH_BACK_SPILL(s21SmallVector)
+
+// -------------------------------------------------
+
+template <typename T>
+void insertEraseTest(const std::initializer_list<T>& items) {
+  test_vector<T> actual;
+  std::vector<T> expected;
+  std::mt19937 gen(7);
+
+  for (std::size_t i = 0; i < 40; i++) {
+    const T& value = *(items.begin() + i % items.size());
+    std::size_t pos = expected.empty() ? 0 : gen() % (expected.size() + 1);
+    actual.insert(actual.begin() + int(pos), value);
+    expected.insert(expected.begin() + pos, value);
+  }
+  checkFields(actual, expected);
+
+  for (std::size_t i = 0; i < 38; i++) {
+    std::size_t pos = gen() % expected.size();
+    actual.erase(actual.begin() + int(pos));
+    expected.erase(expected.begin() + pos);
+  }
+  checkFields(actual, expected);
+
+  actual.insert(actual.begin() + 1, items.begin(), items.end());
+  expected.insert(expected.begin() + 1, items.begin(), items.end());
+  actual.insert(actual.end(), 2, *items.begin());
+  expected.insert(expected.end(), 2, *items.begin());
+  actual.insert_many(actual.begin(), *items.begin(), *(items.end() - 1));
+  expected.insert(expected.begin(), {*items.begin(), *(items.end() - 1)});
+  actual.insert_many_back(*(items.begin() + 2));
+  expected.push_back(*(items.begin() + 2));
+  checkFields(actual, expected);
+}
+
+#define TESTS_INSERT_ERASE(suiteName)                                     \
+  TEST(suiteName, intInsertErase) { insertEraseTest<int>(DEF_INT_VALS); } \
+  TEST(suiteName, doubleInsertErase) {                                    \
+    insertEraseTest<double>(DEF_DBL_VALS);                                \
+  }                                                                       \
+  TEST(suiteName, MockClassInsertErase) {                                 \
+    insertEraseTest<MockClass>(DEF_MOCK_VALS);                            \
+  }                                                                       \
+  TEST(suiteName, stringInsertErase) {                                    \
+    insertEraseTest<std::string>(DEF_STR_VALS);                           \
+  }
+
+TESTS_INSERT_ERASE(s21SmallVector)
+
+// -------------------------------------------------
+
+template <typename T>
+void swapAssignTest(const std::initializer_list<T>& items) {
+  std::vector<T> small(items.begin(), items.begin() + 2);
+  std::vector<T> big;
+  for (std::size_t i = 0; i < 10; i++) {
+    big.push_back(*(items.begin() + i % items.size()));
+  }
+
+  test_vector<T> first = makeVector(small);
+  test_vector<T> second = makeVector(big);
+  first.swap(second);
+  checkFields(first, big);
+  checkFields(second, small);
+
+  test_vector<T> third = makeVector(big);
+  third.swap(first);
+  checkFields(first, big);
+  checkFields(third, big);
+  second.swap(second);
+  checkFields(second, small);
+
+  first = second;
+  checkFields(first, small);
+  second = third;
+  checkFields(second, big);
+  third = std::move(first);
+  checkFields(third, small);
+  checkFields(first, std::vector<T>());
+  first = std::move(second);
+  checkFields(first, big);
+}
+
+#define TESTS_SWAP_ASSIGN(suiteName)                                    \
+  TEST(suiteName, intSwapAssign) { swapAssignTest<int>(DEF_INT_VALS); } \
+  TEST(suiteName, doubleSwapAssign) {                                   \
+    swapAssignTest<double>(DEF_DBL_VALS);                               \
+  }                                                                     \
+  TEST(suiteName, MockClassSwapAssign) {                                \
+    swapAssignTest<MockClass>(DEF_MOCK_VALS);                           \
+  }                                                                     \
+  TEST(suiteName, stringSwapAssign) {                                   \
+    swapAssignTest<std::string>(DEF_STR_VALS);                          \
+  }
+
+TESTS_SWAP_ASSIGN(s21SmallVector)
+
+// -------------------------------------------------
+
+TEST(s21SmallVector, reserveAndShrink) {
+  s21::small_vector<int, 8> actual{1, 2, 3};
+
+  actual.reserve(5);
+  EXPECT_EQ(actual.capacity(), 8U);
+  EXPECT_TRUE(isInline(actual));
+
+  actual.reserve_exact(100);
+  EXPECT_EQ(actual.capacity(), 100U);
+  EXPECT_FALSE(isInline(actual));
+
+  actual.insert_many_back(4, 5, 6, 7, 8, 9, 10);
+  actual.shrink_to_fit();
+  EXPECT_EQ(actual.capacity(), 10U);
+  EXPECT_FALSE(isInline(actual));
+
+  actual.erase(actual.begin());
+  actual.erase(actual.begin());
+  actual.shrink_to_fit();
+  EXPECT_EQ(actual.capacity(), 8U);
+  EXPECT_TRUE(isInline(actual));
+  EXPECT_EQ(actual, (s21::small_vector<int, 8>{3, 4, 5, 6, 7, 8, 9, 10}));
+}
+
+TEST(s21SmallVector, accessOutOfRange) {
+  test_vector<int> actual{1, 2};
+  const test_vector<int>& constActual = actual;
+
+  EXPECT_EQ(actual.at(1), 2);
+  EXPECT_EQ(constActual.at(0), 1);
+  EXPECT_EQ(actual.front(), 1);
+  EXPECT_EQ(actual.back(), 2);
+  EXPECT_THROW(actual.at(2), std::out_of_range);
+  EXPECT_THROW(constActual.at(2), std::out_of_range);
+  EXPECT_THROW(actual.insert(actual.begin() + 3, 1, 5), std::out_of_range);
+
+  actual.clear();
+  EXPECT_TRUE(actual.empty());
+  EXPECT_THROW(actual.pop_back(), std::out_of_range);
+}
+
+TEST(s21SmallVector, copyCounterMovesInlineOnly) {
+  test_vector<CopyCounter> inlined;
+  inlined.emplace_back(1);
+  inlined.emplace_back(2);
+  test_vector<CopyCounter> spilled;
+  for (int i = 0; i < 6; i++) spilled.emplace_back(i);
+  CopyCounter::reset();
+
+  test_vector<CopyCounter> fromInline(std::move(inlined));
+  EXPECT_EQ(CopyCounter::moves, 2);
+  test_vector<CopyCounter> fromHeap(std::move(spilled));
+  EXPECT_EQ(CopyCounter::moves, 2);
+
+  fromInline.push_back(fromInline[0]);
+  fromInline.emplace(fromInline.begin(), 0);
+  EXPECT_EQ(CopyCounter::copies, 1);
+  EXPECT_EQ(fromInline[3].value(), 1);
+  EXPECT_EQ(fromHeap.size(), 6U);
+}
+
+TEST(s21SmallVector, ownElementsSurviveSpill) {
+  test_vector<std::string> actual{"first", "second", "third", "fourth"};
+
+  actual.push_back(actual[0]);
+  actual.insert_many(actual.begin(), actual[4], actual.back());
+
+  EXPECT_EQ(actual, (test_vector<std::string>{"first", "first", "first",
+                                              "second", "third", "fourth",
+                                              "first"}));
+}
+
+TEST(s21SmallVector, asContainer) {
+  s21::IContainer* ct = new test_vector<std::string>{"a", "b"};
+
+  EXPECT_EQ(ct->size(), 2U);
+  EXPECT_FALSE(ct->empty());
+
+  delete ct;
+}
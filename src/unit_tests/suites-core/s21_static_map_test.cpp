@@ -0,0 +1,197 @@
+#include "core/s21_static_map.h"
+
+#include <map>
+#include <random>
+
+#include "s21_core_tests.h"
+
+#define DEF_INT_KEYS                          \
+  {                                           \
+    {1, 2}, {2, 4}, {3, 69}, {4, 4}, { 8, 6 } \
+  }
+#define DEF_DBL_KEYS                                                   \
+  {                                                                    \
+    {4.35, 321}, {2.977, 12}, {873.23, 6}, {6.875, 69}, { 9.6534, 98 } \
+  }
+#define DEF_MOCK_KEYS                              \
+  {                                                \
+    {1, 542}, {4, 5}, {44, 69}, {45, 6}, { 88, 4 } \
+  }
+#define DEF_STR_KEYS                                                 \
+  {                                                                  \
+    {"hello", 2}, {"world", 4}, {"!", 69}, {"mock", 6}, { "set", 4 } \
+  }
+
+#define DEF_MOCK_KEYS_DUBLICATE                     \
+  {                                                 \
+    {1, 542}, {9, 5}, {10, 3}, {45, 6}, { 10, 123 } \
+  }
+
+#define INT_KEY 69
+#define DBL_KEY 69.69
+#define MOCK_KEY 69
+#define STR_KEY "69"
+
+#define INT_KEY_DUPLICATE 3
+#define DBL_KEY_DUPLICATE 6.875
+#define MOCK_KEY_DUPLICATE 44
+#define STR_KEY_DUPLICATE "!"
+
+template <typename key_type, typename mapped_type, typename compare_type>
+void checkFields(
+    const s21::static_map<key_type, mapped_type, compare_type>& s21_map,
+    const std::map<key_type, mapped_type, compare_type>& std_map) {
+  auto std_it = std_map.begin();
+  for (auto s21_it : s21_map) {
+    EXPECT_EQ(s21_it.first, (*std_it).first);
+    EXPECT_EQ(s21_it.second, (*std_it).second);
+
+    ++std_it;
+  }
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_EQ(s21_map.empty(), std_map.empty());
+}
+
+// -------------------------------------------------
+// -------------------------------------------------
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void constructorDefaultAsCont() {
+  s21::IContainer* ct = new s21::static_map<key_type, mapped_type>();
+
+  EXPECT_EQ(ct->size(), 0);
+  EXPECT_TRUE(ct->empty());
+
+  delete ct;
+}
+
+#define TESTS_CONSTRUCTOR_INIT_AS_CONT(suiteName)                          \
+  TEST(suiteName, intInitAsCont) { constructorDefaultAsCont<int, int>(); } \
+  TEST(suiteName, doubleInitAsCont) {                                      \
+    constructorDefaultAsCont<double, int>();                               \
+  }                                                                        \
+  TEST(suiteName, mockClassInitAsCont) {                                   \
+    constructorDefaultAsCont<MockClass, int>();                            \
+  }                                                                        \
+  TEST(suiteName, stringInitAsCont) {                                      \
+    constructorDefaultAsCont<std::string, int>();                          \
+  }
+
+TESTS_CONSTRUCTOR_INIT_AS_CONT(s21StaticMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodFreeze(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>& items,
+    const key_type& key, const key_type& key_duplicate) {
+  s21::map<key_type, mapped_type> s21_source(items);
+  std::map<key_type, mapped_type> std_map(items);
+
+  auto s21_map = s21::freeze(s21_source);
+  checkFields(s21_map, std_map);
+
+  EXPECT_TRUE(s21_map.contains(key_duplicate));
+  EXPECT_FALSE(s21_map.contains(key));
+  EXPECT_EQ(s21_map.at(key_duplicate), std_map.at(key_duplicate));
+  EXPECT_THROW(s21_map.at(key), std::out_of_range);
+  EXPECT_EQ((*s21_map.find(key_duplicate)).first, key_duplicate);
+  EXPECT_EQ(s21_map.find(key), s21_map.end());
+}
+
+#define TESTS_FREEZE(suiteName)                                          \
+  TEST(suiteName, intFreeze) {                                           \
+    methodFreeze<int, int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);    \
+  }                                                                      \
+  TEST(suiteName, doubleFreeze) {                                        \
+    methodFreeze<double, int>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE); \
+  }                                                                      \
+  TEST(suiteName, mockClassFreeze) {                                     \
+    methodFreeze<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY,                \
+                                 MOCK_KEY_DUPLICATE);                    \
+  }                                                                      \
+  TEST(suiteName, stringFreeze) {                                        \
+    methodFreeze<std::string, int>(DEF_STR_KEYS, STR_KEY,                \
+                                   STR_KEY_DUPLICATE);                   \
+  }
+
+TESTS_FREEZE(s21StaticMap)
+
+// -------------------------------------------------
+
+// An unsorted range keeps the first pair of every key, as std::map does
+template <typename key_type, typename mapped_type>
+void constructorRange(
+    const std::initializer_list<std::pair<const key_type, mapped_type>>&
+        items) {
+  s21::static_map<key_type, mapped_type> s21_map(items.begin(), items.end());
+  std::map<key_type, mapped_type> std_map(items);
+
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_CONSTRUCTOR_RANGE(suiteName)                                \
+  TEST(suiteName, intRange) { constructorRange<int, int>(DEF_INT_KEYS); } \
+  TEST(suiteName, doubleRange) {                                          \
+    constructorRange<double, int>(DEF_DBL_KEYS);                          \
+  }                                                                       \
+  TEST(suiteName, mockClassRange) {                                       \
+    constructorRange<MockClass, int>(DEF_MOCK_KEYS_DUBLICATE);            \
+  }                                                                       \
+  TEST(suiteName, stringRange) {                                          \
+    constructorRange<std::string, int>(DEF_STR_KEYS);                     \
+  }
+
+TESTS_CONSTRUCTOR_RANGE(s21StaticMap)
+
+// -------------------------------------------------
+
+// Every tree shape up to 5 levels, probed around and between all keys
+TEST(s21StaticMap, intAllShapes) {
+  for (int count = 0; count < 64; ++count) {
+    s21::map<int, int> s21_source;
+    std::map<int, int> std_map;
+    for (int i = 0; i < count; ++i) {
+      s21_source.insert(2 * i, i);
+      std_map.insert(std::make_pair(2 * i, i));
+    }
+    s21::static_map<int, int> s21_map(s21_source);
+    checkFields(s21_map, std_map);
+
+    for (int key = -1; key <= 2 * count; ++key) {
+      auto s21_it = s21_map.lower_bound(key);
+      auto std_it = std_map.lower_bound(key);
+      if (std_it == std_map.end()) {
+        EXPECT_EQ(s21_it, s21_map.end());
+      } else {
+        ASSERT_NE(s21_it, s21_map.end());
+        EXPECT_EQ((*s21_it).first, std_it->first);
+      }
+      EXPECT_EQ(s21_map.contains(key), std_map.count(key) == 1);
+    }
+  }
+}
+
+TEST(s21StaticMap, intBigRandom) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 100000);
+  s21::map<int, int> s21_source;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 5000; ++i) {
+    int item = key(gen);
+    s21_source.insert(item, i);
+    std_map.insert(std::make_pair(item, i));
+  }
+
+  auto s21_map = s21::freeze(s21_source);
+  checkFields(s21_map, std_map);
+  for (int i = 0; i < 5000; ++i) {
+    int item = key(gen);
+    auto std_it = std_map.find(item);
+    if (std_it == std_map.end())
+      EXPECT_THROW(s21_map.at(item), std::out_of_range);
+    else
+      EXPECT_EQ(s21_map.at(item), std_it->second);
+  }
+}
@@ -0,0 +1,586 @@
+#include "core/s21_unordered_map.h"
+
+#include <random>
+#include <string_view>
+#include <unordered_map>
+
+#include "s21_core_tests.h"
+
+#define DEF_INT_KEYS                          \
+  {                                           \
+    {1, 2}, {2, 4}, {3, 69}, {4, 4}, { 8, 6 } \
+  }
+#define DEF_DBL_KEYS                                                   \
+  {                                                                    \
+    {4.35, 321}, {2.977, 12}, {873.23, 6}, {6.875, 69}, { 9.6534, 98 } \
+  }
+#define DEF_MOCK_KEYS                              \
+  {                                                \
+    {1, 542}, {4, 5}, {44, 69}, {45, 6}, { 88, 4 } \
+  }
+#define DEF_STR_KEYS                                                 \
+  {                                                                  \
+    {"hello", 2}, {"world", 4}, {"!", 69}, {"mock", 6}, { "set", 4 } \
+  }
+
+#define DEF_INT_KEYS_DUBLICATE                \
+  {                                           \
+    {6, 2}, {2, 4}, {3, 5}, {8, 6}, { 10, 0 } \
+  }
+#define DEF_DBL_KEYS_DUBLICATE                                         \
+  {                                                                    \
+    {5.41, 321}, {2.977, 12}, {873.23, 6}, {6.875, 0}, { 123.123, 98 } \
+  }
+#define DEF_MOCK_KEYS_DUBLICATE                     \
+  {                                                 \
+    {1, 542}, {9, 5}, {10, 3}, {45, 6}, { 10, 123 } \
+  }
+#define DEF_STR_KEYS_DUBLICATE                                          \
+  {                                                                     \
+    {"hello", 2}, {"test", 4}, {"!!!", 8}, {"this", 2}, { "mock", 564 } \
+  }
+
+#define INT_KEY 69
+#define DBL_KEY 69.69
+#define MOCK_KEY 69
+#define STR_KEY "69"
+
+#define INT_KEY_DUPLICATE 3
+#define DBL_KEY_DUPLICATE 6.875
+#define MOCK_KEY_DUPLICATE 44
+#define STR_KEY_DUPLICATE "!"
+
+#define INT_OBJ 69
+#define DBL_OBJ 69
+#define MOCK_OBJ 69
+#define STR_OBJ 69
+
+// MockClass has no std::hash. All its keys hash alike, so every lookup
+// goes through the full chain of colliding keys.
+template <typename key_type>
+struct TestHash : std::hash<key_type> {};
+template <>
+struct TestHash<MockClass> {
+  std::size_t operator()(const MockClass&) const { return 0; }
+};
+
+template <typename key_type, typename mapped_type>
+using test_map = s21::unordered_map<key_type, mapped_type, TestHash<key_type>>;
+template <typename key_type, typename mapped_type>
+using std_test_map =
+    std::unordered_map<key_type, mapped_type, TestHash<key_type>>;
+
+template <typename key_type, typename mapped_type>
+using init_items =
+    std::initializer_list<std::pair<const key_type, mapped_type>>;
+
+// The order of the pairs is unspecified, so each one is looked up
+template <typename key_type, typename mapped_type, typename hash_type>
+void checkFields(
+    const s21::unordered_map<key_type, mapped_type, hash_type>& s21_map,
+    const std::unordered_map<key_type, mapped_type, hash_type>& std_map) {
+  std::size_t count = 0;
+  for (const auto& s21_item : s21_map) {
+    auto std_it = std_map.find(s21_item.first);
+    ASSERT_NE(std_it, std_map.end());
+    EXPECT_EQ(s21_item.second, std_it->second);
+    ++count;
+  }
+  EXPECT_EQ(count, std_map.size());
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_EQ(s21_map.empty(), std_map.empty());
+  EXPECT_LE(s21_map.load_factor(), s21_map.max_load_factor());
+}
+
+// -------------------------------------------------
+// -------------------------------------------------
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void constructorDefaultAsCont() {
+  s21::IContainer* ct = new test_map<key_type, mapped_type>();
+
+  EXPECT_EQ(ct->size(), 0);
+  EXPECT_TRUE(ct->empty());
+
+  delete ct;
+}
+
+#define TESTS_CONSTRUCTOR_INIT_AS_CONT(suiteName)                          \
+  TEST(suiteName, intInitAsCont) { constructorDefaultAsCont<int, int>(); } \
+  TEST(suiteName, doubleInitAsCont) {                                      \
+    constructorDefaultAsCont<double, int>();                               \
+  }                                                                        \
+  TEST(suiteName, mockClassInitAsCont) {                                   \
+    constructorDefaultAsCont<MockClass, int>();                            \
+  }                                                                        \
+  TEST(suiteName, stringInitAsCont) {                                      \
+    constructorDefaultAsCont<std::string, int>();                          \
+  }
+
+TESTS_CONSTRUCTOR_INIT_AS_CONT(s21UnorderedMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void constructorInitList(const init_items<key_type, mapped_type>& items,
+                         const init_items<key_type, mapped_type>& dublicates) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std_test_map<key_type, mapped_type> std_map(items.begin(), items.end());
+  checkFields(s21_map, std_map);
+
+  // The first pair of a key wins, as with std::unordered_map
+  test_map<key_type, mapped_type> s21_map_dublicate(dublicates);
+  std_test_map<key_type, mapped_type> std_map_dublicate(dublicates.begin(),
+                                                        dublicates.end());
+  checkFields(s21_map_dublicate, std_map_dublicate);
+
+  test_map<key_type, mapped_type> s21_map_range(std_map.begin(),
+                                                std_map.end());
+  checkFields(s21_map_range, std_map);
+}
+
+#define TESTS_CONSTRUCTOR_INIT_LIST(suiteName)                           \
+  TEST(suiteName, intInitList) {                                         \
+    constructorInitList<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE); \
+  }                                                                      \
+  TEST(suiteName, doubleInitList) {                                      \
+    constructorInitList<double, int>(DEF_DBL_KEYS,                       \
+                                     DEF_DBL_KEYS_DUBLICATE);            \
+  }                                                                      \
+  TEST(suiteName, mockClassInitList) {                                   \
+    constructorInitList<MockClass, int>(DEF_MOCK_KEYS,                   \
+                                        DEF_MOCK_KEYS_DUBLICATE);        \
+  }                                                                      \
+  TEST(suiteName, stringInitList) {                                      \
+    constructorInitList<std::string, int>(DEF_STR_KEYS,                  \
+                                          DEF_STR_KEYS_DUBLICATE);       \
+  }
+
+TESTS_CONSTRUCTOR_INIT_LIST(s21UnorderedMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void constructorCopyMove(const init_items<key_type, mapped_type>& items) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std_test_map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  test_map<key_type, mapped_type> s21_map_copy(s21_map);
+  checkFields(s21_map_copy, std_map);
+  EXPECT_TRUE(s21_map_copy == s21_map);
+
+  test_map<key_type, mapped_type> s21_map_moved(std::move(s21_map_copy));
+  checkFields(s21_map_moved, std_map);
+  EXPECT_TRUE(s21_map_copy.empty());
+
+  test_map<key_type, mapped_type> s21_map_assigned;
+  s21_map_assigned = s21_map;
+  checkFields(s21_map_assigned, std_map);
+  s21_map_assigned = std::move(s21_map);
+  checkFields(s21_map_assigned, std_map);
+  EXPECT_TRUE(s21_map_assigned != s21_map);
+}
+
+#define TESTS_CONSTRUCTOR_COPY_MOVE(suiteName)           \
+  TEST(suiteName, intCopyMove) {                         \
+    constructorCopyMove<int, int>(DEF_INT_KEYS);         \
+  }                                                      \
+  TEST(suiteName, doubleCopyMove) {                      \
+    constructorCopyMove<double, int>(DEF_DBL_KEYS);      \
+  }                                                      \
+  TEST(suiteName, mockClassCopyMove) {                   \
+    constructorCopyMove<MockClass, int>(DEF_MOCK_KEYS);  \
+  }                                                      \
+  TEST(suiteName, stringCopyMove) {                      \
+    constructorCopyMove<std::string, int>(DEF_STR_KEYS); \
+  }
+
+TESTS_CONSTRUCTOR_COPY_MOVE(s21UnorderedMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodAt(const init_items<key_type, mapped_type>& items,
+              const key_type& key, const key_type& key_duplicate,
+              const mapped_type& obj) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std_test_map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  EXPECT_EQ(s21_map.at(key_duplicate), std_map.at(key_duplicate));
+  EXPECT_THROW(s21_map.at(key), std::out_of_range);
+  EXPECT_THROW(std::as_const(s21_map).at(key), std::out_of_range);
+
+  s21_map[key] = obj;
+  std_map[key] = obj;
+  s21_map[key_duplicate] = obj;
+  std_map[key_duplicate] = obj;
+  EXPECT_EQ(std::as_const(s21_map).at(key), obj);
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_AT(suiteName)                                                \
+  TEST(suiteName, intAt) {                                                 \
+    methodAt<int, int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE, INT_OBJ); \
+  }                                                                        \
+  TEST(suiteName, doubleAt) {                                              \
+    methodAt<double, int>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE,        \
+                          DBL_OBJ);                                        \
+  }                                                                        \
+  TEST(suiteName, mockClassAt) {                                           \
+    methodAt<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY, MOCK_KEY_DUPLICATE,  \
+                             MOCK_OBJ);                                    \
+  }                                                                        \
+  TEST(suiteName, stringAt) {                                              \
+    methodAt<std::string, int>(DEF_STR_KEYS, STR_KEY, STR_KEY_DUPLICATE,   \
+                               STR_OBJ);                                   \
+  }
+
+TESTS_AT(s21UnorderedMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodInsert(const init_items<key_type, mapped_type>& items,
+                  const key_type& key, const key_type& key_duplicate,
+                  const mapped_type& obj) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std_test_map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  for (const key_type& k : {key, key_duplicate}) {
+    auto s21_res = s21_map.insert(std::make_pair(k, obj));
+    auto std_res = std_map.insert(std::make_pair(k, obj));
+    EXPECT_EQ(s21_res.first->second, std_res.first->second);
+    EXPECT_EQ(s21_res.second, std_res.second);
+  }
+  checkFields(s21_map, std_map);
+
+  auto s21_res = s21_map.insert_or_assign(key_duplicate, obj + 1);
+  auto std_res = std_map.insert_or_assign(key_duplicate, obj + 1);
+  EXPECT_EQ(s21_res.first->second, std_res.first->second);
+  EXPECT_EQ(s21_res.second, std_res.second);
+
+  s21_res = s21_map.try_emplace(key_duplicate, obj + 2);
+  std_res = std_map.try_emplace(key_duplicate, obj + 2);
+  EXPECT_EQ(s21_res.first->second, std_res.first->second);
+  EXPECT_EQ(s21_res.second, std_res.second);
+
+  s21_res = s21_map.emplace(key, obj + 3);
+  std_res = std_map.emplace(key, obj + 3);
+  EXPECT_EQ(s21_res.second, std_res.second);
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_INSERT(suiteName)                                         \
+  TEST(suiteName, intInsert) {                                          \
+    methodInsert<int, int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE,    \
+                           INT_OBJ);                                    \
+  }                                                                     \
+  TEST(suiteName, doubleInsert) {                                       \
+    methodInsert<double, int>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE, \
+                              DBL_OBJ);                                 \
+  }                                                                     \
+  TEST(suiteName, mockClassInsert) {                                    \
+    methodInsert<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY,               \
+                                 MOCK_KEY_DUPLICATE, MOCK_OBJ);         \
+  }                                                                     \
+  TEST(suiteName, stringInsert) {                                       \
+    methodInsert<std::string, int>(DEF_STR_KEYS, STR_KEY,               \
+                                   STR_KEY_DUPLICATE, STR_OBJ);         \
+  }
+
+TESTS_INSERT(s21UnorderedMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodInsertRange(const init_items<key_type, mapped_type>& items,
+                       const init_items<key_type, mapped_type>& insert_items) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std_test_map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  s21_map.insert(insert_items.begin(), insert_items.end());
+  std_map.insert(insert_items.begin(), insert_items.end());
+  checkFields(s21_map, std_map);
+
+  auto s21_res = s21_map.insert_many(*insert_items.begin(),
+                                     *(insert_items.begin() + 4),
+                                     std::make_pair(key_type(), 7));
+  auto std_last = std_map.insert(std::make_pair(key_type(), 7));
+  ASSERT_EQ(s21_res.size(), 3);
+  EXPECT_FALSE(s21_res[0].second);
+  EXPECT_FALSE(s21_res[1].second);
+  EXPECT_EQ(s21_res[2].second, std_last.second);
+  EXPECT_EQ(s21_res[0].first->first, insert_items.begin()->first);
+  EXPECT_EQ(s21_res[2].first->second, std_last.first->second);
+  checkFields(s21_map, std_map);
+}
+
+#define TESTS_INSERT_RANGE(suiteName)                                  \
+  TEST(suiteName, intInsertRange) {                                    \
+    methodInsertRange<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE); \
+  }                                                                    \
+  TEST(suiteName, doubleInsertRange) {                                 \
+    methodInsertRange<double, int>(DEF_DBL_KEYS,                       \
+                                   DEF_DBL_KEYS_DUBLICATE);            \
+  }                                                                    \
+  TEST(suiteName, mockClassInsertRange) {                              \
+    methodInsertRange<MockClass, int>(DEF_MOCK_KEYS,                   \
+                                      DEF_MOCK_KEYS_DUBLICATE);        \
+  }                                                                    \
+  TEST(suiteName, stringInsertRange) {                                 \
+    methodInsertRange<std::string, int>(DEF_STR_KEYS,                  \
+                                        DEF_STR_KEYS_DUBLICATE);       \
+  }
+
+TESTS_INSERT_RANGE(s21UnorderedMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodEraseContains(const init_items<key_type, mapped_type>& items,
+                         const key_type& key, const key_type& key_duplicate) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std_test_map<key_type, mapped_type> std_map(items.begin(), items.end());
+
+  EXPECT_FALSE(s21_map.contains(key));
+  EXPECT_TRUE(s21_map.contains(key_duplicate));
+  EXPECT_EQ(s21_map.find(key), s21_map.end());
+
+  s21_map.erase(s21_map.find(key_duplicate));
+  std_map.erase(key_duplicate);
+  EXPECT_FALSE(s21_map.contains(key_duplicate));
+  checkFields(s21_map, std_map);
+
+  EXPECT_EQ(s21_map.erase(key), 0U);
+  EXPECT_EQ(s21_map.erase(s21_map.begin()->first), 1U);
+  EXPECT_EQ(s21_map.size(), std_map.size() - 1);
+
+  while (!s21_map.empty()) s21_map.erase(s21_map.begin());
+  EXPECT_EQ(s21_map.begin(), s21_map.end());
+}
+
+#define TESTS_ERASE_CONTAINS(suiteName)                          \
+  TEST(suiteName, intEraseContains) {                            \
+    methodEraseContains<int, int>(DEF_INT_KEYS, INT_KEY,         \
+                                  INT_KEY_DUPLICATE);            \
+  }                                                              \
+  TEST(suiteName, doubleEraseContains) {                         \
+    methodEraseContains<double, int>(DEF_DBL_KEYS, DBL_KEY,      \
+                                     DBL_KEY_DUPLICATE);         \
+  }                                                              \
+  TEST(suiteName, mockClassEraseContains) {                      \
+    methodEraseContains<MockClass, int>(DEF_MOCK_KEYS, MOCK_KEY, \
+                                        MOCK_KEY_DUPLICATE);     \
+  }                                                              \
+  TEST(suiteName, stringEraseContains) {                         \
+    methodEraseContains<std::string, int>(DEF_STR_KEYS, STR_KEY, \
+                                          STR_KEY_DUPLICATE);    \
+  }
+
+TESTS_ERASE_CONTAINS(s21UnorderedMap)
+
+// -------------------------------------------------
+
+template <typename key_type, typename mapped_type>
+void methodMergeSwap(const init_items<key_type, mapped_type>& items,
+                     const init_items<key_type, mapped_type>& dublicates) {
+  test_map<key_type, mapped_type> s21_map(items);
+  std_test_map<key_type, mapped_type> std_map(items.begin(), items.end());
+  test_map<key_type, mapped_type> s21_map_dublicate(dublicates);
+  std_test_map<key_type, mapped_type> std_map_dublicate(dublicates.begin(),
+                                                        dublicates.end());
+
+  s21_map.merge(s21_map_dublicate);
+  std_map.merge(std_map_dublicate);
+  checkFields(s21_map, std_map);
+  checkFields(s21_map_dublicate, std_map_dublicate);
+
+  s21_map.swap(s21_map_dublicate);
+  checkFields(s21_map, std_map_dublicate);
+  checkFields(s21_map_dublicate, std_map);
+}
+
+#define TESTS_MERGE_SWAP(suiteName)                                          \
+  TEST(suiteName, intMergeSwap) {                                            \
+    methodMergeSwap<int, int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                          \
+  TEST(suiteName, doubleMergeSwap) {                                         \
+    methodMergeSwap<double, int>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                          \
+  TEST(suiteName, mockClassMergeSwap) {                                      \
+    methodMergeSwap<MockClass, int>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                          \
+  TEST(suiteName, stringMergeSwap) {                                         \
+    methodMergeSwap<std::string, int>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_MERGE_SWAP(s21UnorderedMap)
+
+// -------------------------------------------------
+
+// Hashes std::string and anything that converts to std::string_view alike
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view key) const {
+    return std::hash<std::string_view>()(key);
+  }
+};
+
+TEST(s21UnorderedMap, stringTransparentLookup) {
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> s21_map(
+      DEF_STR_KEYS);
+
+  EXPECT_TRUE(s21_map.contains("mock"));
+  EXPECT_TRUE(s21_map.contains(std::string_view("hello")));
+  EXPECT_FALSE(s21_map.contains("69"));
+  EXPECT_EQ(s21_map.find("world")->second, 4);
+
+  const auto& constMap = s21_map;
+  EXPECT_EQ(constMap.find(std::string_view("mock"))->second, 6);
+  EXPECT_EQ(constMap.find(std::string_view("69")), constMap.end());
+  EXPECT_EQ(constMap.at(std::string_view("hello")), 2);
+  EXPECT_THROW(constMap.at(std::string_view("69")), std::out_of_range);
+
+  s21_map.at(std::string_view("!")) = 70;
+  EXPECT_EQ(s21_map.at("!"), 70);
+  EXPECT_THROW(s21_map.at(std::string_view("69")), std::out_of_range);
+  EXPECT_EQ(s21_map.erase(std::string_view("set")), 1U);
+  EXPECT_EQ(s21_map.erase(std::string_view("set")), 0U);
+  s21_map.erase(s21_map.find("world"));
+  EXPECT_EQ(s21_map.size(), 3U);
+}
+
+TEST(s21UnorderedMap, intReserveRehash) {
+  test_map<int, int> s21_map;
+  EXPECT_EQ(s21_map.bucket_count(), 0U);
+  EXPECT_EQ(s21_map.load_factor(), 0.0f);
+
+  s21_map.reserve(1000);
+  const auto buckets = s21_map.bucket_count();
+  EXPECT_GE(buckets * s21_map.max_load_factor(), 1000.0f);
+  auto first = s21_map.insert(0, 0).first;
+  for (int i = 1; i < 1000; ++i) s21_map.insert(i, i);
+  EXPECT_EQ(s21_map.bucket_count(), buckets);
+  EXPECT_EQ(first->first, 0);
+
+  for (int i = 0; i < 1000; i += 2) s21_map.erase(i);
+  s21_map.rehash(0);
+  EXPECT_LT(s21_map.bucket_count(), buckets);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(s21_map.contains(i), i % 2 == 1);
+
+  s21_map.clear();
+  s21_map.rehash(0);
+  EXPECT_EQ(s21_map.bucket_count(), 0U);
+  EXPECT_EQ(s21_map.begin(), s21_map.end());
+}
+
+// Erased slots left as tombstones in full groups must neither end a probe
+// nor stay in the table forever
+TEST(s21UnorderedMap, mockClassCollidingKeys) {
+  test_map<MockClass, int> s21_map;
+  std_test_map<MockClass, int> std_map;
+
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < 100; ++i) {
+      s21_map.insert(MockClass(round * 100 + i), i);
+      std_map.insert(std::make_pair(MockClass(round * 100 + i), i));
+    }
+    for (int i = 0; i < 100; i += 3) {
+      s21_map.erase(MockClass(round * 100 + i));
+      std_map.erase(MockClass(round * 100 + i));
+    }
+  }
+  checkFields(s21_map, std_map);
+  EXPECT_LT(s21_map.bucket_count(), 2048U);
+}
+
+TEST(s21UnorderedMap, intEraseKeepsIterators) {
+  test_map<int, int> s21_map;
+  s21_map.reserve(300);
+  s21::vector<test_map<int, int>::iterator> kept;
+  for (int i = 0; i < 300; i++) kept.push_back(s21_map.insert(i, -i).first);
+
+  for (int i = 0; i < 300; i += 2) s21_map.erase(kept[i]);
+  EXPECT_EQ(s21_map.size(), 150U);
+  for (int i = 1; i < 300; i += 2) EXPECT_EQ(kept[i]->second, -i);
+}
+
+TEST(s21UnorderedMap, copyCounterTryEmplace) {
+  test_map<int, CopyCounter> s21_map;
+  CopyCounter::reset();
+
+  EXPECT_TRUE(s21_map.try_emplace(1, 10).second);
+  CopyCounter unused(11);
+  EXPECT_FALSE(s21_map.try_emplace(1, std::move(unused)).second);
+  EXPECT_EQ(CopyCounter::moves, 0);
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(s21_map.at(1).value(), 10);
+}
+
+// Each insert grows the table, so it must read its argument, a value of the
+// table itself, before the resize moves the pairs
+TEST(s21UnorderedMap, stringInsertOwnValueOnGrowth) {
+  test_map<int, std::string> s21_map;
+  const std::string text(40, '#');
+  auto fillToGrowth = [&]() {
+    const auto buckets = s21_map.bucket_count();
+    for (int i = int(s21_map.size()); s21_map.size() < buckets - buckets / 8;
+         ++i)
+      s21_map.insert(i, text + std::to_string(i));
+    return buckets;
+  };
+  s21_map.insert(0, text + "0");
+
+  auto buckets = fillToGrowth();
+  EXPECT_TRUE(s21_map.try_emplace(1000, s21_map.at(0)).second);
+  EXPECT_GT(s21_map.bucket_count(), buckets);
+  buckets = fillToGrowth();
+  EXPECT_TRUE(s21_map.insert(1001, s21_map.at(1)).second);
+  EXPECT_GT(s21_map.bucket_count(), buckets);
+  buckets = fillToGrowth();
+  EXPECT_TRUE(s21_map.insert_or_assign(1002, s21_map.at(2)).second);
+  EXPECT_GT(s21_map.bucket_count(), buckets);
+
+  EXPECT_EQ(s21_map.at(1000), text + "0");
+  EXPECT_EQ(s21_map.at(1001), text + "1");
+  EXPECT_EQ(s21_map.at(1002), text + "2");
+  EXPECT_EQ(s21_map.at(2), text + "2");
+}
+
+// Random updates of every kind against std::unordered_map
+TEST(s21UnorderedMap, intBigRandomUpdates) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 4999);
+  test_map<int, int> s21_map;
+  std_test_map<int, int> std_map;
+
+  for (int round = 0; round < 20000; ++round) {
+    int single = key(gen);
+    switch (round % 4) {
+      case 0:
+      case 1:
+        s21_map[single] += round;
+        std_map[single] += round;
+        break;
+      case 2:
+        EXPECT_EQ(s21_map.erase(single), std_map.erase(single));
+        break;
+      default:
+        EXPECT_EQ(s21_map.contains(single), std_map.count(single) == 1);
+    }
+  }
+  checkFields(s21_map, std_map);
+
+  test_map<int, int> s21_other;
+  std_test_map<int, int> std_other;
+  for (int i = 0; i < 3000; ++i) {
+    int item = key(gen);
+    s21_other.insert(item, i);
+    std_other.insert(std::make_pair(item, i));
+  }
+  s21_map.merge(s21_other);
+  std_map.merge(std_other);
+  checkFields(s21_map, std_map);
+  checkFields(s21_other, std_other);
+}
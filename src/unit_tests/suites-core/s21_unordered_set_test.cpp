@@ -0,0 +1,308 @@
+#include "core/s21_unordered_set.h"
+
+#include <random>
+#include <string_view>
+#include <unordered_set>
+
+#include "s21_core_tests.h"
+
+#define DEF_INT_KEYS \
+  { 1, 2, 3, 4, 8 }
+#define DEF_DBL_KEYS \
+  { 4.35, 2.977, 873.23, 6.875, 9.6534 }
+#define DEF_MOCK_KEYS \
+  { 1, 4, 44, 45, 88 }
+#define DEF_STR_KEYS \
+  { "hello", "world", "!", "mock", "set" }
+
+#define DEF_INT_KEYS_DUBLICATE \
+  { 6, 2, 3, 8, 10 }
+#define DEF_DBL_KEYS_DUBLICATE \
+  { 5.41, 2.977, 873.23, 6.875, 123.123 }
+#define DEF_MOCK_KEYS_DUBLICATE \
+  { 1, 9, 10, 45, 10 }
+#define DEF_STR_KEYS_DUBLICATE \
+  { "hello", "test", "!!!", "this", "mock" }
+
+#define INT_KEY 69
+#define DBL_KEY 69.69
+#define MOCK_KEY 69
+#define STR_KEY "69"
+
+#define INT_KEY_DUPLICATE 3
+#define DBL_KEY_DUPLICATE 6.875
+#define MOCK_KEY_DUPLICATE 44
+#define STR_KEY_DUPLICATE "!"
+
+// MockClass has no std::hash. All its keys hash alike, so every lookup
+// goes through the full chain of colliding keys.
+template <typename key_type>
+struct TestHash : std::hash<key_type> {};
+template <>
+struct TestHash<MockClass> {
+  std::size_t operator()(const MockClass&) const { return 0; }
+};
+
+template <typename key_type>
+using test_set = s21::unordered_set<key_type, TestHash<key_type>>;
+template <typename key_type>
+using std_test_set = std::unordered_set<key_type, TestHash<key_type>>;
+
+// The order of the keys is unspecified, so each one is looked up
+template <typename key_type, typename hash_type>
+void checkFields(const s21::unordered_set<key_type, hash_type>& s21_set,
+                 const std::unordered_set<key_type, hash_type>& std_set) {
+  std::size_t count = 0;
+  for (const auto& s21_item : s21_set) {
+    EXPECT_EQ(std_set.count(s21_item), 1U);
+    ++count;
+  }
+  EXPECT_EQ(count, std_set.size());
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  EXPECT_EQ(s21_set.empty(), std_set.empty());
+  EXPECT_LE(s21_set.load_factor(), s21_set.max_load_factor());
+}
+
+// -------------------------------------------------
+// -------------------------------------------------
+// -------------------------------------------------
+
+template <typename key_type>
+void constructorDefaultAsCont() {
+  s21::IContainer* ct = new test_set<key_type>();
+
+  EXPECT_EQ(ct->size(), 0);
+  EXPECT_TRUE(ct->empty());
+
+  delete ct;
+}
+
+#define TESTS_CONSTRUCTOR_INIT_AS_CONT(suiteName)                     \
+  TEST(suiteName, intInitAsCont) { constructorDefaultAsCont<int>(); } \
+  TEST(suiteName, doubleInitAsCont) {                                 \
+    constructorDefaultAsCont<double>();                               \
+  }                                                                   \
+  TEST(suiteName, mockClassInitAsCont) {                              \
+    constructorDefaultAsCont<MockClass>();                            \
+  }                                                                   \
+  TEST(suiteName, stringInitAsCont) {                                 \
+    constructorDefaultAsCont<std::string>();                          \
+  }
+
+TESTS_CONSTRUCTOR_INIT_AS_CONT(s21UnorderedSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void constructorInitList(const std::initializer_list<key_type>& items,
+                         const std::initializer_list<key_type>& dublicates) {
+  test_set<key_type> s21_set(items);
+  std_test_set<key_type> std_set(items);
+  checkFields(s21_set, std_set);
+
+  test_set<key_type> s21_set_dublicate(dublicates);
+  std_test_set<key_type> std_set_dublicate(dublicates);
+  checkFields(s21_set_dublicate, std_set_dublicate);
+
+  test_set<key_type> s21_set_range(std_set.begin(), std_set.end());
+  checkFields(s21_set_range, std_set);
+
+  test_set<key_type> s21_set_copy(s21_set);
+  EXPECT_TRUE(s21_set_copy == s21_set_range);
+  test_set<key_type> s21_set_moved(std::move(s21_set_copy));
+  EXPECT_TRUE(s21_set_copy.empty());
+  s21_set_copy = s21_set_dublicate;
+  EXPECT_TRUE(s21_set_copy != s21_set_moved);
+  s21_set_copy = std::move(s21_set_moved);
+  checkFields(s21_set_copy, std_set);
+}
+
+#define TESTS_CONSTRUCTOR_INIT_LIST(suiteName)                              \
+  TEST(suiteName, intInitList) {                                            \
+    constructorInitList<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                         \
+  TEST(suiteName, doubleInitList) {                                         \
+    constructorInitList<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                         \
+  TEST(suiteName, mockClassInitList) {                                      \
+    constructorInitList<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                         \
+  TEST(suiteName, stringInitList) {                                         \
+    constructorInitList<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_CONSTRUCTOR_INIT_LIST(s21UnorderedSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodInsert(const std::initializer_list<key_type>& items,
+                  const std::initializer_list<key_type>& insert_items) {
+  test_set<key_type> s21_set(items);
+  std_test_set<key_type> std_set(items);
+
+  for (const auto& item : insert_items) {
+    auto s21_res = s21_set.insert(item);
+    auto std_res = std_set.insert(item);
+    EXPECT_EQ(*s21_res.first, *std_res.first);
+    EXPECT_EQ(s21_res.second, std_res.second);
+  }
+  checkFields(s21_set, std_set);
+
+  auto s21_res = s21_set.emplace(*items.begin());
+  EXPECT_FALSE(s21_res.second);
+  EXPECT_EQ(*s21_res.first, *items.begin());
+
+  auto s21_many = s21_set.insert_many(*insert_items.begin(), key_type());
+  auto std_last = std_set.insert(key_type());
+  ASSERT_EQ(s21_many.size(), 2);
+  EXPECT_FALSE(s21_many[0].second);
+  EXPECT_EQ(*s21_many[0].first, *insert_items.begin());
+  EXPECT_EQ(s21_many[1].second, std_last.second);
+  checkFields(s21_set, std_set);
+}
+
+#define TESTS_INSERT(suiteName)                                      \
+  TEST(suiteName, intInsert) {                                       \
+    methodInsert<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                  \
+  TEST(suiteName, doubleInsert) {                                    \
+    methodInsert<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                  \
+  TEST(suiteName, mockClassInsert) {                                 \
+    methodInsert<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                  \
+  TEST(suiteName, stringInsert) {                                    \
+    methodInsert<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_INSERT(s21UnorderedSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodEraseFind(const std::initializer_list<key_type>& items,
+                     const key_type& key, const key_type& key_duplicate) {
+  test_set<key_type> s21_set(items);
+  std_test_set<key_type> std_set(items);
+
+  EXPECT_FALSE(s21_set.contains(key));
+  EXPECT_TRUE(s21_set.contains(key_duplicate));
+  EXPECT_EQ(s21_set.find(key), s21_set.end());
+  EXPECT_EQ(*s21_set.find(key_duplicate), key_duplicate);
+
+  s21_set.erase(s21_set.find(key_duplicate));
+  std_set.erase(key_duplicate);
+  EXPECT_FALSE(s21_set.contains(key_duplicate));
+  checkFields(s21_set, std_set);
+
+  EXPECT_EQ(s21_set.erase(key), 0U);
+  EXPECT_EQ(s21_set.erase(*s21_set.begin()), 1U);
+  EXPECT_EQ(s21_set.size(), std_set.size() - 1);
+
+  while (!s21_set.empty()) s21_set.erase(s21_set.begin());
+  EXPECT_EQ(s21_set.begin(), s21_set.end());
+}
+
+#define TESTS_ERASE_FIND(suiteName)                                          \
+  TEST(suiteName, intEraseFind) {                                            \
+    methodEraseFind<int>(DEF_INT_KEYS, INT_KEY, INT_KEY_DUPLICATE);          \
+  }                                                                          \
+  TEST(suiteName, doubleEraseFind) {                                         \
+    methodEraseFind<double>(DEF_DBL_KEYS, DBL_KEY, DBL_KEY_DUPLICATE);       \
+  }                                                                          \
+  TEST(suiteName, mockClassEraseFind) {                                      \
+    methodEraseFind<MockClass>(DEF_MOCK_KEYS, MOCK_KEY, MOCK_KEY_DUPLICATE); \
+  }                                                                          \
+  TEST(suiteName, stringEraseFind) {                                         \
+    methodEraseFind<std::string>(DEF_STR_KEYS, STR_KEY, STR_KEY_DUPLICATE);  \
+  }
+
+TESTS_ERASE_FIND(s21UnorderedSet)
+
+// -------------------------------------------------
+
+template <typename key_type>
+void methodMergeSwap(const std::initializer_list<key_type>& items,
+                     const std::initializer_list<key_type>& dublicates) {
+  test_set<key_type> s21_set(items);
+  std_test_set<key_type> std_set(items);
+  test_set<key_type> s21_set_dublicate(dublicates);
+  std_test_set<key_type> std_set_dublicate(dublicates);
+
+  s21_set.merge(s21_set_dublicate);
+  std_set.merge(std_set_dublicate);
+  checkFields(s21_set, std_set);
+  checkFields(s21_set_dublicate, std_set_dublicate);
+
+  s21_set.swap(s21_set_dublicate);
+  checkFields(s21_set, std_set_dublicate);
+  checkFields(s21_set_dublicate, std_set);
+}
+
+#define TESTS_MERGE_SWAP(suiteName)                                     \
+  TEST(suiteName, intMergeSwap) {                                       \
+    methodMergeSwap<int>(DEF_INT_KEYS, DEF_INT_KEYS_DUBLICATE);         \
+  }                                                                     \
+  TEST(suiteName, doubleMergeSwap) {                                    \
+    methodMergeSwap<double>(DEF_DBL_KEYS, DEF_DBL_KEYS_DUBLICATE);      \
+  }                                                                     \
+  TEST(suiteName, mockClassMergeSwap) {                                 \
+    methodMergeSwap<MockClass>(DEF_MOCK_KEYS, DEF_MOCK_KEYS_DUBLICATE); \
+  }                                                                     \
+  TEST(suiteName, stringMergeSwap) {                                    \
+    methodMergeSwap<std::string>(DEF_STR_KEYS, DEF_STR_KEYS_DUBLICATE); \
+  }
+
+TESTS_MERGE_SWAP(s21UnorderedSet)
+
+// -------------------------------------------------
+
+// Hashes std::string and anything that converts to std::string_view alike
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view key) const {
+    return std::hash<std::string_view>()(key);
+  }
+};
+
+TEST(s21UnorderedSet, stringTransparentLookup) {
+  s21::unordered_set<std::string, StringHash, std::equal_to<>> s21_set(
+      DEF_STR_KEYS);
+
+  EXPECT_TRUE(s21_set.contains("mock"));
+  EXPECT_TRUE(s21_set.contains(std::string_view("hello")));
+  EXPECT_FALSE(s21_set.contains("69"));
+  EXPECT_EQ(*s21_set.find("world"), "world");
+
+  EXPECT_EQ(s21_set.erase(std::string_view("mock")), 1U);
+  EXPECT_EQ(s21_set.erase(std::string_view("mock")), 0U);
+  s21_set.erase(s21_set.find("world"));
+  EXPECT_EQ(s21_set.size(), 3U);
+}
+
+// Random inserts and erases against std::unordered_set, through a few
+// rounds of growth
+TEST(s21UnorderedSet, intBigRandomUpdates) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> key(0, 9999);
+  test_set<int> s21_set(16);
+  std_test_set<int> std_set;
+  EXPECT_EQ(s21_set.bucket_count(), 16U);
+
+  for (int round = 0; round < 30000; ++round) {
+    int item = key(gen);
+    if (round % 3 == 2) {
+      EXPECT_EQ(s21_set.erase(item), std_set.erase(item));
+    } else {
+      EXPECT_EQ(s21_set.insert(item).second, std_set.insert(item).second);
+    }
+  }
+  checkFields(s21_set, std_set);
+
+  s21_set.rehash(s21_set.bucket_count() * 4);
+  checkFields(s21_set, std_set);
+  s21_set.clear();
+  std_set.clear();
+  checkFields(s21_set, std_set);
+}
@@ -1742,4 +1742,263 @@ void popBackEmptyTest() {
 
 TESTS_ANOMALY_POP_BACK_EMPTY(s21Vector)
 
-// --------------------------------------
\ No newline at end of file
+// --------------------------------------
+/* RELOCATION */
+
+template <typename T>
+void insertEraseMiddleTest(const std::initializer_list<T>& items) {
+  s21::vector<T> actual(items);
+  std::vector<T> expected(items);
+
+  for (std::size_t i = 0; i < 40; i++) {
+    const T& value = *(items.begin() + i % items.size());
+    actual.insert(actual.begin() + int(actual.size() / 2), value);
+    expected.insert(expected.begin() + expected.size() / 2, value);
+  }
+  EXPECT_EQ(actual.size(), expected.size());
+  EXPECT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin()));
+
+  for (std::size_t i = 0; i < 30; i++) {
+    actual.erase(actual.begin() + int(i % actual.size()));
+    expected.erase(expected.begin() + i % expected.size());
+  }
+  EXPECT_EQ(actual.size(), expected.size());
+  EXPECT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin()));
+}
+
+#define TESTS_RELOCATION_INSERT_ERASE_MIDDLE(suiteName)  \
+  TEST(suiteName, uShortInsertEraseMiddle) {             \
+    insertEraseMiddleTest<unsigned short>(DEF_INT_VALS); \
+  }                                                      \
+  TEST(suiteName, intInsertEraseMiddle) {                \
+    insertEraseMiddleTest<int>(DEF_INT_VALS);            \
+  }                                                      \
+  TEST(suiteName, doubleInsertEraseMiddle) {             \
+    insertEraseMiddleTest<double>(DEF_DBL_VALS);         \
+  }                                                      \
+  TEST(suiteName, MockClassInsertEraseMiddle) {          \
+    insertEraseMiddleTest<MockClass>(DEF_MOCK_VALS);     \
+  }                                                      \
+  TEST(suiteName, stringInsertEraseMiddle) {             \
+    insertEraseMiddleTest<std::string>(DEF_STR_VALS);    \
+  }
+
+TESTS_RELOCATION_INSERT_ERASE_MIDDLE(s21Vector)
+
+// --------------------------------------
+
+// Inner vectors are relocated with their bytes, so their buffers stay put
+TEST(s21Vector, nestedVectorGrowsByRelocation) {
+  EXPECT_TRUE(s21::is_trivially_relocatable_v<int>);
+  EXPECT_TRUE(s21::is_trivially_relocatable_v<s21::vector<std::string>>);
+  EXPECT_FALSE(s21::is_trivially_relocatable_v<std::string>);
+
+  s21::vector<s21::vector<int>> actual;
+  std::vector<const int*> buffers;
+  for (int i = 0; i < 100; i++) {
+    actual.push_back(s21::vector<int>{i, i + 1});
+    buffers.push_back(actual.back().data());
+  }
+  actual.erase(actual.begin() + 10);
+  buffers.erase(buffers.begin() + 10);
+  actual.insert(actual.begin(), s21::vector<int>{-1});
+
+  EXPECT_EQ(actual.size(), 100U);
+  EXPECT_EQ(actual[0][0], -1);
+  for (std::size_t i = 1; i < actual.size(); i++) {
+    const int key = int(i < 11 ? i - 1 : i);
+    EXPECT_EQ(actual[i].data(), buffers[i - 1]);
+    EXPECT_EQ(actual[i][0], key);
+    EXPECT_EQ(actual[i][1], key + 1);
+  }
+}
+
+// --------------------------------------
+
+/* BATCH INSERT */
+
+template <typename T>
+void rangeInsertTest(const std::initializer_list<T>& items) {
+  s21::vector<T> actual(items);
+  std::vector<T> expected(items);
+
+  auto actualIt = actual.insert(actual.begin() + 2, items.begin(), items.end());
+  auto expectedIt =
+      expected.insert(expected.begin() + 2, items.begin(), items.end());
+  EXPECT_EQ(*actualIt, *expectedIt);
+
+  actual.insert(actual.begin() + 1, 3, *(items.end() - 1));
+  expected.insert(expected.begin() + 1, 3, *(items.end() - 1));
+
+  actual.insert(actual.end(), items.begin(), items.begin() + 2);
+  expected.insert(expected.end(), items.begin(), items.begin() + 2);
+
+  actual.insert(actual.begin(), 0, *items.begin());
+  actual.insert(actual.begin(), items.begin(), items.begin());
+
+  EXPECT_EQ(actual.size(), expected.size());
+  EXPECT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin()));
+}
+
+#define TESTS_RANGE_INSERT(suiteName)                                     \
+  TEST(suiteName, uShortRangeInsert) {                                    \
+    rangeInsertTest<unsigned short>(DEF_INT_VALS);                        \
+  }                                                                       \
+  TEST(suiteName, intRangeInsert) { rangeInsertTest<int>(DEF_INT_VALS); } \
+  TEST(suiteName, doubleRangeInsert) {                                    \
+    rangeInsertTest<double>(DEF_DBL_VALS);                                \
+  }                                                                       \
+  TEST(suiteName, MockClassRangeInsert) {                                 \
+    rangeInsertTest<MockClass>(DEF_MOCK_VALS);                            \
+  }                                                                       \
+  TEST(suiteName, stringRangeInsert) {                                    \
+    rangeInsertTest<std::string>(DEF_STR_VALS);                           \
+  }
+
+TESTS_RANGE_INSERT(s21Vector)
+
+// --------------------------------------
+
+TEST(s21Vector, insertManyGrowsOnce) {
+  s21::vector<int> actual{1, 2, 3, 4};
+
+  auto it = actual.insert_many(actual.begin() + 2, 10, 11, 12, 13, 14);
+
+  EXPECT_EQ(actual.capacity(), 9U);
+  EXPECT_EQ(it, actual.begin() + 7);
+  EXPECT_EQ(actual, (s21::vector<int>{1, 2, 10, 11, 12, 13, 14, 3, 4}));
+}
+
+TEST(s21Vector, insertManyOwnElements) {
+  s21::vector<std::string> actual{"first", "second", "third"};
+  actual.shrink_to_fit();
+
+  actual.insert_many(actual.begin(), actual[2], actual.back(), "new");
+  actual.insert(actual.begin() + 1, 2, actual[0]);
+
+  EXPECT_EQ(actual, (s21::vector<std::string>{"third", "third", "third",
+                                               "third", "new", "first",
+                                               "second", "third"}));
+}
+
+/* FORWARDING */
+
+TEST(s21Vector, copyCounterOneConstructionPerElement) {
+  s21::vector<CopyCounter> actual;
+  actual.reserve(8);
+  CopyCounter::reset();
+
+  CopyCounter kept(1);
+  actual.push_back(kept);
+  actual.push_back(CopyCounter(2));
+  actual.emplace_back(3);
+  actual.emplace(actual.end(), 4);
+  actual.insert(actual.end(), CopyCounter(5));
+  actual.insert_many_back(6, CopyCounter(7));
+  actual.insert_many(actual.end(), kept);
+
+  EXPECT_EQ(CopyCounter::copies, 2);
+  EXPECT_EQ(CopyCounter::moves, 3);
+  ASSERT_EQ(actual.size(), 8U);
+  for (int i = 0; i < 7; i++) EXPECT_EQ(actual[i].value(), i + 1);
+  EXPECT_EQ(actual.back().value(), 1);
+}
+
+TEST(s21Vector, copyCounterOwnElementCopiedOnce) {
+  s21::vector<CopyCounter> actual;
+  actual.emplace_back(1);
+  actual.shrink_to_fit();
+  CopyCounter::reset();
+
+  actual.push_back(actual[0]);
+  actual.emplace(actual.begin(), actual.back());
+
+  EXPECT_EQ(CopyCounter::copies, 2);
+  ASSERT_EQ(actual.size(), 3U);
+  for (std::size_t i = 0; i < actual.size(); i++) {
+    EXPECT_EQ(actual[i].value(), 1);
+  }
+}
+
+TEST(s21Vector, emplaceBuildsInPlace) {
+  s21::vector<std::string> strings;
+  strings.emplace_back(3, 'a');
+  strings.emplace(strings.begin(), "first");
+  EXPECT_EQ(strings.emplace_back("last"), "last");
+  EXPECT_EQ(strings, (s21::vector<std::string>{"first", "aaa", "last"}));
+
+  s21::vector<s21::vector<int>> nested;
+  s21::vector<int> inner{1, 2, 3};
+  const int* innerData = inner.data();
+  nested.push_back(std::move(inner));
+  nested.emplace_back(5);
+  nested.insert(nested.begin(), s21::vector<int>{0});
+
+  EXPECT_EQ(nested[1].data(), innerData);
+  EXPECT_EQ(nested[2].size(), 5U);
+  EXPECT_EQ(nested[0][0], 0);
+}
+
+/* GROWTH POLICY */
+
+TEST(s21Vector, growthPolicyFactors) {
+  using doubling = s21::growth_policy<>;
+  using half = s21::growth_policy<3, 2>;
+
+  EXPECT_EQ(doubling::grow(0, 1, sizeof(int)), 1U);
+  EXPECT_EQ(doubling::grow(8, 9, sizeof(int)), 16U);
+  EXPECT_EQ(doubling::grow(8, 20, sizeof(int)), 20U);
+  EXPECT_EQ(half::grow(1, 2, sizeof(int)), 2U);
+  EXPECT_EQ(half::grow(8, 9, sizeof(int)), 12U);
+}
+
+TEST(s21Vector, growthPolicyPageRounded) {
+  using paged = s21::page_growth_policy<>;
+
+  EXPECT_EQ(paged::grow(100, 101, sizeof(int)), 150U);
+  EXPECT_EQ(paged::grow(1000, 1001, sizeof(int)), 2048U);
+  EXPECT_EQ(paged::grow(400000, 400001, sizeof(int)), 1048576U);
+  EXPECT_EQ(paged::grow(1000, 1001, 24), 1536U);
+  EXPECT_EQ(paged::grow(1000, 1001, 28), 1609U);
+}
+
+TEST(s21Vector, growthPolicyHalfPushBack) {
+  s21::vector<int, s21::growth_policy<3, 2>> actual;
+  std::size_t capacity = 0;
+  for (int i = 0; i < 1000; i++) {
+    actual.push_back(i);
+    if (actual.capacity() != capacity) {
+      EXPECT_LE(actual.capacity(), std::max<std::size_t>(2, capacity * 3 / 2));
+      capacity = actual.capacity();
+    }
+  }
+
+  EXPECT_LE(actual.capacity(), 1500U);
+  for (int i = 0; i < 1000; i++) EXPECT_EQ(actual[i], i);
+}
+
+TEST(s21Vector, growthPolicyUsableSize) {
+  s21::vector<char, s21::page_growth_policy<>> actual;
+  actual.push_back('a');
+#if defined(__GLIBC__)
+  EXPECT_EQ(actual.capacity(), malloc_usable_size(actual.data()));
+#endif
+
+  for (int i = 0; i < 10000; i++) actual.push_back(char(i));
+  EXPECT_GE(actual.capacity(), actual.size());
+  EXPECT_EQ(actual[10000], char(9999));
+
+  actual.shrink_to_fit();
+  EXPECT_EQ(actual.capacity(), actual.size());
+}
+
+TEST(s21Vector, reserveExact) {
+  s21::vector<std::string, s21::page_growth_policy<>> actual{"a", "b"};
+
+  actual.reserve_exact(1);
+  EXPECT_EQ(actual.capacity(), 2U);
+
+  actual.reserve_exact(1000);
+  EXPECT_EQ(actual.capacity(), 1000U);
+  EXPECT_EQ(actual[1], "b");
+}